@@ -0,0 +1,112 @@
+//
+//  bumpPathNormalization.cpp
+//  Bump
+//
+//  Created by Joseph Holub on 10/18/26.
+//  Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+// Bump headers
+#include <bump/FileSystem.h>
+#include <bump/Timer.h>
+
+// C++ headers
+#include <iostream>
+
+bump::String convertToUnixPathWithReplace(bump::String path)
+{
+	// The original approach running a separate replace pass for every separator pattern
+	path.replace("/\\", "/");
+	path.replace("\\/", "/");
+	path.replace("///", "/");
+	path.replace("//", "/");
+	path.replace("\\\\\\", "\\");
+	path.replace("\\\\", "\\");
+	path.replace("\\", "/");
+
+	return path;
+}
+
+bump::StringList buildPaths(unsigned int numberOfPaths)
+{
+	// Mix clean unix paths, windows paths and paths with runs of mixed separators
+	const char* templates[] = {
+		"/home/username/Documents/projects/bump/src/bump/FileSystem.cpp",
+		"C:\\Program Files\\Visual Studio\\VC\\include\\vector",
+		"//home\\\\username///Desktop\\\\\\Test/notes.txt",
+		"/\\/usr\\//local\\share/\\doc/bump/README.md"
+	};
+
+	bump::StringList paths;
+	paths.reserve(numberOfPaths);
+	for (unsigned int i = 0; i < numberOfPaths; ++i)
+	{
+		paths.push_back(templates[i % 4]);
+	}
+
+	return paths;
+}
+
+/**
+ * This example compares the single pass path normalizer against the old replace based one.
+ */
+int main(int argc, char **argv)
+{
+	const unsigned int number_of_paths = 1000000;
+	bump::StringList paths = buildPaths(number_of_paths);
+
+	//=======================================================================
+	//                 Time the seven pass replace approach
+	//=======================================================================
+
+	std::cout << "============= Normalizing " << number_of_paths << " paths =============" << std::endl;
+	bump::Timer timer;
+	timer.start();
+	std::size_t replace_length = 0;
+	for (unsigned int i = 0; i < number_of_paths; ++i)
+	{
+		replace_length += convertToUnixPathWithReplace(paths[i]).size();
+	}
+	double replace_time_ms = timer.millisecondsElapsed();
+	std::cout << "- Seven replace passes (ms): " << replace_time_ms << std::endl;
+
+	//=======================================================================
+	//                   Time the single pass normalizer
+	//=======================================================================
+
+	timer.restart();
+	std::size_t single_pass_length = 0;
+	for (unsigned int i = 0; i < number_of_paths; ++i)
+	{
+		single_pass_length += bump::FileSystem::convertToUnixPath(paths[i]).size();
+	}
+	double single_pass_time_ms = timer.millisecondsElapsed();
+	std::cout << "- Single pass (ms):          " << single_pass_time_ms << std::endl;
+
+	timer.restart();
+	for (unsigned int i = 0; i < number_of_paths; ++i)
+	{
+		bump::FileSystem::convertToWindowsPath(paths[i]);
+	}
+	std::cout << "- Single pass windows (ms):  " << timer.millisecondsElapsed() << std::endl;
+
+	if (single_pass_time_ms > 0.0)
+	{
+		std::cout << "- Speedup:                   " << replace_time_ms / single_pass_time_ms << "x" << std::endl;
+	}
+
+	//=======================================================================
+	//              Make sure both approaches agree on the results
+	//=======================================================================
+
+	std::cout << "\n============= Comparing the results =============" << std::endl;
+	for (unsigned int i = 0; i < 4; ++i)
+	{
+		std::cout << "- " << paths[i] << std::endl;
+		std::cout << "    replace:     " << convertToUnixPathWithReplace(paths[i]) << std::endl;
+		std::cout << "    single pass: " << bump::FileSystem::convertToUnixPath(paths[i]) << std::endl;
+	}
+	std::cout << "- Total lengths match: " << (replace_length == single_pass_length ? "yes" : "no") << std::endl;
+
+	return 0;
+}
@@ -0,0 +1,208 @@
+//
+//  AtomicFileWriter.h
+//  Bump
+//
+//  Created by Joseph Holub on 10/18/26.
+//  Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+#ifndef BUMP_ATOMIC_FILE_WRITER_H
+#define BUMP_ATOMIC_FILE_WRITER_H
+
+// Bump headers
+#include <bump/Export.h>
+#include <bump/String.h>
+#include <bump/StringView.h>
+
+// C++ headers
+#include <cstddef>
+#include <vector>
+
+namespace bump {
+
+/**
+ * Writes a file so that readers only ever see the old contents or the complete new contents.
+ *
+ * The data is written to a hidden temporary file in the same directory as the destination,
+ * through a large buffer so small writes do not each become a system call. Committing the
+ * writer flushes the buffer, optionally flushes the file to disk, then renames the temporary
+ * file over the destination in a single step. The rename is only durable once the directory
+ * holding it has been flushed as well, which the writer does by default. Destroying a writer
+ * that was not committed removes the temporary file and leaves the destination untouched.
+ *
+ * When the destination already exists, the new file gets the same permissions.
+ *
+ * @code
+ *   bump::AtomicFileWriter writer;
+ *   if (writer.open("settings.json"))
+ *   {
+ *       writer.write("{\n");
+ *       writer.write("  \"threads\": 8\n");
+ *       writer.write("}\n");
+ *       writer.commit();
+ *   }
+ * @endcode
+ */
+class BUMP_EXPORT AtomicFileWriter
+{
+public:
+
+	/**
+	 * Defines how much of a commit is flushed to disk before it returns.
+	 */
+	enum Durability
+	{
+		NO_SYNC,					/**< Nothing is flushed, the file may be lost or empty after a crash. */
+		SYNC_FILE,					/**< The file contents are flushed, the rename may be lost after a crash. */
+		SYNC_FILE_AND_DIRECTORY		/**< The file contents and the rename are both flushed. */
+	};
+
+	/**
+	 * Constructor.
+	 *
+	 * @param bufferSize The number of bytes gathered before they are written to the file.
+	 */
+	AtomicFileWriter(unsigned int bufferSize = 1048576);
+
+	/**
+	 * Destructor discarding the temporary file if the writer was not committed.
+	 */
+	~AtomicFileWriter();
+
+	/**
+	 * Creates the temporary file next to the destination, discarding any uncommitted file.
+	 *
+	 * @param path The path of the file to write.
+	 * @param durability How much of the commit is flushed to disk.
+	 * @return True if the temporary file was created, false otherwise.
+	 */
+	bool open(const String& path, Durability durability = SYNC_FILE_AND_DIRECTORY);
+
+	/**
+	 * Appends the data to the file.
+	 *
+	 * Writes smaller than the buffer are gathered in it, larger ones go straight to the file.
+	 *
+	 * @param data The data to append.
+	 * @return True if the data was written or buffered, false if the writer is not open or failed.
+	 */
+	bool write(const StringView& data);
+
+	/**
+	 * Flushes the data and renames the temporary file over the destination.
+	 *
+	 * The writer is closed afterwards whether or not the commit succeeded. When flushing the
+	 * directory fails after the rename, the destination already holds the new contents but
+	 * the rename may not survive a crash. The commit still fails, and destinationReplaced()
+	 * tells this case apart so the caller does not write the file again.
+	 *
+	 * @return True if the destination now holds the new contents with the requested
+	 *         durability, false otherwise.
+	 */
+	bool commit();
+
+	/**
+	 * Removes the temporary file and closes the writer without touching the destination.
+	 */
+	void discard();
+
+	/**
+	 * Returns whether the writer has a temporary file open.
+	 *
+	 * @return True if the writer is open, false otherwise.
+	 */
+	bool isOpen() const;
+
+	/**
+	 * Returns the path of the file being written.
+	 *
+	 * @return The destination path.
+	 */
+	const String& path() const;
+
+	/**
+	 * Returns whether the last commit renamed the new contents over the destination.
+	 *
+	 * @return True if the rename succeeded, even if flushing the directory failed afterwards.
+	 */
+	bool destinationReplaced() const;
+
+	/**
+	 * Returns the errno value of the first failure since the writer was opened.
+	 *
+	 * @return The errno value, 0 if nothing failed.
+	 */
+	int errorCode() const;
+
+	/**
+	 * Flushes the directory to disk so the renames inside it survive a crash.
+	 *
+	 * Writers committed with SYNC_FILE can share a single call per directory instead of
+	 * each flushing the directory on its own.
+	 *
+	 * @param path The path of the directory to flush.
+	 * @return True if the directory was flushed, false otherwise.
+	 */
+	static bool synchronizeDirectory(const String& path);
+
+protected:
+
+	/**
+	 * @internal
+	 * Records the errno value unless an earlier failure was already recorded.
+	 *
+	 * @param errorCode The errno value of the failure.
+	 */
+	void recordError(int errorCode);
+
+	/**
+	 * @internal
+	 * Writes the buffered data to the temporary file.
+	 *
+	 * @return True if the buffer was written, false otherwise.
+	 */
+	bool flushBuffer();
+
+	/**
+	 * @internal
+	 * Writes all the data to the temporary file, retrying short writes.
+	 *
+	 * @param data The first byte to write.
+	 * @param length The number of bytes to write.
+	 * @return True if all the data was written, false otherwise.
+	 */
+	bool writeData(const char* data, std::size_t length);
+
+	// Instance member variables
+	String				_path;				/**< @internal The destination path. */
+	String				_temporaryPath;		/**< @internal The path of the temporary file. */
+	Durability			_durability;		/**< @internal How much of the commit is flushed to disk. */
+	std::vector<char>	_buffer;			/**< @internal The data waiting to be written, allocated on first use. */
+	unsigned int		_bufferSize;		/**< @internal The capacity of the buffer. */
+	std::size_t			_bufferedBytes;		/**< @internal The number of bytes waiting in the buffer. */
+	int					_descriptor;		/**< @internal The platform descriptor of the temporary file. */
+	int					_errorCode;			/**< @internal The errno value of the first failure. */
+	bool				_replaced;			/**< @internal Whether the last commit renamed the temporary file over the destination. */
+
+private:
+
+	/**
+	 * @internal
+	 * Copy constructor.
+	 *
+	 * No-op since the temporary file cannot be shared.
+	 */
+	AtomicFileWriter(const AtomicFileWriter& atomicFileWriter);
+
+	/**
+	 * @internal
+	 * Overloaded assignment operator.
+	 *
+	 * No-op since the temporary file cannot be shared.
+	 */
+	void operator=(const AtomicFileWriter& atomicFileWriter);
+};
+
+}	// End of bump namespace
+
+#endif	// End of BUMP_ATOMIC_FILE_WRITER_H
@@ -12,6 +12,7 @@
 // Bump headers
 #include <bump/Export.h>
 #include <bump/String.h>
+#include <bump/StringView.h>
 
 namespace bump {
 
@@ -59,6 +60,23 @@ public:
 	 */
 	void setData(const char* data, int length);
 
+	/**
+	 * Sets the null terminated string data to generate the cryptographic hash.
+	 *
+	 * @param data The null terminated string to use to generate the cryptographic hash.
+	 */
+	void setData(const char* data);
+
+	/**
+	 * Sets the viewed data to generate the cryptographic hash, such as the contents of a MappedFile.
+	 *
+	 * The viewed data must stay valid until the result has been computed. Views larger than
+	 * 2 GB are hashed in pieces, so a whole mapped file gives the same result as sha1sum.
+	 *
+	 * @param data The viewed data to use to generate the cryptographic hash.
+	 */
+	void setData(const StringView& data);
+
 	/**
 	 * Resets the data and length of the hash to generate another hash.
 	 */
@@ -71,12 +89,25 @@ public:
 	 */
 	String result();
 
+	/**
+	 * Computes the cryptographic hash of the contents of a file and returns the 40 character hex string hash.
+	 *
+	 * The file is read ahead on a background thread while the data already read is hashed,
+	 * so files of any size are hashed in a single pass without being held in memory. The
+	 * data set on the hash is left alone.
+	 *
+	 * @param path The path of the file to hash.
+	 * @return The cryptographic hash as a 40 character hex string, empty if the file is
+	 *         empty or cannot be read with errno set.
+	 */
+	String fileResult(const String& path);
+
 protected:
 
 	// Instance member variables
 	Algorithm		_algorithm;		/**< @internal The algorithm to use to generate the cryptographic hash. */
 	const char*		_data;			/**< @internal The data used to generate the cryptographic hash. */
-	int				_length;		/**< @internal The length of the data used to generate the cryptographic hash. */
+	std::size_t		_length;		/**< @internal The length of the data used to generate the cryptographic hash. */
 };
 
 }	// End of bump namespace
@@ -0,0 +1,208 @@
+//
+//  DecompressingReader.h
+//  Bump
+//
+//  Created by Joseph Holub on 10/18/26.
+//  Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+#ifndef BUMP_DECOMPRESSING_READER_H
+#define BUMP_DECOMPRESSING_READER_H
+
+// Boost headers
+#include <boost/scoped_ptr.hpp>
+#include <boost/thread.hpp>
+
+// Bump headers
+#include <bump/Export.h>
+#include <bump/String.h>
+#include <bump/StringView.h>
+
+// C headers
+#include <stdio.h>
+
+// C++ headers
+#include <vector>
+
+namespace bump {
+
+// Forward declarations
+class BufferQueue;
+
+/**
+ * Reads the decompressed contents of a gzip or zstd compressed file.
+ *
+ * The file is decompressed on a background thread into a small queue of large blocks,
+ * so decompressing the next block overlaps with whatever the caller does with the last
+ * one, such as splitting it into lines. The decompressing thread stops once the queue
+ * is full and carries on as the caller takes blocks out of it, so memory use stays at
+ * a few blocks however large the file is.
+ *
+ * The format is detected from the magic bytes at the start of the file rather than from
+ * its extension. Files made of several concatenated gzip members or zstd frames, as
+ * written by appending to a compressed log, are read as one continuous stream.
+ *
+ * Each format is an optional dependency: gzip needs the library to be built with
+ * Bump_USE_ZLIB and zstd with Bump_USE_ZSTD. Opening a file in a format that was left
+ * out fails with ENOTSUP, which isFormatSupported() can check for up front.
+ *
+ * @code
+ *   bump::DecompressingReader reader;
+ *   if (reader.open("access.log.gz"))
+ *   {
+ *       std::vector<char> buffer(65536);
+ *       long bytes_read = 0;
+ *       while ((bytes_read = reader.read(&buffer[0], buffer.size())) > 0)
+ *       {
+ *           std::cout.write(&buffer[0], bytes_read);
+ *       }
+ *   }
+ * @endcode
+ */
+class BUMP_EXPORT DecompressingReader
+{
+public:
+
+	/**
+	 * Defines the formats a file can be stored in.
+	 */
+	enum Format
+	{
+		UNCOMPRESSED,		/**< Not in a known compressed format. */
+		GZIP_FORMAT,		/**< Compressed with gzip, starting with the bytes 1f 8b. */
+		ZSTD_FORMAT			/**< Compressed with zstd, starting with the bytes 28 b5 2f fd. */
+	};
+
+	/**
+	 * Constructor.
+	 *
+	 * @param blockSize The number of decompressed bytes in each queued block.
+	 * @param numberOfBlocks The number of blocks decompressed ahead of the caller.
+	 */
+	DecompressingReader(unsigned int blockSize = 1048576, unsigned int numberOfBlocks = 4);
+
+	/**
+	 * Destructor stopping the decompressing thread and closing the file.
+	 */
+	~DecompressingReader();
+
+	/**
+	 * Returns the format of the file at the path, judging by its magic bytes.
+	 *
+	 * @param path The path of the file.
+	 * @return The format of the file, UNCOMPRESSED if it cannot be read.
+	 */
+	static Format detectFormat(const String& path);
+
+	/**
+	 * Returns the format of data starting with the bytes.
+	 *
+	 * @param leadingBytes The first few bytes of the data, at least four to recognize every format.
+	 * @return The format of the data.
+	 */
+	static Format detectFormatFromBytes(const StringView& leadingBytes);
+
+	/**
+	 * Returns whether the library was built with support for decompressing the format.
+	 *
+	 * @param format The compressed format.
+	 * @return True if files in the format can be read, false otherwise.
+	 */
+	static bool isFormatSupported(Format format);
+
+	/**
+	 * Opens the compressed file at the path and starts decompressing it, closing any file that was already open.
+	 *
+	 * @param path The path of the compressed file.
+	 * @return True if the file was opened, false otherwise with errno set to EINVAL if the
+	 *         file is not compressed or ENOTSUP if its format is not supported.
+	 */
+	bool open(const String& path);
+
+	/**
+	 * Stops decompressing and closes the file.
+	 */
+	void close();
+
+	/**
+	 * Returns whether a file is open.
+	 *
+	 * @return True if a file is open, false otherwise.
+	 */
+	bool isOpen() const;
+
+	/**
+	 * Returns the format of the open file.
+	 *
+	 * @return The format of the file, UNCOMPRESSED if no file is open.
+	 */
+	Format format() const;
+
+	/**
+	 * Copies the next decompressed bytes into the buffer, waiting for them to be decompressed if necessary.
+	 *
+	 * Everything decompressed before a failure is still returned before the failure is reported.
+	 *
+	 * @param buffer The buffer to copy the bytes into.
+	 * @param size The size of the buffer.
+	 * @return The number of bytes copied, 0 at the end of the file, or -1 with errno set to
+	 *         EILSEQ for corrupt or truncated data, or to the error reading the file.
+	 */
+	long read(char* buffer, std::size_t size);
+
+protected:
+
+	/**
+	 * @internal
+	 * Decompresses the whole file, queueing the blocks as they fill up.
+	 */
+	void run();
+
+	/**
+	 * @internal
+	 * Decompresses a gzip file into the blocks.
+	 *
+	 * @param block The block being filled, queued once full.
+	 * @return The errno value of the failure, 0 on success or if asked to stop.
+	 */
+	int decompressGzip(std::vector<char>& block);
+
+	/**
+	 * @internal
+	 * Decompresses a zstd file into the blocks.
+	 *
+	 * @param block The block being filled, queued once full.
+	 * @return The errno value of the failure, 0 on success or if asked to stop.
+	 */
+	int decompressZstd(std::vector<char>& block);
+
+	// Instance member variables
+	unsigned int						_blockSize;			/**< @internal The number of decompressed bytes in each block. */
+	unsigned int						_numberOfBlocks;	/**< @internal The most blocks queued at once. */
+	FILE*								_file;				/**< @internal The compressed file, only read by the decompressing thread. */
+	Format								_format;			/**< @internal The format of the file. */
+	boost::scoped_ptr<BufferQueue>		_queue;				/**< @internal The blocks decompressed ahead of the caller. */
+	boost::scoped_ptr<boost::thread>	_thread;			/**< @internal The decompressing thread. */
+
+private:
+
+	/**
+	 * @internal
+	 * Copy constructor.
+	 *
+	 * No-op since the decompressing thread cannot be shared.
+	 */
+	DecompressingReader(const DecompressingReader& decompressingReader);
+
+	/**
+	 * @internal
+	 * Overloaded assignment operator.
+	 *
+	 * No-op since the decompressing thread cannot be shared.
+	 */
+	void operator=(const DecompressingReader& decompressingReader);
+};
+
+}	// End of bump namespace
+
+#endif	// End of BUMP_DECOMPRESSING_READER_H
@@ -0,0 +1,257 @@
+//
+//  DelimitedReader.h
+//  Bump
+//
+//  Created by Joseph Holub on 10/18/26.
+//  Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+#ifndef BUMP_DELIMITED_READER_H
+#define BUMP_DELIMITED_READER_H
+
+// Bump headers
+#include <bump/Export.h>
+#include <bump/LineReader.h>
+#include <bump/String.h>
+#include <bump/StringView.h>
+
+// C++ headers
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace bump {
+
+/**
+ * Describes how the records of a delimited text file, such as CSV or TSV, are written.
+ */
+struct BUMP_EXPORT DelimitedFormat
+{
+	/**
+	 * Constructor.
+	 *
+	 * Defaults to RFC 4180 style quoting, where a doubled quote inside a quoted field
+	 * stands for one quote, with no escape character and empty lines skipped.
+	 *
+	 * @param delimiter The character separating the fields, ',' for CSV or '\t' for TSV.
+	 */
+	DelimitedFormat(char delimiter = ',');
+
+	char		delimiter;			/**< Separates the fields of a record. */
+	char		quote;				/**< Encloses fields holding delimiters, quotes or newlines, '\0' disables quoting. */
+	char		escape;				/**< Makes the next character literal anywhere in a record, '\0' for none. */
+	bool		skipEmptyLines;		/**< Whether empty lines are skipped rather than read as a record with one empty field. */
+};
+
+/**
+ * Streams the records of a delimited text file, such as CSV or TSV, as views of their fields.
+ *
+ * The file is read through a LineReader, so only one chunk of it is in memory at a time.
+ * Records are split into fields without copying whenever possible: a record without any
+ * quote or escape characters is split straight out of the read buffer, finding the
+ * delimiters a vector register at a time. Only records that need unquoting are copied,
+ * into a buffer that is reused for every record. Quoted fields may hold delimiters, doubled
+ * quotes and newlines, so a single record can span several lines.
+ *
+ * The fields are views that are only valid until the next record is read. The typed
+ * accessors parse them in place with StringView::toLongLong() and StringView::toDouble()
+ * rather than going through a String.
+ *
+ * Quotes are only special at the start of a field, and an unterminated quoted field ends
+ * at the end of the file. A trailing '\r' is dropped from every line.
+ *
+ * @code
+ *   bump::DelimitedReader reader;
+ *   if (reader.open("prices.csv") && reader.readHeader())
+ *   {
+ *       int price_column = reader.columnIndex("price");
+ *       double total = 0.0;
+ *       double price = 0.0;
+ *       while (reader.readRecord())
+ *       {
+ *           if (reader.toDouble(price_column, price))
+ *           {
+ *               total += price;
+ *           }
+ *       }
+ *   }
+ * @endcode
+ */
+class BUMP_EXPORT DelimitedReader
+{
+public:
+
+	/**
+	 * Constructor.
+	 *
+	 * @param format How the records of the file are written.
+	 * @param bufferSize The number of bytes read from the file at a time.
+	 */
+	DelimitedReader(const DelimitedFormat& format = DelimitedFormat(), unsigned int bufferSize = 1048576);
+
+	/**
+	 * Opens the file at the path, closing any file that was already open.
+	 *
+	 * @param path The path of the delimited text file.
+	 * @return True if the file was opened, false otherwise with errno set.
+	 */
+	bool open(const String& path);
+
+	/**
+	 * Closes the file and forgets the column names.
+	 */
+	void close();
+
+	/**
+	 * Returns whether a file is open.
+	 *
+	 * @return True if a file is open, false otherwise.
+	 */
+	bool isOpen() const;
+
+	/**
+	 * Returns how the records of the file are written.
+	 *
+	 * @return The format of the file.
+	 */
+	const DelimitedFormat& format() const;
+
+	/**
+	 * Reads the next record as the names of the columns.
+	 *
+	 * @return True if the names were read, false at the end of the file or on an error.
+	 */
+	bool readHeader();
+
+	/**
+	 * Reads the next record.
+	 *
+	 * @return True if a record was read, false at the end of the file or on an error.
+	 */
+	bool readRecord();
+
+	/**
+	 * Returns the number of records read, not counting the header.
+	 *
+	 * @return The number of the current record, starting at 1.
+	 */
+	unsigned long long recordNumber() const;
+
+	/**
+	 * Returns the line the current record ends on.
+	 *
+	 * @return The line number of the end of the current record, starting at 1.
+	 */
+	unsigned long long lineNumber() const;
+
+	/**
+	 * Returns the errno value of the failure that stopped the reader.
+	 *
+	 * @return The errno value, 0 if reading has not failed.
+	 */
+	int errorCode() const;
+
+	/**
+	 * Returns the number of fields in the current record.
+	 *
+	 * @return The number of fields.
+	 */
+	unsigned int numberOfFields() const;
+
+	/**
+	 * Returns the fields of the current record.
+	 *
+	 * @return The fields, valid until the next record is read.
+	 */
+	const StringViewList& fields() const;
+
+	/**
+	 * Returns a field of the current record.
+	 *
+	 * @param column The index of the field.
+	 * @return The field, empty if the record has no such field.
+	 */
+	StringView field(unsigned int column) const;
+
+	/**
+	 * Returns the column names read by readHeader().
+	 *
+	 * @return The column names, empty if no header was read.
+	 */
+	const StringList& columnNames() const;
+
+	/**
+	 * Returns the index of the column with the name.
+	 *
+	 * @param name The name of the column.
+	 * @return The index of the column, -1 if there is no such column.
+	 */
+	int columnIndex(const StringView& name) const;
+
+	/**
+	 * Parses a field of the current record as an integer.
+	 *
+	 * @param column The index of the field.
+	 * @param value Set to the integer on success.
+	 * @return True if the field exists and is an integer, false otherwise.
+	 */
+	bool toLongLong(int column, long long& value) const;
+
+	/**
+	 * Parses a field of the current record as a floating point number.
+	 *
+	 * @param column The index of the field.
+	 * @param value Set to the number on success.
+	 * @return True if the field exists and is a number, false otherwise.
+	 */
+	bool toDouble(int column, double& value) const;
+
+protected:
+
+	/**
+	 * @internal
+	 * Reads the next record into the fields.
+	 *
+	 * @return True if a record was read, false otherwise.
+	 */
+	bool readFields();
+
+	/**
+	 * @internal
+	 * Unquotes a record starting with the line into the field buffer, reading more lines while a quote is open.
+	 *
+	 * @param line The first line of the record.
+	 */
+	void readQuotedFields(StringView line);
+
+	// Instance member variables
+	DelimitedFormat										_format;			/**< @internal How the records of the file are written. */
+	LineReader											_reader;			/**< @internal Reads the lines of the file. */
+	StringViewList										_fields;			/**< @internal The fields of the current record. */
+	std::string											_fieldBuffer;		/**< @internal The unquoted fields of a record that needed copying. */
+	std::vector<std::pair<std::size_t, std::size_t> >	_fieldRanges;		/**< @internal The offset and length of each unquoted field in the field buffer. */
+	StringList											_columnNames;		/**< @internal The column names read by readHeader(). */
+	unsigned long long									_recordNumber;		/**< @internal The number of records read. */
+
+private:
+
+	/**
+	 * @internal
+	 * Copy constructor.
+	 *
+	 * No-op since the line reader cannot be shared.
+	 */
+	DelimitedReader(const DelimitedReader& delimitedReader);
+
+	/**
+	 * @internal
+	 * Overloaded assignment operator.
+	 *
+	 * No-op since the line reader cannot be shared.
+	 */
+	void operator=(const DelimitedReader& delimitedReader);
+};
+
+}	// End of bump namespace
+
+#endif	// End of BUMP_DELIMITED_READER_H
@@ -0,0 +1,242 @@
+//
+//  Directory.h
+//  Bump
+//
+//  Created by Joseph Holub on 10/18/26.
+//  Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+#ifndef BUMP_DIRECTORY_H
+#define BUMP_DIRECTORY_H
+
+// Bump headers
+#include <bump/Export.h>
+#include <bump/FileSystem.h>
+#include <bump/String.h>
+
+// C++ headers
+#include <ctime>
+#include <vector>
+
+namespace bump {
+
+/**
+ * An open handle to a directory that names its contents relative to itself.
+ *
+ * The FileSystem methods resolve every path from the root or the current path on each
+ * call, which repeats the lookup of every parent directory and lets the tree change
+ * between a check and the operation that follows it. A Directory resolves its path once
+ * when it is opened and pins the directory itself, so every operation on a name inside
+ * it is a single lookup that cannot be redirected by renaming or replacing one of its
+ * parents. Child directories are opened relative to their parent in the same way, which
+ * makes recursive operations both faster and safe against symbolic links being swapped
+ * in halfway through.
+ *
+ * Names passed to the methods are single path components relative to the directory.
+ * When a method fails it returns false and leaves errno set to the reason.
+ *
+ * @code
+ *   bump::Directory directory;
+ *   if (directory.open("/tmp/output"))
+ *   {
+ *       directory.createDirectory("logs");
+ *       directory.createFile("logs.txt");
+ *       directory.rename("logs.txt", "old_logs.txt");
+ *
+ *       bump::Directory::EntryList entries;
+ *       directory.list(entries);
+ *   }
+ * @endcode
+ */
+class BUMP_EXPORT Directory
+{
+public:
+
+	/**
+	 * A single object found by list().
+	 */
+	struct BUMP_EXPORT Entry
+	{
+		String					name;		/**< The name of the object inside the directory. */
+		FileSystem::EntryType	type;		/**< The type of the object, symbolic links are never followed. */
+	};
+
+	/**
+	 * The status of an object inside the directory returned by stat().
+	 */
+	struct BUMP_EXPORT Status
+	{
+		/**
+		 * Constructor.
+		 */
+		Status();
+
+		FileSystem::EntryType	type;			/**< The type of the object. */
+		unsigned long long		size;			/**< The size in bytes. */
+		unsigned int			mode;			/**< The type and permission bits. */
+		unsigned int			ownerId;		/**< The id of the owning user. */
+		unsigned int			groupId;		/**< The id of the owning group. */
+		std::time_t				modifiedDate;	/**< The last modified date. */
+	};
+
+	// Typedefs
+	typedef std::vector<Entry> EntryList; /**< Shortcut for creating vectors of entries. */
+
+	/**
+	 * Default constructor creating a handle that is not open.
+	 */
+	Directory();
+
+	/**
+	 * Destructor closing the handle.
+	 */
+	~Directory();
+
+	/**
+	 * Opens the directory at the path, closing any directory that was already open.
+	 *
+	 * @param path The path of the directory to open.
+	 * @return True if the directory was opened, false otherwise.
+	 */
+	bool open(const String& path);
+
+	/**
+	 * Opens the directory with the name inside the parent directory.
+	 *
+	 * Symbolic links are never followed, so the name must be a real directory inside
+	 * the parent.
+	 *
+	 * @param parent The open directory containing the directory.
+	 * @param name The name of the directory inside the parent.
+	 * @return True if the directory was opened, false otherwise.
+	 */
+	bool open(const Directory& parent, const String& name);
+
+	/**
+	 * Closes the handle if it is open.
+	 */
+	void close();
+
+	/**
+	 * Returns whether the handle is open.
+	 *
+	 * @return True if the handle is open, false otherwise.
+	 */
+	bool isOpen() const;
+
+	/**
+	 * Returns the path the directory was opened with, joined with the names of any parents.
+	 *
+	 * The path is only informational, the operations never resolve it again.
+	 *
+	 * @return The path of the directory.
+	 */
+	const String& path() const;
+
+	/**
+	 * Returns the platform descriptor of the open directory.
+	 *
+	 * @return The descriptor, -1 if the handle is not open.
+	 */
+	int descriptor() const;
+
+	/**
+	 * Creates an empty file inside the directory.
+	 *
+	 * @param name The name of the file to create.
+	 * @return True if the file was created, false if it already exists or could not be created.
+	 */
+	bool createFile(const String& name) const;
+
+	/**
+	 * Removes the file or symbolic link inside the directory.
+	 *
+	 * @param name The name of the file or symbolic link to remove.
+	 * @return True if it was removed, false otherwise.
+	 */
+	bool removeFile(const String& name) const;
+
+	/**
+	 * Creates a directory inside the directory.
+	 *
+	 * @param name The name of the directory to create.
+	 * @return True if the directory was created, false otherwise.
+	 */
+	bool createDirectory(const String& name) const;
+
+	/**
+	 * Removes the empty directory inside the directory.
+	 *
+	 * @param name The name of the directory to remove.
+	 * @return True if the directory was removed, false otherwise.
+	 */
+	bool removeDirectory(const String& name) const;
+
+	/**
+	 * Renames the object inside the directory, replacing anything the new name refers to.
+	 *
+	 * @param name The current name of the object.
+	 * @param newName The new name of the object.
+	 * @return True if the object was renamed, false otherwise.
+	 */
+	bool rename(const String& name, const String& newName) const;
+
+	/**
+	 * Moves the object inside the directory into the destination directory under the new name.
+	 *
+	 * @param name The current name of the object.
+	 * @param destination The open directory to move the object into.
+	 * @param newName The new name of the object inside the destination.
+	 * @return True if the object was moved, false otherwise.
+	 */
+	bool rename(const String& name, const Directory& destination, const String& newName) const;
+
+	/**
+	 * Queries the status of the object inside the directory.
+	 *
+	 * @param name The name of the object, "." queries the directory itself.
+	 * @param status The status to fill in.
+	 * @param followSymbolicLinks Whether a symbolic link reports the status of its target.
+	 * @return True if the status was queried, false otherwise.
+	 */
+	bool stat(const String& name, Status& status, bool followSymbolicLinks = false) const;
+
+	/**
+	 * Lists the objects inside the directory in the order the file system returns them.
+	 *
+	 * The dot and dot-dot entries are skipped. Types are taken from the directory entries
+	 * themselves and only looked up separately on file systems that do not report them.
+	 *
+	 * @param entries The list the entries are appended to.
+	 * @return True if the whole directory was listed, false otherwise.
+	 */
+	bool list(EntryList& entries) const;
+
+protected:
+
+	// Instance member variables
+	String		_path;			/**< @internal The path the directory was opened with. */
+	int			_descriptor;	/**< @internal The platform descriptor of the open directory. */
+
+private:
+
+	/**
+	 * @internal
+	 * Copy constructor.
+	 *
+	 * No-op since the open handle cannot be shared.
+	 */
+	Directory(const Directory& directory);
+
+	/**
+	 * @internal
+	 * Overloaded assignment operator.
+	 *
+	 * No-op since the open handle cannot be shared.
+	 */
+	void operator=(const Directory& directory);
+};
+
+}	// End of bump namespace
+
+#endif	// End of BUMP_DIRECTORY_H
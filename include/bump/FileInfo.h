@@ -14,6 +14,7 @@
 
 // Bump headers
 #include <bump/Export.h>
+#include <bump/FileSystemStatus.h>
 #include <bump/String.h>
 
 namespace bump {
@@ -70,6 +71,15 @@ public:
 	 */
 	unsigned long long fileSize() const;
 
+	/**
+	 * Returns the file size of the path without throwing when it is missing or not a file.
+	 *
+	 * @param size Set to the file size of the path when the query succeeds.
+	 * @param status Set to FILE_SYSTEM_SUCCESS, or to the reason the query failed.
+	 * @return True if the query succeeded, false otherwise with errno set.
+	 */
+	bool fileSize(unsigned long long& size, FileSystemStatus& status) const;
+
 	/**
 	 * Returns whether the path is an absolute path.
 	 *
@@ -115,6 +125,15 @@ public:
 	 */
 	bool isEmpty() const;
 
+	/**
+	 * Returns whether the path points to an empty directory or empty file without throwing.
+	 *
+	 * @param empty Set to whether the path is empty when the query succeeds.
+	 * @param status Set to FILE_SYSTEM_SUCCESS, or to the reason the query failed.
+	 * @return True if the query succeeded, false otherwise with errno set.
+	 */
+	bool isEmpty(bool& empty, FileSystemStatus& status) const;
+
 	/**
 	 * Returns whether the path points to a hidden file.
 	 *
@@ -149,6 +168,15 @@ public:
 	 */
 	String canonicalPath() const;
 
+	/**
+	 * Returns the canonical path without throwing when the path does not exist.
+	 *
+	 * @param path Set to the cleaned absolute path when the query succeeds.
+	 * @param status Set to FILE_SYSTEM_SUCCESS, or to the reason the query failed.
+	 * @return True if the query succeeded, false otherwise with errno set.
+	 */
+	bool canonicalPath(String& path, FileSystemStatus& status) const;
+
 	/**
 	 * Returns the parent path.
 	 *
@@ -385,6 +413,19 @@ public:
 	 */
 	String owner() const;
 
+	/**
+	 * Returns the owner of the path without throwing when the path does not exist.
+	 *
+	 * @todo Add support for Windows.
+	 *
+	 * @throw bump::NotImplementedError When running on Windows.
+	 *
+	 * @param name Set to the owner of the path when the query succeeds.
+	 * @param status Set to FILE_SYSTEM_SUCCESS, or to the reason the query failed.
+	 * @return True if the query succeeded, false otherwise with errno set.
+	 */
+	bool owner(String& name, FileSystemStatus& status) const;
+
 	/**
 	 * Returns the owner id of the path. On Windows the return value is -1.
 	 *
@@ -397,6 +438,19 @@ public:
 	 */
 	unsigned int ownerId() const;
 
+	/**
+	 * Returns the owner id of the path without throwing when the path does not exist.
+	 *
+	 * @todo Add support for Windows.
+	 *
+	 * @throw bump::NotImplementedError When running on Windows.
+	 *
+	 * @param id Set to the owner id of the path when the query succeeds.
+	 * @param status Set to FILE_SYSTEM_SUCCESS, or to the reason the query failed.
+	 * @return True if the query succeeded, false otherwise with errno set.
+	 */
+	bool ownerId(unsigned int& id, FileSystemStatus& status) const;
+
 	/**
 	 * Returns the group of the path. On Windows the return value is empty.
 	 *
@@ -409,6 +463,19 @@ public:
 	 */
 	String group() const;
 
+	/**
+	 * Returns the group of the path without throwing when the path does not exist.
+	 *
+	 * @todo Add support for Windows.
+	 *
+	 * @throw bump::NotImplementedError When running on Windows.
+	 *
+	 * @param name Set to the group of the path when the query succeeds.
+	 * @param status Set to FILE_SYSTEM_SUCCESS, or to the reason the query failed.
+	 * @return True if the query succeeded, false otherwise with errno set.
+	 */
+	bool group(String& name, FileSystemStatus& status) const;
+
 	/**
 	 * Returns the group id of the path. On Windows the return value is -1.
 	 *
@@ -421,6 +488,19 @@ public:
 	 */
 	unsigned int groupId() const;
 
+	/**
+	 * Returns the group id of the path without throwing when the path does not exist.
+	 *
+	 * @todo Add support for Windows.
+	 *
+	 * @throw bump::NotImplementedError When running on Windows.
+	 *
+	 * @param id Set to the group id of the path when the query succeeds.
+	 * @param status Set to FILE_SYSTEM_SUCCESS, or to the reason the query failed.
+	 * @return True if the query succeeded, false otherwise with errno set.
+	 */
+	bool groupId(unsigned int& id, FileSystemStatus& status) const;
+
 	//====================================================================================
 	//                                Date Query Methods
 	//====================================================================================
@@ -434,6 +514,15 @@ public:
 	 */
 	std::time_t modifiedDate() const;
 
+	/**
+	 * Returns the date the file system object was last modified without throwing.
+	 *
+	 * @param date Set to the date the object was last modified when the query succeeds.
+	 * @param status Set to FILE_SYSTEM_SUCCESS, or to the reason the query failed.
+	 * @return True if the query succeeded, false otherwise with errno set.
+	 */
+	bool modifiedDate(std::time_t& date, FileSystemStatus& status) const;
+
 protected:
 
 	/**
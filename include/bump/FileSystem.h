@@ -9,10 +9,20 @@
 #ifndef BUMP_FILE_SYSTEM_H
 #define BUMP_FILE_SYSTEM_H
 
+// Boost headers
+#include <boost/function.hpp>
+
+// C++ headers
+#include <ctime>
+#include <vector>
+
 // Bump headers
 #include <bump/Export.h>
 #include <bump/FileInfo.h>
+#include <bump/FileSystemStatus.h>
+#include <bump/GlobPattern.h>
 #include <bump/String.h>
+#include <bump/StringView.h>
 
 namespace bump {
 
@@ -22,8 +32,10 @@ namespace bump {
  * FileSystem API:
  *    - Join Paths (join(), etc.)
  *    - System Paths (currentPath(), setCurrentPath(), temporaryPath(), etc.)
- *    - Path Queries (exists(), isDirectory(), isFile(), isSymbolicLink(), etc.)
+ *    - Path Queries (exists(), isDirectory(), isFile(), isSymbolicLink(), statBatch(), etc.)
  *    - Directories (createDirectory(), removeDirectory(), directoryInfoList(), etc.)
+ *    - Walking (walk())
+ *    - Snapshots (snapshot(), diff(), writeSnapshot(), readSnapshot())
  *    - Files (createFile(), renameFile(), removeFile(), copyFile(), etc.)
  *    - Symbolic Links (createSymbolicLink(), removeSymbolicLink(), renameSymbolicLink(), etc.)
  *    - Permissions (setPermissions(), permissions(), setIsReadableByUser(), setIsExecutableByOwner(), etc.)
@@ -51,8 +63,365 @@ enum Permission
 	ALL_ALL			= OWNER_ALL | GROUP_ALL | OTHERS_ALL
 };
 
+/**
+ * Defines the types of file system objects reported while walking a directory tree.
+ */
+enum EntryType
+{
+	FILE_ENTRY				= 0x0001,
+	DIRECTORY_ENTRY			= 0x0002,
+	SYMBOLIC_LINK_ENTRY		= 0x0004,
+	OTHER_ENTRY				= 0x0008,
+	ALL_ENTRIES				= FILE_ENTRY | DIRECTORY_ENTRY | SYMBOLIC_LINK_ENTRY | OTHER_ENTRY
+};
+
+/**
+ * Defines how symbolic links are treated while walking a directory tree.
+ */
+enum SymbolicLinkPolicy
+{
+	REPORT_SYMBOLIC_LINKS,		/**< Report symbolic links as SYMBOLIC_LINK_ENTRY without following them. */
+	FOLLOW_SYMBOLIC_LINKS,		/**< Report symbolic links as the type they point to and descend into linked directories. */
+	SKIP_SYMBOLIC_LINKS			/**< Ignore symbolic links entirely. */
+};
+
 // Typedefs
 typedef unsigned int Permissions; /**< Defines a Permissions wrapper allowing Permission objects to be OR'd together. */
+typedef unsigned int EntryTypes; /**< Defines an EntryTypes wrapper allowing EntryType objects to be OR'd together. */
+
+/**
+ * A single file system object found while walking a directory tree.
+ */
+struct BUMP_EXPORT WalkEntry
+{
+	String			path;		/**< The path of the object, which is the walk root joined with the relative path. */
+	EntryType		type;		/**< The type of the object. */
+	unsigned int	depth;		/**< The depth below the walk root, where direct children have a depth of 1. */
+};
+
+// Walk typedefs
+typedef std::vector<WalkEntry> WalkEntryList; /**< Shortcut for creating vectors of walk entries. */
+typedef boost::function<void (const WalkEntryList& entries)> WalkVisitor; /**< Receives each batch of walk entries. */
+typedef boost::function<void (const String& path, int errorCode)> WalkErrorCallback; /**< Receives each path that could not be read along with the errno value. */
+
+/**
+ * The options used to control a walk() of a directory tree.
+ */
+struct BUMP_EXPORT WalkOptions
+{
+	/**
+	 * Constructor.
+	 *
+	 * Defaults to walking the entire tree with idealThreadCount() threads, reporting
+	 * every entry and symbolic links without following them.
+	 */
+	WalkOptions();
+
+	unsigned int		numberOfThreads;		/**< The number of threads to walk with, 0 uses all the hardware threads. */
+	int					maximumDepth;			/**< The deepest entries to report and descend into, -1 for no limit. */
+	EntryTypes			entryTypes;				/**< The types of entries to report to the visitor. */
+	String				pattern;				/**< A GlobPattern entry filenames must match to be reported, empty matches all. */
+	SymbolicLinkPolicy	symbolicLinkPolicy;		/**< How symbolic links are treated. */
+	unsigned int		batchSize;				/**< The maximum number of entries handed to the visitor at once. */
+	WalkErrorCallback	errorCallback;			/**< Called for each directory or entry that could not be read. */
+};
+
+/**
+ * The running totals reported while copying a directory tree.
+ */
+struct BUMP_EXPORT CopyProgress
+{
+	/**
+	 * Constructor.
+	 */
+	CopyProgress();
+
+	unsigned long long	filesCopied;			/**< The number of regular files copied so far. */
+	unsigned long long	directoriesCopied;		/**< The number of directories created so far. */
+	unsigned long long	symbolicLinksCopied;	/**< The number of symbolic links recreated so far. */
+	unsigned long long	bytesCopied;			/**< The number of file bytes copied so far. */
+	unsigned long long	errors;					/**< The number of objects that could not be copied so far. */
+	String				path;					/**< The destination path of the object that was just copied. */
+};
+
+// Copy typedefs
+typedef boost::function<void (const CopyProgress& progress)> CopyProgressCallback; /**< Receives the totals after each object is copied. */
+typedef boost::function<void (const String& path, int errorCode)> CopyErrorCallback; /**< Receives each path that could not be copied along with the errno value. */
+
+/**
+ * The options used to control a copyDirectoryAndContents() call.
+ */
+struct BUMP_EXPORT CopyOptions
+{
+	/**
+	 * Constructor.
+	 *
+	 * Defaults to copying with idealThreadCount() threads, cloning file data when the file
+	 * system supports it and preserving permissions and modified dates.
+	 */
+	CopyOptions();
+
+	unsigned int			numberOfThreads;		/**< The number of threads to copy with, 0 uses all the hardware threads. */
+	bool					cloneFiles;				/**< Whether to share file data with a reflink when the file system supports it. */
+	bool					preservePermissions;	/**< Whether the copies get the same permissions as the sources. */
+	bool					preserveModifiedDates;	/**< Whether the copies get the same modified dates as the sources. */
+	CopyProgressCallback	progressCallback;		/**< Called after each file, directory and symbolic link is copied. */
+	CopyErrorCallback		errorCallback;			/**< Called for each object that could not be copied. */
+};
+
+/**
+ * The running totals reported while removing a directory tree.
+ */
+struct BUMP_EXPORT RemoveProgress
+{
+	/**
+	 * Constructor.
+	 */
+	RemoveProgress();
+
+	unsigned long long	filesRemoved;			/**< The number of regular files and other objects removed so far. */
+	unsigned long long	directoriesRemoved;		/**< The number of directories removed so far. */
+	unsigned long long	symbolicLinksRemoved;	/**< The number of symbolic links removed so far. */
+	unsigned long long	errors;					/**< The number of objects that could not be removed so far. */
+	String				path;					/**< The path of the last object that was removed. */
+};
+
+// Remove typedefs
+typedef boost::function<void (const RemoveProgress& progress)> RemoveProgressCallback; /**< Receives the totals after each batch of objects is removed. */
+typedef boost::function<void (const String& path, int errorCode)> RemoveErrorCallback; /**< Receives each path that could not be removed along with the errno value. */
+typedef boost::function<void (bool removed)> RemoveCompletionCallback; /**< Receives whether a background removal managed to remove the whole tree. */
+
+/**
+ * The options used to control a removeDirectoryAndContents() call.
+ */
+struct BUMP_EXPORT RemoveOptions
+{
+	/**
+	 * Constructor.
+	 *
+	 * Defaults to removing with idealThreadCount() threads and waiting until the whole
+	 * tree has been removed.
+	 */
+	RemoveOptions();
+
+	unsigned int				numberOfThreads;		/**< The number of threads to remove with, 0 uses all the hardware threads. */
+	bool						removeInBackground;		/**< Whether to rename the tree aside and remove it on a background thread. */
+	RemoveProgressCallback		progressCallback;		/**< Called after each batch of files and each directory is removed. */
+	RemoveErrorCallback			errorCallback;			/**< Called for each object that could not be removed. */
+	RemoveCompletionCallback	completionCallback;		/**< Called once a background removal has finished. */
+};
+
+/**
+ * Defines the strategies copyFile() can use to copy the file data.
+ */
+enum FileCopyMethod
+{
+	NO_COPY,				/**< No data has been copied. */
+	CLONE_COPY,				/**< The data blocks were shared with a reflink. */
+	COPY_FILE_RANGE_COPY,	/**< The data was copied inside the kernel with copy_file_range(). */
+	SENDFILE_COPY,			/**< The data was copied inside the kernel with sendfile(). */
+	READ_WRITE_COPY			/**< The data was copied through a user space buffer. */
+};
+
+// File copy typedefs
+typedef boost::function<bool (unsigned long long bytesCopied, unsigned long long totalBytes)> FileCopyProgressCallback; /**< Receives the progress of a file copy, returning false cancels it. */
+
+/**
+ * The options used to control a copyFile() call.
+ */
+struct BUMP_EXPORT FileCopyOptions
+{
+	/**
+	 * Constructor.
+	 *
+	 * Defaults to cloning when the file system supports it, keeping the holes of sparse
+	 * files and preserving the permissions but not the modified date of the source.
+	 */
+	FileCopyOptions();
+
+	bool						cloneFile;				/**< Whether to share the data with a reflink when the file system supports it. */
+	bool						preserveSparseFiles;	/**< Whether holes in sparse source files are left as holes in the copy. */
+	bool						preservePermissions;	/**< Whether the copy gets the same permissions as the source. */
+	bool						preserveModifiedDate;	/**< Whether the copy gets the same modified date as the source. */
+	unsigned int				bufferSize;				/**< The size of the buffer used when the data has to be copied through user space. */
+	unsigned int				readAheadBuffers;		/**< The number of buffers read ahead on a background thread when copying through user space, 0 reads on the calling thread. */
+	unsigned long long			chunkSize;				/**< The most bytes copied between calls to the progress callback. */
+	FileCopyProgressCallback	progressCallback;		/**< Called after each chunk is copied, can cancel the copy by returning false. */
+};
+
+/**
+ * The outcome of a copyFile() call.
+ */
+struct BUMP_EXPORT FileCopyResult
+{
+	/**
+	 * Constructor.
+	 */
+	FileCopyResult();
+
+	bool				succeeded;			/**< Whether the file was copied successfully. */
+	bool				cancelled;			/**< Whether the progress callback cancelled the copy. */
+	int					errorCode;			/**< The errno value of the failure, 0 if the copy succeeded. */
+	FileCopyMethod		method;				/**< The method that copied the last of the data. */
+	unsigned long long	bytesCopied;		/**< The number of bytes copied, not counting the holes of sparse files. */
+	double				secondsElapsed;		/**< The wall clock time the copy took. */
+	double				bytesPerSecond;		/**< The throughput of the copy. */
+};
+
+/**
+ * The status of many paths at once, stored as parallel arrays indexed like the requested paths.
+ *
+ * Keeping each field in its own array keeps scans over a single field, such as summing all
+ * the sizes, running through contiguous memory.
+ */
+struct BUMP_EXPORT StatBatchResult
+{
+	/**
+	 * Returns the number of paths in the batch.
+	 *
+	 * @return The number of paths in the batch.
+	 */
+	unsigned int size() const;
+
+	/**
+	 * Returns whether the path at the index could be stat'ed.
+	 *
+	 * @param index The index of the path in the requested paths.
+	 * @return True if the path exists, false otherwise.
+	 */
+	bool exists(unsigned int index) const;
+
+	std::vector<int>					errorCodes;		/**< The errno value for each path that could not be stat'ed, 0 otherwise. */
+	std::vector<EntryType>				types;			/**< The type of each path. */
+	std::vector<unsigned long long>		sizes;			/**< The size of each path in bytes. */
+	std::vector<unsigned int>			modes;			/**< The raw mode of each path, including the type and permission bits. */
+	std::vector<unsigned int>			ownerIds;		/**< The owner id of each path. */
+	std::vector<unsigned int>			groupIds;		/**< The group id of each path. */
+	std::vector<std::time_t>			modifiedDates;	/**< The modified date of each path. */
+};
+
+/**
+ * The recorded state of a single file system object inside a Snapshot.
+ */
+struct BUMP_EXPORT SnapshotEntry
+{
+	/**
+	 * Constructor.
+	 */
+	SnapshotEntry();
+
+	String				path;					/**< The path relative to the snapshot root, using forward slashes. */
+	EntryType			type;					/**< The type of the object, symbolic links are never followed. */
+	unsigned long long	size;					/**< The size of the object in bytes. */
+	std::time_t			modifiedDate;			/**< The modified date of the object. */
+	unsigned int		modifiedNanoseconds;	/**< The sub-second part of the modified date. */
+	unsigned int		mode;					/**< The raw mode of the object, including the type and permission bits. */
+	String				hash;					/**< The sha1 hex string of the whole file contents as sha1sum reports it, empty if the contents were not hashed. */
+};
+
+// Snapshot typedefs
+typedef std::vector<SnapshotEntry> SnapshotEntryList; /**< Shortcut for creating vectors of snapshot entries. */
+
+/**
+ * The recorded state of an entire directory tree, sorted by relative path.
+ *
+ * Snapshots can be written to and read back from a compact binary index file, and two
+ * snapshots of the same tree can be compared with diff() in a single pass.
+ */
+struct BUMP_EXPORT Snapshot
+{
+	/**
+	 * Constructor.
+	 */
+	Snapshot();
+
+	/**
+	 * Finds the entry for the relative path using a binary search.
+	 *
+	 * @param path The path relative to the snapshot root.
+	 * @return The entry for the path, NULL if the snapshot does not contain it.
+	 */
+	const SnapshotEntry* find(const String& path) const;
+
+	String					rootPath;			/**< The path of the directory the snapshot was taken of. */
+	bool					hashesContents;		/**< Whether the contents of every file were hashed. */
+	SnapshotEntryList		entries;			/**< The entries sorted by relative path. */
+};
+
+/**
+ * The relative paths that differ between two snapshots, each list sorted by path.
+ */
+struct BUMP_EXPORT SnapshotDiff
+{
+	/**
+	 * Returns whether the two snapshots were identical.
+	 *
+	 * @return True if nothing was added, removed or modified, false otherwise.
+	 */
+	bool isEmpty() const;
+
+	StringList		added;			/**< The paths only found in the newer snapshot. */
+	StringList		removed;		/**< The paths only found in the older snapshot. */
+	StringList		modified;		/**< The paths found in both snapshots whose state changed. */
+};
+
+/**
+ * A single file reported among the largest entries by diskUsage().
+ */
+struct BUMP_EXPORT DiskUsageEntry
+{
+	/**
+	 * Constructor.
+	 */
+	DiskUsageEntry();
+
+	String				path;				/**< The path of the file, which is the root joined with the relative path. */
+	unsigned long long	size;				/**< The logical size of the file in bytes. */
+	unsigned long long	allocatedBytes;		/**< The number of bytes allocated on disk for the file. */
+};
+
+// Disk usage typedefs
+typedef std::vector<DiskUsageEntry> DiskUsageEntryList; /**< Shortcut for creating vectors of disk usage entries. */
+
+/**
+ * The totals for a directory tree computed by diskUsage().
+ *
+ * Files with several hard links inside the tree are only counted once.
+ */
+struct BUMP_EXPORT DiskUsage
+{
+	/**
+	 * Constructor.
+	 */
+	DiskUsage();
+
+	unsigned long long	logicalBytes;		/**< The sum of the sizes of the regular files. */
+	unsigned long long	allocatedBytes;		/**< The bytes allocated on disk for every object, including directories. */
+	unsigned long long	files;				/**< The number of regular files. */
+	unsigned long long	directories;		/**< The number of directories, including the root. */
+	unsigned long long	symbolicLinks;		/**< The number of symbolic links, which are never followed. */
+	unsigned long long	others;				/**< The number of devices, sockets and named pipes. */
+	unsigned long long	hardLinks;			/**< The number of extra hard links that were not counted again. */
+	unsigned long long	errors;				/**< The number of objects that could not be read. */
+	DiskUsageEntryList	largestEntries;		/**< The largest files by logical size, largest first. */
+};
+
+/**
+ * The options used to control a diskUsage() call.
+ */
+struct BUMP_EXPORT DiskUsageOptions
+{
+	/**
+	 * Constructor.
+	 *
+	 * Defaults to using idealThreadCount() threads and keeping the 10 largest files.
+	 */
+	DiskUsageOptions();
+
+	unsigned int		numberOfThreads;		/**< The number of threads to walk with, 0 uses all the hardware threads. */
+	unsigned int		numberOfLargestEntries;	/**< The number of largest files to keep, 0 skips tracking them. */
+	bool				stayOnFileSystem;		/**< Whether to skip directories on other file systems than the root. */
+};
 
 //====================================================================================
 //                               Path Coversion Methods
@@ -61,6 +430,9 @@ typedef unsigned int Permissions; /**< Defines a Permissions wrapper allowing Pe
 /**
  * Converts the path to a Windows path by replacing forward slashes with backslashes.
  *
+ * The path is normalized in a single pass over its characters, collapsing every run of
+ * forward and backward slashes into one backslash.
+ *
  * @param path The path to convert to a Windows path.
  * @return The converted Windows path.
  */
@@ -69,6 +441,9 @@ BUMP_EXPORT String convertToWindowsPath(String path);
 /**
  * Converts the path to a Unix path by replacing backslashes with forward slashes.
  *
+ * The path is normalized in a single pass over its characters, collapsing every run of
+ * forward and backward slashes into one forward slash.
+ *
  * @param path The path to convert to a Unix path.
  * @return The converted Unix path.
  */
@@ -81,7 +456,9 @@ BUMP_EXPORT String convertToUnixPath(String path);
 /**
  * Joins the two strings together to form a single path.
  *
- * Important to note that a unix style path is returned. For example:
+ * All the join methods concatenate their components in a single pre-sized pass with
+ * bump::Path::join(), converting backslashes and collapsing duplicate slashes along the
+ * way. Important to note that a unix style path is returned. For example:
  *
  * @code
  *   bump::FileSystem::join("/home/username", "Desktop");          // returns "/home/username/Desktop"
@@ -268,6 +645,24 @@ BUMP_EXPORT bool isFile(const String& path);
  */
 BUMP_EXPORT bool isSymbolicLink(const String& path);
 
+/**
+ * Returns the status of all the paths using a single syscall per path.
+ *
+ * This is much cheaper than creating a FileInfo for each path when checking thousands of
+ * paths. Large batches are split across a thread pool, which mostly helps on network file
+ * systems where each call waits on a round trip. Paths that cannot be stat'ed have their
+ * errno value recorded in errorCodes, a type of OTHER_ENTRY and all other fields set to 0.
+ *
+ * @todo Add support for Windows.
+ *
+ * @throw bump::NotImplementedError When running on Windows.
+ *
+ * @param paths The paths to stat.
+ * @param followSymbolicLinks Whether symbolic links report the status of what they point to.
+ * @return The status of each path, in the same order as the paths.
+ */
+BUMP_EXPORT StatBatchResult statBatch(const StringList& paths, bool followSymbolicLinks = true);
+
 //====================================================================================
 //                                 Directory Methods
 //====================================================================================
@@ -303,10 +698,41 @@ BUMP_EXPORT bool removeDirectory(const String& path);
 /**
  * Removes the specified directory's contents recursively, then removes the directory itself.
  *
+ * On unix, the tree is removed through bump::Directory handles, so every object is removed
+ * relative to its own open parent and a directory swapped for a symbolic link part way
+ * through is never followed. A symbolic link to a directory is removed on its own.
+ *
+ * Each subdirectory is listed as a separate task on a work stealing thread pool and large
+ * directories split their files into batches for other threads to unlink. A directory is
+ * removed by whichever task finishes its last child, so each subtree is removed bottom-up
+ * without waiting on the rest of the tree. A failure to remove one object is reported to
+ * the error callback and the rest of the tree is still removed.
+ *
+ * The progress and error callbacks are called without holding any internal lock, so they
+ * can be called concurrently from several threads and must be thread safe.
+ *
+ * When removing in the background, the directory is first renamed aside to a hidden name
+ * next to it and the call returns as soon as the rename succeeds. The callbacks are then
+ * called from the background threads, and the completion callback is called last with
+ * whether the renamed tree was removed entirely. A tree that could not be removed is left
+ * behind under its hidden name, which the error callback reports.
+ *
+ * On Windows, the tree is removed serially and the options are ignored.
+ *
+ * @code
+ *   bump::FileSystem::RemoveOptions options;
+ *   options.removeInBackground = true;
+ *   options.completionCallback = boost::bind(&Cache::removalFinished, &cache, _1);
+ *   bump::FileSystem::removeDirectoryAndContents("build/cache", options);
+ *   bump::FileSystem::createDirectory("build/cache");   // the path is free right away
+ * @endcode
+ *
  * @param path The path of the directory to remove.
- * @return True if the directory and it's contents were removed successfully, false otherwise.
+ * @param options The options controlling the removal.
+ * @return True if the directory and it's contents were removed successfully, or if the
+ *         directory was renamed aside when removing in the background, false otherwise.
  */
-BUMP_EXPORT bool removeDirectoryAndContents(const String& path);
+BUMP_EXPORT bool removeDirectoryAndContents(const String& path, const RemoveOptions& options = RemoveOptions());
 
 /**
  * Copies the source directory over to the destination directory.
@@ -325,11 +751,25 @@ BUMP_EXPORT bool copyDirectory(const String& source, const String& destination);
 /**
  * Copies the source directory and all contents over to the destination directory.
  *
+ * On unix, each subdirectory is listed and each file is copied as a separate task on a
+ * work stealing thread pool, so many copies are in flight at once. Every object is read and
+ * written relative to bump::Directory handles for its source and destination parents, so
+ * each path is only looked up one component at a time. File data is cloned
+ * with a reflink when the file system supports it, otherwise it is copied inside the
+ * kernel with copy_file_range() or sendfile() before falling back to a read and write
+ * loop. Symbolic links are recreated as symbolic links rather than followed. A failure
+ * to copy one object is reported to the error callback and the rest of the tree is still
+ * copied. Directory permissions and modified dates are applied once all their contents
+ * have been copied.
+ *
+ * On Windows, the tree is copied serially and the options are ignored.
+ *
  * @param source The source directory to copy.
- * @param destination The destination directory to copy the source directory to.
+ * @param destination The destination directory to copy the source directory to, which must not exist.
+ * @param options The options controlling the copy.
  * @return True if the source directory and all contents were copied successfully, false otherwise.
  */
-BUMP_EXPORT bool copyDirectoryAndContents(const String& source, const String& destination);
+BUMP_EXPORT bool copyDirectoryAndContents(const String& source, const String& destination, const CopyOptions& options = CopyOptions());
 
 /**
  * Renames the source directory to the destination directory.
@@ -351,6 +791,47 @@ BUMP_EXPORT bool renameDirectory(const String& source, const String& destination
  */
 BUMP_EXPORT StringList directoryList(const String& path);
 
+/**
+ * Creates a list of file system object paths contained within the directory without throwing.
+ *
+ * @param path The path of the directory.
+ * @param paths Set to the sorted paths contained within the directory when the query succeeds.
+ * @param status Set to FILE_SYSTEM_SUCCESS, or to the reason the query failed.
+ * @return True if the query succeeded, false otherwise with errno set.
+ */
+BUMP_EXPORT bool directoryList(const String& path, StringList& paths, FileSystemStatus& status);
+
+/**
+ * Creates a list of file system object paths contained within the directory whose names match the pattern.
+ *
+ * The pattern is matched against the raw names as they are listed, so filtering by
+ * extension or name never stats the objects in the directory.
+ *
+ * @code
+ *   bump::StringList sources = bump::FileSystem::directoryList("src/bump", bump::GlobPattern("*.cpp"));
+ * @endcode
+ *
+ * @throw bump::FileSystemError When the path does not exist.
+ * @throw bump::FileSystemError When the path is not a directory.
+ *
+ * @param path The path of the directory.
+ * @param pattern The single component glob pattern the names must match.
+ * @return A sorted string list of the matching file system object paths contained within the directory.
+ */
+BUMP_EXPORT StringList directoryList(const String& path, const GlobPattern& pattern);
+
+/**
+ * Creates a list of file system object paths contained within the directory whose names match the
+ * pattern without throwing.
+ *
+ * @param path The path of the directory.
+ * @param pattern The single component glob pattern the names must match.
+ * @param paths Set to the sorted matching paths contained within the directory when the query succeeds.
+ * @param status Set to FILE_SYSTEM_SUCCESS, or to the reason the query failed.
+ * @return True if the query succeeded, false otherwise with errno set.
+ */
+BUMP_EXPORT bool directoryList(const String& path, const GlobPattern& pattern, StringList& paths, FileSystemStatus& status);
+
 /**
  * Creates a list of FileInfo objects contained within the directory.
  *
@@ -362,6 +843,191 @@ BUMP_EXPORT StringList directoryList(const String& path);
  */
 BUMP_EXPORT FileInfoList directoryInfoList(const String& path);
 
+/**
+ * Creates a list of FileInfo objects contained within the directory without throwing.
+ *
+ * @param path The path of the directory.
+ * @param infos Set to the file infos of the objects contained within the directory when the query succeeds.
+ * @param status Set to FILE_SYSTEM_SUCCESS, or to the reason the query failed.
+ * @return True if the query succeeded, false otherwise with errno set.
+ */
+BUMP_EXPORT bool directoryInfoList(const String& path, FileInfoList& infos, FileSystemStatus& status);
+
+//====================================================================================
+//                                   Walk Methods
+//====================================================================================
+
+/**
+ * Recursively walks the directory tree at path, handing every entry to the visitor.
+ *
+ * Each subdirectory is listed as a separate task on a work stealing thread pool, so
+ * large trees are traversed with all the configured threads. Entries are delivered to
+ * the visitor in batches of at most options.batchSize entries. The visitor is never
+ * called concurrently, but batches arrive in no particular order. The pattern and entry
+ * type filters only affect which entries are reported. Every directory within the
+ * maximum depth is still descended into. When following symbolic links, directories
+ * that have already been visited are skipped to avoid cycles. An exception thrown by
+ * the visitor does not stop the walk, but makes it return false.
+ *
+ * @code
+ *   bump::FileSystem::WalkOptions options;
+ *   options.entryTypes = bump::FileSystem::FILE_ENTRY;
+ *   options.pattern = "*.txt";
+ *   bump::FileSystem::walk("/home/username", boost::bind(&Indexer::addEntries, &indexer, _1), options);
+ * @endcode
+ *
+ * @todo Add support for Windows.
+ *
+ * @throw bump::NotImplementedError When running on Windows.
+ *
+ * @param path The path of the directory to walk.
+ * @param visitor The function called with each batch of entries.
+ * @param options The options controlling the walk.
+ * @return True if the entire tree was walked without any errors, false otherwise.
+ */
+BUMP_EXPORT bool walk(const String& path, const WalkVisitor& visitor, const WalkOptions& options = WalkOptions());
+
+/**
+ * Finds every file system object whose path matches the glob pattern.
+ *
+ * The pattern is compiled into a GlobPattern and the tree is only traversed as far as
+ * the pattern requires. Literal components are joined onto the path without listing
+ * their parent at all, so "src/bump/[A-F]*.cpp" lists a single directory no matter how
+ * large the rest of the tree is. Only '**' components descend through every directory
+ * below them, without following symbolic links. Names are matched as they are listed
+ * and objects are only stat'ed when the pattern needs their type and the directory
+ * entry does not provide it, or when the final component is literal and has to be
+ * checked for existence. Directories that cannot be read are skipped.
+ *
+ * @code
+ *   bump::StringList headers = bump::FileSystem::glob("include/bump/[A-Z]*.h");
+ *   bump::StringList tests = bump::FileSystem::glob("tests/bump[A-F]*Tests/[A-Z]*Test.cpp");
+ * @endcode
+ *
+ * @todo Add support for Windows.
+ *
+ * @throw bump::NotImplementedError When running on Windows.
+ *
+ * @param pattern The glob pattern, relative to the current path unless it starts with '/'.
+ * @return The sorted paths of the matching objects, formatted like the pattern.
+ */
+BUMP_EXPORT StringList glob(const String& pattern);
+
+//====================================================================================
+//                                 Snapshot Methods
+//====================================================================================
+
+/**
+ * Records the type, size, modified date and mode of every object below the directory.
+ *
+ * The tree is walked and stat'ed in parallel. Symbolic links are recorded as links and
+ * never followed. Objects that disappear while the snapshot is taken are left out. When
+ * hashing contents, the sha1 of every regular file is stored as well, except for files
+ * that cannot be read which are recorded without a hash. A directory that cannot be
+ * listed fails the snapshot, since its contents would otherwise look removed.
+ *
+ * @todo Add support for Windows.
+ *
+ * @throw bump::FileSystemError When the path is not a directory or part of the tree cannot be read.
+ * @throw bump::NotImplementedError When running on Windows.
+ *
+ * @param path The path of the directory to take a snapshot of.
+ * @param hashContents Whether to hash the contents of every file.
+ * @return The snapshot of the directory tree.
+ */
+BUMP_EXPORT Snapshot snapshot(const String& path, bool hashContents = false);
+
+/**
+ * Records a new snapshot of the directory, reusing the hashes of a previous snapshot.
+ *
+ * Only files that are new, or whose size or modified date changed since the previous
+ * snapshot, have their contents hashed again.
+ *
+ * @code
+ *   bump::FileSystem::Snapshot before = bump::FileSystem::readSnapshot("/tmp/project.snapshot");
+ *   bump::FileSystem::Snapshot after = bump::FileSystem::snapshot("/home/username/project", before, true);
+ *   bump::FileSystem::SnapshotDiff changes = bump::FileSystem::diff(before, after);
+ *   bump::FileSystem::writeSnapshot(after, "/tmp/project.snapshot");
+ * @endcode
+ *
+ * @todo Add support for Windows.
+ *
+ * @throw bump::FileSystemError When the path is not a directory or part of the tree cannot be read.
+ * @throw bump::NotImplementedError When running on Windows.
+ *
+ * @param path The path of the directory to take a snapshot of.
+ * @param previous An earlier snapshot of the same directory.
+ * @param hashContents Whether to hash the contents of every file, off by default as for snapshot(path).
+ * @return The snapshot of the directory tree.
+ */
+BUMP_EXPORT Snapshot snapshot(const String& path, const Snapshot& previous, bool hashContents = false);
+
+/**
+ * Compares two snapshots in a single pass over their sorted entries.
+ *
+ * An entry is modified when its type or mode changed. Files and symbolic links are also
+ * modified when their size changed, and when their contents changed. The contents are
+ * compared by hash when both entries were hashed, otherwise by modified date. Directory
+ * sizes and modified dates are ignored since they change along with their children.
+ *
+ * @param before The older snapshot.
+ * @param after The newer snapshot.
+ * @return The added, removed and modified paths.
+ */
+BUMP_EXPORT SnapshotDiff diff(const Snapshot& before, const Snapshot& after);
+
+/**
+ * Writes the snapshot to a compact binary index file.
+ *
+ * Paths are prefix compressed against the previous entry, numbers are variable length
+ * encoded and hashes are stored as raw bytes.
+ *
+ * @param snapshot The snapshot to write.
+ * @param path The path of the index file, which is replaced if it exists.
+ * @return True if the index file was written successfully, false otherwise.
+ */
+BUMP_EXPORT bool writeSnapshot(const Snapshot& snapshot, const String& path);
+
+/**
+ * Reads a snapshot back from an index file written by writeSnapshot().
+ *
+ * @throw bump::FileSystemError When the index file cannot be read or is not a valid index.
+ *
+ * @param path The path of the index file.
+ * @return The snapshot stored in the index file.
+ */
+BUMP_EXPORT Snapshot readSnapshot(const String& path);
+
+//====================================================================================
+//                                Disk Usage Methods
+//====================================================================================
+
+/**
+ * Adds up the sizes and counts of every object in the directory tree.
+ *
+ * Each directory is listed as a separate task on a work stealing thread pool and every
+ * entry is stat'ed exactly once, relative to its open parent directory. Files with more
+ * than one hard link are remembered by their device and inode so each one is counted
+ * once no matter how many names it has. Symbolic links are counted but never followed.
+ * Objects that cannot be read are counted as errors and the rest of the tree is still
+ * added up. When the path is a file, the totals only cover that file.
+ *
+ * @code
+ *   bump::FileSystem::DiskUsage usage = bump::FileSystem::diskUsage("/var/log");
+ *   std::cout << usage.allocatedBytes << " bytes in " << usage.files << " files" << std::endl;
+ * @endcode
+ *
+ * @todo Add support for Windows.
+ *
+ * @throw bump::FileSystemError When the path does not exist.
+ * @throw bump::NotImplementedError When running on Windows.
+ *
+ * @param path The path of the directory to add up.
+ * @param options The options controlling the walk.
+ * @return The totals for the tree.
+ */
+BUMP_EXPORT DiskUsage diskUsage(const String& path, const DiskUsageOptions& options = DiskUsageOptions());
+
 //====================================================================================
 //                                   File Methods
 //====================================================================================
@@ -385,12 +1051,43 @@ BUMP_EXPORT bool removeFile(const String& path);
 /**
  * Copies the source file over to the destination filepath.
  *
+ * If the source is a symbolic link, the link itself is copied. On unix, regular files
+ * are copied with the default FileCopyOptions.
+ *
  * @param source The source file to copy.
  * @param destination The destination file to copy the source file to.
  * @return True if the source file was copied successfully, false otherwise.
  */
 BUMP_EXPORT bool copyFile(const String& source, const String& destination);
 
+/**
+ * Copies the source file over to the destination filepath using the fastest method available.
+ *
+ * The data blocks are shared with a reflink when the file system supports it. Otherwise
+ * the data is copied inside the kernel with copy_file_range(), then sendfile(), before
+ * falling back to a read and write loop through an aligned buffer. Only the data regions
+ * of sparse files are copied so the holes stay holes. The data is copied in chunks so
+ * the progress callback can follow and cancel copies of very large files. The partial
+ * destination file is removed if the copy fails or is cancelled.
+ *
+ * @code
+ *   bump::FileSystem::FileCopyOptions options;
+ *   options.progressCallback = boost::bind(&ProgressBar::update, &progressBar, _1, _2);
+ *   bump::FileSystem::FileCopyResult result = bump::FileSystem::copyFile("disk.img", "backup.img", options);
+ *   std::cout << result.bytesPerSecond / 1e6 << " MB/s" << std::endl;
+ * @endcode
+ *
+ * @todo Add support for Windows.
+ *
+ * @throw bump::NotImplementedError When running on Windows.
+ *
+ * @param source The source file to copy, symbolic links are followed.
+ * @param destination The destination file to copy the source file to, which must not exist.
+ * @param options The options controlling the copy.
+ * @return The outcome of the copy.
+ */
+BUMP_EXPORT FileCopyResult copyFile(const String& source, const String& destination, const FileCopyOptions& options);
+
 /**
  * Renames the source file to the destination filepath.
  *
@@ -400,6 +1097,38 @@ BUMP_EXPORT bool copyFile(const String& source, const String& destination);
  */
 BUMP_EXPORT bool renameFile(const String& source, const String& destination);
 
+/**
+ * Replaces the contents of the file in a single step.
+ *
+ * The data is written to a temporary file next to the destination, which is then renamed
+ * over it, so readers only ever see the old or the new contents. When synchronizing, both
+ * the file and its directory are flushed to disk before returning.
+ *
+ * @see bump::AtomicFileWriter can write files piece by piece.
+ *
+ * @param path The path of the file to write.
+ * @param data The new contents of the file.
+ * @param synchronize Whether the new contents must survive a crash once this returns.
+ * @return True if the file now holds the data, false otherwise.
+ */
+BUMP_EXPORT bool writeFileAtomically(const String& path, const StringView& data, bool synchronize = true);
+
+/**
+ * Replaces the contents of many files, each in a single step.
+ *
+ * Each file is written and flushed like writeFileAtomically(), but every directory is only
+ * flushed once after all the files inside it have been renamed into place. A failure to
+ * write one file does not stop the others from being written.
+ *
+ * @throw bump::InvalidArgumentError When the number of paths and contents differ.
+ *
+ * @param paths The paths of the files to write.
+ * @param contents The new contents of each file.
+ * @param synchronize Whether the new contents must survive a crash once this returns.
+ * @return True if every file now holds its data, false otherwise.
+ */
+BUMP_EXPORT bool writeFilesAtomically(const StringList& paths, const StringList& contents, bool synchronize = true);
+
 //====================================================================================
 //                               Symbolic Link Methods
 //====================================================================================
@@ -494,6 +1223,20 @@ BUMP_EXPORT bool setPermissions(const String& path, Permissions permissions);
  */
 BUMP_EXPORT Permissions permissions(const String& path);
 
+/**
+ * Returns the permissions for the file or directory at path without throwing when it does not exist.
+ *
+ * @todo Add support for Windows.
+ *
+ * @throw bump::NotImplementedError When running on Windows.
+ *
+ * @param path The path of the file or directory to get the permissions for.
+ * @param permissions Set to the permissions of the file or directory when the query succeeds.
+ * @param status Set to FILE_SYSTEM_SUCCESS, or to the reason the query failed.
+ * @return True if the query succeeded, false otherwise with errno set.
+ */
+BUMP_EXPORT bool permissions(const String& path, Permissions& permissions, FileSystemStatus& status);
+
 /**
  * Enables/disables the owner readable permission's bit for the file or directory at path.
  *
@@ -634,6 +1377,16 @@ BUMP_EXPORT bool setModifiedDate(const String& path, const std::time_t& date);
  */
 BUMP_EXPORT std::time_t modifiedDate(const String& path);
 
+/**
+ * Returns the modified date for the file or directory at path without throwing when it does not exist.
+ *
+ * @param path The path of the file or directory to get the modified date for.
+ * @param date Set to the date the file system object was last modified when the query succeeds.
+ * @param status Set to FILE_SYSTEM_SUCCESS, or to the reason the query failed.
+ * @return True if the query succeeded, false otherwise with errno set.
+ */
+BUMP_EXPORT bool modifiedDate(const String& path, std::time_t& date, FileSystemStatus& status);
+
 }	// End of FileSystem namespace
 
 }	// End of bump namespace
@@ -0,0 +1,53 @@
+//
+//  FileSystemStatus.h
+//  Bump
+//
+//  Created by Joseph Holub on 10/18/26.
+//  Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+#ifndef BUMP_FILE_SYSTEM_STATUS_H
+#define BUMP_FILE_SYSTEM_STATUS_H
+
+// Bump headers
+#include <bump/Export.h>
+
+namespace bump {
+
+/**
+ * Defines why a non-throwing FileInfo or FileSystem query failed.
+ *
+ * The non-throwing overloads return false and hand back one of these values, leaving
+ * errno set to the underlying error. Nothing is allocated on the failure path, so code
+ * scanning trees where files vanish constantly can skip them without an exception.
+ *
+ * @code
+ *   unsigned long long size = 0;
+ *   bump::FileSystemStatus status;
+ *   if (!bump::FileInfo(path).fileSize(size, status) && status == bump::PATH_NOT_FOUND)
+ *   {
+ *       // The file was removed since it was listed
+ *   }
+ * @endcode
+ */
+enum FileSystemStatus
+{
+	FILE_SYSTEM_SUCCESS,		/**< The query succeeded. */
+	PATH_NOT_FOUND,				/**< The path, or the target of a symbolic link along it, does not exist. */
+	PATH_NOT_FILE,				/**< The path exists but is not a regular file. */
+	PATH_NOT_DIRECTORY,			/**< The path, or one of its parents, exists but is not a directory. */
+	PERMISSION_DENIED,			/**< Access to the path, or to one of its parents, was refused. */
+	FILE_SYSTEM_FAILURE			/**< Any other failure, errno holds the details. */
+};
+
+/**
+ * Returns the status matching an errno value.
+ *
+ * @param errorCode The errno value of the failure.
+ * @return The matching status, FILE_SYSTEM_SUCCESS if the error code is 0.
+ */
+BUMP_EXPORT FileSystemStatus fileSystemStatusFromErrorCode(int errorCode);
+
+}	// End of bump namespace
+
+#endif	// End of BUMP_FILE_SYSTEM_STATUS_H
@@ -0,0 +1,318 @@
+//
+//  FileWatcher.h
+//  Bump
+//
+//  Created by Joseph Holub on 10/18/26.
+//  Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+#ifndef BUMP_FILE_WATCHER_H
+#define BUMP_FILE_WATCHER_H
+
+// Boost headers
+#include <boost/function.hpp>
+#include <boost/scoped_ptr.hpp>
+#include <boost/thread.hpp>
+
+// Bump headers
+#include <bump/Export.h>
+#include <bump/String.h>
+
+// C++ headers
+#include <deque>
+#include <map>
+#include <vector>
+
+namespace bump {
+
+/**
+ * The FileWatcher class reports changes to files and directory trees as they happen.
+ *
+ * On Linux the watcher is backed by inotify, so no time is spent polling modified dates or
+ * directory listings. Directories can be watched recursively, in which case directories
+ * created inside the tree are watched as soon as they appear, and whatever they already
+ * hold by then, such as the contents of a directory moved into the tree, is reported as
+ * created. Changes are read on a
+ * background thread and coalesced: all the changes to a path arriving within the
+ * coalescing interval are merged into a single FileChange. A batch of changes is delivered
+ * once the file system has been quiet for the coalescing interval, or after ten intervals
+ * at most during a constant stream of changes.
+ *
+ * Batches can be delivered in any combination of three ways:
+ *    - To the callback on the watcher thread (IMMEDIATE_DELIVERY)
+ *    - To the callback on the thread calling processChanges() (QUEUED_DELIVERY)
+ *    - As a NotificationCenter post with the FileChangeList as the object
+ *
+ * @code
+ *   bump::FileWatcher watcher;
+ *   watcher.setNotificationName("ProjectFilesChanged");
+ *   watcher.addPath("/home/username/project", true);
+ *   watcher.start();
+ *
+ *   bump::Observer* observer = new bump::ObjectObserver<Indexer, bump::FileWatcher::FileChangeList>(
+ *       this, &Indexer::filesChanged, "ProjectFilesChanged");
+ *   ADD_OBSERVER(observer);
+ * @endcode
+ */
+class BUMP_EXPORT FileWatcher
+{
+public:
+
+	/**
+	 * Defines the types of changes that can be reported for a path.
+	 */
+	enum ChangeType
+	{
+		CREATED					= 0x0001,	/**< The path was created. */
+		MODIFIED				= 0x0002,	/**< The contents of the path were written to. */
+		REMOVED					= 0x0004,	/**< The path was removed. */
+		ATTRIBUTES_CHANGED		= 0x0008,	/**< The permissions, owner or dates of the path changed. */
+		MOVED_FROM				= 0x0010,	/**< The path was renamed to something else. */
+		MOVED_TO				= 0x0020,	/**< Something else was renamed to the path. */
+		OVERFLOWED				= 0x0040	/**< Changes were dropped by the kernel, the path is empty and everything should be rescanned. */
+	};
+
+	/**
+	 * Defines how batches of changes are handed to the callback.
+	 */
+	enum DeliveryMode
+	{
+		IMMEDIATE_DELIVERY,		/**< The callback is called on the watcher thread as soon as a batch is ready. */
+		QUEUED_DELIVERY			/**< Batches are queued until processChanges() calls the callback on its own thread. */
+	};
+
+	/**
+	 * A coalesced description of everything that happened to a single path.
+	 */
+	struct BUMP_EXPORT FileChange
+	{
+		String			path;			/**< The changed path, which is the watched path joined with the relative path. */
+		unsigned int	changes;		/**< The ChangeType values OR'd together. */
+		bool			isDirectory;	/**< Whether the path is a directory. */
+	};
+
+	// Typedefs
+	typedef std::vector<FileChange> FileChangeList; /**< A batch of changes, at most one per path. */
+	typedef boost::function<void (const FileChangeList& changes)> ChangeCallback; /**< Receives each batch of changes. */
+
+	/**
+	 * Constructor.
+	 */
+	FileWatcher();
+
+	/**
+	 * Destructor.
+	 *
+	 * Stops the watcher thread if it is running.
+	 */
+	~FileWatcher();
+
+	/**
+	 * Starts watching the path.
+	 *
+	 * Paths can be added before or after the watcher is started.
+	 *
+	 * @todo Add support for Windows.
+	 *
+	 * @throw bump::NotImplementedError When running on Windows.
+	 *
+	 * @param path The path of the file or directory to watch.
+	 * @param recursive Whether all the directories below the path are watched as well.
+	 * @return True if the path is being watched, false otherwise.
+	 */
+	bool addPath(const String& path, bool recursive = false);
+
+	/**
+	 * Stops watching the path, along with all the directories below it if it was added recursively.
+	 *
+	 * @todo Add support for Windows.
+	 *
+	 * @throw bump::NotImplementedError When running on Windows.
+	 *
+	 * @param path The path that was added.
+	 * @return True if the path was being watched, false otherwise.
+	 */
+	bool removePath(const String& path);
+
+	/**
+	 * Returns all the watched paths, including the directories found below recursive paths.
+	 *
+	 * @return The watched paths in no particular order.
+	 */
+	StringList watchedPaths();
+
+	/**
+	 * Sets how long the file system must be quiet before a batch of changes is delivered.
+	 *
+	 * @param milliseconds The coalescing interval in milliseconds, 50 by default.
+	 */
+	void setCoalescingInterval(unsigned int milliseconds);
+
+	/**
+	 * Returns how long the file system must be quiet before a batch of changes is delivered.
+	 *
+	 * @return The coalescing interval in milliseconds.
+	 */
+	unsigned int coalescingInterval();
+
+	/**
+	 * Sets the callback that receives each batch of changes.
+	 *
+	 * @param callback The function called with each batch of changes.
+	 * @param deliveryMode Which thread the callback is called on.
+	 */
+	void setCallback(const ChangeCallback& callback, DeliveryMode deliveryMode = IMMEDIATE_DELIVERY);
+
+	/**
+	 * Sets the name of the notification posted to the NotificationCenter with each batch of changes.
+	 *
+	 * The object of the notification is the FileChangeList. Notifications are posted from
+	 * the watcher thread.
+	 *
+	 * @param notificationName The name of the notification, empty disables the notifications.
+	 */
+	void setNotificationName(const String& notificationName);
+
+	/**
+	 * Returns the name of the notification posted with each batch of changes.
+	 *
+	 * @return The name of the notification, empty if none are posted.
+	 */
+	String notificationName();
+
+	/**
+	 * Calls the callback with each batch of changes queued by QUEUED_DELIVERY.
+	 *
+	 * @param timeoutMilliseconds How long to wait for a batch when none are queued, 0 returns immediately.
+	 * @return The number of batches handed to the callback.
+	 */
+	unsigned int processChanges(unsigned int timeoutMilliseconds = 0);
+
+	/**
+	 * Starts the watcher thread.
+	 *
+	 * @todo Add support for Windows.
+	 *
+	 * @throw bump::NotImplementedError When running on Windows.
+	 *
+	 * @return True if the watcher is running, false otherwise.
+	 */
+	bool start();
+
+	/**
+	 * Stops the watcher thread, dropping any changes that have not been delivered yet.
+	 */
+	void stop();
+
+	/**
+	 * Returns whether the watcher thread is running.
+	 *
+	 * @return True if the watcher is running, false otherwise.
+	 */
+	bool isRunning();
+
+protected:
+
+	/**
+	 * @internal
+	 * A single watched file or directory.
+	 */
+	struct Watch
+	{
+		String		path;			/**< @internal The path of the file or directory. */
+		String		rootPath;		/**< @internal The path that was added, which may be an ancestor of the path. */
+		bool		recursive;		/**< @internal Whether directories created below the path are watched as well. */
+	};
+
+	/** A map of watch descriptors to the watches they belong to. */
+	typedef std::map<int, Watch> WatchMap;
+
+	/**
+	 * @internal
+	 * Merges a single change into the pending batch.
+	 *
+	 * @param pending The pending batch of changes by path.
+	 * @param path The changed path.
+	 * @param changes The ChangeType values OR'd together.
+	 * @param isDirectory Whether the path is a directory.
+	 */
+	static void coalesceChange(std::map<String, FileChange>& pending, const String& path, unsigned int changes, bool isDirectory);
+
+	/**
+	 * @internal
+	 * Hands a batch of changes to the callback, the queue and the NotificationCenter.
+	 *
+	 * @param changes The batch of changes.
+	 */
+	void deliverChanges(const FileChangeList& changes);
+
+	/**
+	 * @internal
+	 * Adds a watch for the path, and for every directory below it when recursive.
+	 *
+	 * The directories are found with a serial walk on the calling thread. Each directory
+	 * is watched before it is listed, so anything created inside it afterwards raises an
+	 * event and anything created before shows up in the listing.
+	 *
+	 * @param path The path to watch.
+	 * @param rootPath The path that was originally added.
+	 * @param recursive Whether every directory below the path is watched as well.
+	 * @param created The pending batch every object found below the path is added to as
+	 *        created, or NULL when the existing contents are not reported.
+	 * @return True if the path itself is being watched, false otherwise.
+	 */
+	bool addWatches(const String& path, const String& rootPath, bool recursive, std::map<String, FileChange>* created);
+
+	/**
+	 * @internal
+	 * Initializes the platform specific watching resources.
+	 */
+	void initialize();
+
+	/**
+	 * @internal
+	 * Releases the platform specific watching resources.
+	 */
+	void cleanup();
+
+	/**
+	 * @internal
+	 * The main loop of the watcher thread.
+	 */
+	void run();
+
+	// Instance member variables
+	WatchMap							_watches;				/**< @internal The watched paths by watch descriptor. */
+	unsigned int						_coalescingInterval;	/**< @internal The coalescing interval in milliseconds. */
+	ChangeCallback						_callback;				/**< @internal The callback receiving each batch of changes. */
+	DeliveryMode						_deliveryMode;			/**< @internal Which thread the callback is called on. */
+	String								_notificationName;		/**< @internal The notification posted with each batch of changes. */
+	std::deque<FileChangeList>			_queuedChanges;			/**< @internal The batches waiting for processChanges(). */
+	boost::mutex						_mutex;					/**< @internal Guards all the member variables. */
+	boost::condition_variable			_changesQueued;			/**< @internal Signalled when a batch is queued. */
+	boost::scoped_ptr<boost::thread>	_thread;				/**< @internal The watcher thread. */
+	int									_descriptor;			/**< @internal The platform watching descriptor. */
+	int									_wakeDescriptors[2];	/**< @internal A pipe used to wake the watcher thread when stopping. */
+
+private:
+
+	/**
+	 * @internal
+	 * Copy constructor.
+	 *
+	 * No-op since the watcher thread cannot be copied.
+	 */
+	FileWatcher(const FileWatcher& fileWatcher);
+
+	/**
+	 * @internal
+	 * Overloaded assignment operator.
+	 *
+	 * No-op since the watcher thread cannot be copied.
+	 */
+	void operator=(const FileWatcher& fileWatcher);
+};
+
+}	// End of bump namespace
+
+#endif	// End of BUMP_FILE_WATCHER_H
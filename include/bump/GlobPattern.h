@@ -0,0 +1,211 @@
+//
+//  GlobPattern.h
+//  Bump
+//
+//  Created by Joseph Holub on 10/18/26.
+//  Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+#ifndef BUMP_GLOB_PATTERN_H
+#define BUMP_GLOB_PATTERN_H
+
+// Bump headers
+#include <bump/Export.h>
+#include <bump/String.h>
+#include <bump/StringView.h>
+
+// C++ headers
+#include <bitset>
+#include <vector>
+
+namespace bump {
+
+/**
+ * A glob pattern compiled once so it can be matched against many names quickly.
+ *
+ * The pattern is split on '/' into components, and each component is parsed into a
+ * short list of literal runs and wildcards up front. Matching a name then never
+ * re-parses the pattern, never allocates and never touches the file system, so a
+ * directory listing can be filtered on the raw names alone.
+ *
+ * The supported syntax is:
+ *   - '*' matches any run of characters within a single component
+ *   - '?' matches any single character
+ *   - '[abc]', '[a-z]' and '[!a-z]' (or '[^a-z]') match one character from, or not from, the set
+ *   - '**' as a whole component matches zero or more directories
+ *   - '\' matches the next character literally
+ *   - A trailing '/' restricts the matches to directories
+ *
+ * Wildcards never match '/', but unlike a shell they do match a leading '.'.
+ *
+ * @code
+ *   bump::GlobPattern pattern("src/bump/[A-F]*.cpp");
+ *   pattern.matches("src/bump/FileSystem.cpp");   // true
+ *   pattern.matches("src/bump/String.cpp");       // false
+ *   pattern.matches("src/FileSystem.cpp");        // false
+ * @endcode
+ */
+class BUMP_EXPORT GlobPattern
+{
+public:
+
+	/**
+	 * Default constructor creating an empty pattern that only matches an empty path.
+	 */
+	GlobPattern();
+
+	/**
+	 * Constructor compiling the pattern.
+	 *
+	 * A '[' without a closing ']' is matched literally.
+	 *
+	 * @param pattern The glob pattern to compile.
+	 */
+	GlobPattern(const String& pattern);
+
+	/**
+	 * Returns the pattern that was compiled.
+	 *
+	 * @return The glob pattern.
+	 */
+	const String& pattern() const;
+
+	/**
+	 * Returns whether the pattern is empty.
+	 *
+	 * @return True if the pattern has no components, false otherwise.
+	 */
+	bool isEmpty() const;
+
+	/**
+	 * Returns whether the pattern starts at the root of the file system.
+	 *
+	 * @return True if the pattern starts with '/', false otherwise.
+	 */
+	bool isAbsolute() const;
+
+	/**
+	 * Returns whether the pattern ends with '/' and so only matches directories.
+	 *
+	 * @return True if only directories can match, false otherwise.
+	 */
+	bool matchesDirectoriesOnly() const;
+
+	/**
+	 * Returns the number of '/' separated components in the pattern.
+	 *
+	 * @return The number of components.
+	 */
+	unsigned int numberOfComponents() const;
+
+	/**
+	 * Returns whether the component contains no wildcards at all.
+	 *
+	 * @param component The index of the component.
+	 * @return True if the component only matches its own literal text, false otherwise.
+	 */
+	bool isLiteral(unsigned int component) const;
+
+	/**
+	 * Returns whether the component is '**' and matches zero or more directories.
+	 *
+	 * @param component The index of the component.
+	 * @return True if the component is recursive, false otherwise.
+	 */
+	bool isRecursive(unsigned int component) const;
+
+	/**
+	 * Returns the text a literal component matches, with any escapes removed.
+	 *
+	 * @param component The index of the component.
+	 * @return The literal text of the component.
+	 */
+	const String& literal(unsigned int component) const;
+
+	/**
+	 * Matches a single name against a single component of the pattern.
+	 *
+	 * @param component The index of the component.
+	 * @param name The name to match, which must not contain '/'.
+	 * @return True if the name matches the component, false otherwise.
+	 */
+	bool matches(unsigned int component, const StringView& name) const;
+
+	/**
+	 * Matches a whole path against the pattern, component by component.
+	 *
+	 * Repeated separators in the path are ignored. The types of the objects in the path
+	 * are never checked, so a trailing '/' in the pattern has no effect here.
+	 *
+	 * @param path The path to match.
+	 * @return True if the path matches the pattern, false otherwise.
+	 */
+	bool matches(const StringView& path) const;
+
+protected:
+
+	/**
+	 * @internal
+	 * A literal run or a wildcard within a component.
+	 */
+	struct Token
+	{
+		/**
+		 * @internal
+		 * Defines the kinds of tokens.
+		 */
+		enum Type
+		{
+			LITERAL,			/**< @internal Matches the text exactly. */
+			ANY_CHARACTER,		/**< @internal Matches any single character. */
+			ANY_STRING,			/**< @internal Matches any run of characters. */
+			CHARACTER_CLASS		/**< @internal Matches a single character in the set. */
+		};
+
+		Type					type;		/**< @internal The kind of token. */
+		std::string				text;		/**< @internal The text of a literal token. */
+		std::bitset<256>		characters;	/**< @internal The characters of a character class token. */
+	};
+
+	/**
+	 * @internal
+	 * A single '/' separated component of the pattern.
+	 */
+	struct Component
+	{
+		String					literal;	/**< @internal The unescaped text of a literal component. */
+		bool					isLiteral;	/**< @internal Whether the component has no wildcards. */
+		bool					isRecursive;	/**< @internal Whether the component is '**'. */
+		std::vector<Token>		tokens;		/**< @internal The tokens of a component with wildcards. */
+	};
+
+	/**
+	 * @internal
+	 * Parses one component of the pattern into its tokens.
+	 *
+	 * @param text The text of the component.
+	 * @return The compiled component.
+	 */
+	static Component compileComponent(const StringView& text);
+
+	/**
+	 * @internal
+	 * Matches the path components starting at the pattern component, trying every split for '**'.
+	 *
+	 * @param component The first pattern component left to match.
+	 * @param names The components of the path.
+	 * @param name The first path component left to match.
+	 * @return True if the rest of the path matches the rest of the pattern, false otherwise.
+	 */
+	bool matchesFrom(unsigned int component, const std::vector<StringView>& names, unsigned int name) const;
+
+	// Instance member variables
+	String						_pattern;					/**< @internal The pattern that was compiled. */
+	bool						_isAbsolute;				/**< @internal Whether the pattern starts with '/'. */
+	bool						_matchesDirectoriesOnly;	/**< @internal Whether the pattern ends with '/'. */
+	std::vector<Component>		_components;				/**< @internal The compiled components. */
+};
+
+}	// End of bump namespace
+
+#endif	// End of BUMP_GLOB_PATTERN_H
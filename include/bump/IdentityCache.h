@@ -0,0 +1,220 @@
+//
+//  IdentityCache.h
+//  Bump
+//
+//  Created by Joseph Holub on 10/18/26.
+//  Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+#ifndef BUMP_IDENTITY_CACHE_H
+#define BUMP_IDENTITY_CACHE_H
+
+// Boost headers
+#include <boost/chrono.hpp>
+#include <boost/thread/mutex.hpp>
+
+// Bump headers
+#include <bump/Export.h>
+#include <bump/String.h>
+
+// C++ headers
+#include <map>
+
+namespace bump {
+
+/**
+ * The IdentityCache is a thread-safe singleton that caches user and group names by id.
+ *
+ * Resolving an id to a name goes through the system user and group databases, which can
+ * mean reading /etc/passwd or asking a directory service on every call. When listing
+ * directories with thousands of files owned by a handful of users, the cache turns all
+ * but the first lookup of each id into a map lookup. The cache holds at most maximumSize()
+ * names per database, evicting the least recently used name when full. Names can also
+ * expire after timeToLive() seconds so renamed users and groups are eventually noticed.
+ *
+ * Ids that do not resolve to a name are cached as the id itself, the same way ls reports
+ * files owned by deleted users.
+ *
+ * @code
+ *   bump::String owner = bump::IdentityCache::instance()->userName(info.st_uid);
+ * @endcode
+ */
+class BUMP_EXPORT IdentityCache
+{
+public:
+
+	/**
+	 * Creates a thread-safe singleton instance of the IdentityCache object.
+	 *
+	 * @return The singleton instance.
+	 */
+	static IdentityCache* instance();
+
+	/**
+	 * Returns the name of the user with the given id.
+	 *
+	 * @todo Add support for Windows.
+	 *
+	 * @throw bump::NotImplementedError When running on Windows.
+	 *
+	 * @param userId The id of the user.
+	 * @return The name of the user, or the id as a string if no user has that id.
+	 */
+	String userName(unsigned int userId);
+
+	/**
+	 * Returns the name of the group with the given id.
+	 *
+	 * @todo Add support for Windows.
+	 *
+	 * @throw bump::NotImplementedError When running on Windows.
+	 *
+	 * @param groupId The id of the group.
+	 * @return The name of the group, or the id as a string if no group has that id.
+	 */
+	String groupName(unsigned int groupId);
+
+	/**
+	 * Sets the maximum number of names cached for users and for groups.
+	 *
+	 * Names beyond the new maximum are evicted immediately. Setting the maximum to 0
+	 * disables caching.
+	 *
+	 * @param maximumSize The maximum number of names cached for each database.
+	 */
+	void setMaximumSize(unsigned int maximumSize);
+
+	/**
+	 * Returns the maximum number of names cached for users and for groups.
+	 *
+	 * @return The maximum number of names cached for each database, 1024 by default.
+	 */
+	unsigned int maximumSize();
+
+	/**
+	 * Sets how long a cached name stays valid.
+	 *
+	 * @param seconds The number of seconds a name stays valid, 0 keeps names until they are evicted.
+	 */
+	void setTimeToLive(double seconds);
+
+	/**
+	 * Returns how long a cached name stays valid.
+	 *
+	 * @return The number of seconds a name stays valid, 0 by default.
+	 */
+	double timeToLive();
+
+	/**
+	 * Returns the number of cached user and group names.
+	 *
+	 * @return The number of cached names in both databases.
+	 */
+	unsigned int size();
+
+	/**
+	 * Removes all the cached names.
+	 */
+	void clear();
+
+protected:
+
+	/** The clock used to age cached names. */
+	typedef boost::chrono::steady_clock Clock;
+
+	/**
+	 * @internal
+	 * A cached name along with when it was loaded and last used.
+	 */
+	struct Entry
+	{
+		String				name;		/**< @internal The user or group name. */
+		Clock::time_point	loaded;		/**< @internal When the name was looked up. */
+		unsigned long long	lastUsed;	/**< @internal The lookup counter value when the name was last returned. */
+	};
+
+	/** A map of ids to their cached names. */
+	typedef std::map<unsigned int, Entry> EntryMap;
+
+	/**
+	 * @internal
+	 * Destructor.
+	 */
+	~IdentityCache();
+
+	/**
+	 * @internal
+	 * Returns the cached name for the id, looking it up and caching it when needed.
+	 *
+	 * @param entries The cache for the database the id belongs to.
+	 * @param id The user or group id.
+	 * @param isUser Whether the id is a user id rather than a group id.
+	 * @return The name for the id.
+	 */
+	String cachedName(EntryMap& entries, unsigned int id, bool isUser);
+
+	/**
+	 * @internal
+	 * Evicts the least recently used names until the cache fits in the maximum size.
+	 *
+	 * @param entries The cache to shrink.
+	 * @param maximumSize The number of names the cache may hold.
+	 */
+	void evict(EntryMap& entries, unsigned int maximumSize);
+
+	/**
+	 * @internal
+	 * Looks up the name of the user in the system user database.
+	 *
+	 * @param userId The id of the user.
+	 * @param name The name of the user if one was found.
+	 * @return True if a user has that id, false otherwise.
+	 */
+	static bool lookupUserName(unsigned int userId, String& name);
+
+	/**
+	 * @internal
+	 * Looks up the name of the group in the system group database.
+	 *
+	 * @param groupId The id of the group.
+	 * @param name The name of the group if one was found.
+	 * @return True if a group has that id, false otherwise.
+	 */
+	static bool lookupGroupName(unsigned int groupId, String& name);
+
+	// Instance member variables
+	EntryMap				_users;			/**< @internal The cached user names. */
+	EntryMap				_groups;		/**< @internal The cached group names. */
+	unsigned int			_maximumSize;	/**< @internal The maximum number of names cached for each database. */
+	double					_timeToLive;	/**< @internal The number of seconds a name stays valid, 0 for forever. */
+	unsigned long long		_lookups;		/**< @internal Counts the lookups to order the names by recent use. */
+	boost::mutex			_mutex;			/**< @internal Guards all the member variables. */
+
+private:
+
+	/**
+	 * @internal
+	 * Constructor.
+	 */
+	IdentityCache();
+
+	/**
+	 * @internal
+	 * Copy constructor.
+	 *
+	 * No-op to support the singleton.
+	 */
+	IdentityCache(const IdentityCache& identityCache);
+
+	/**
+	 * @internal
+	 * Overloaded assignment operator.
+	 *
+	 * No-op to support the singleton.
+	 */
+	void operator=(const IdentityCache& identityCache);
+};
+
+}	// End of bump namespace
+
+#endif	// End of BUMP_IDENTITY_CACHE_H
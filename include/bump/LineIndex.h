@@ -0,0 +1,247 @@
+//
+//  LineIndex.h
+//  Bump
+//
+//  Created by Joseph Holub on 10/18/26.
+//  Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+#ifndef BUMP_LINE_INDEX_H
+#define BUMP_LINE_INDEX_H
+
+// Bump headers
+#include <bump/Export.h>
+#include <bump/MappedFile.h>
+#include <bump/String.h>
+
+// C++ headers
+#include <ctime>
+#include <vector>
+
+namespace bump {
+
+/**
+ * A sparse index of the byte offsets of the lines in a text file.
+ *
+ * Reading a range of lines from a text file normally means reading every line before
+ * it, so paging through a large file costs more and more with every page. A LineIndex
+ * records the byte offset of every Nth line in a single pass over the mapped file, which
+ * counts newlines a vector register at a time and only searches the blocks holding an
+ * indexed line. Any line can then be reached with one seek and at most N - 1 skipped
+ * lines.
+ *
+ * Lines are counted the same way as the TextFileReader counts them, so every newline
+ * ends a line and whatever follows the last newline is the final line, even when empty.
+ *
+ * The index remembers the size, the modification time down to the nanosecond and the
+ * device and inode of the file it was built from, so it can be kept in memory or saved to
+ * a sidecar file next to the text file and reused for as long as the file has not changed.
+ * A file rewritten to the same size within the same second is still noticed on file
+ * systems that keep sub-second times, and a file replaced by a rename is always noticed.
+ *
+ * When a method fails it returns false and leaves errno set to the reason.
+ *
+ * @code
+ *   bump::LineIndex index;
+ *   if (index.update("access.log", bump::LineIndex::sidecarPath("access.log")))
+ *   {
+ *       bump::StringList page = bump::TextFileReader::fileContents("access.log", 500000, 50, index);
+ *   }
+ * @endcode
+ */
+class BUMP_EXPORT LineIndex
+{
+public:
+
+	/**
+	 * Defines the default number of lines between indexed lines.
+	 */
+	static const unsigned int DEFAULT_INTERVAL;
+
+	/**
+	 * Default constructor creating an empty index.
+	 */
+	LineIndex();
+
+	/**
+	 * Builds the index of the file at the path.
+	 *
+	 * @param path The path of the text file to index.
+	 * @param interval The number of lines between indexed lines.
+	 * @return True if the index was built, false otherwise.
+	 */
+	bool build(const String& path, unsigned int interval = DEFAULT_INTERVAL);
+
+	/**
+	 * Builds the index of an open mapped file.
+	 *
+	 * The size and modification time are read from the mapped file's path.
+	 *
+	 * @param file The open mapped text file to index.
+	 * @param interval The number of lines between indexed lines.
+	 * @return True if the index was built, false otherwise.
+	 */
+	bool build(const MappedFile& file, unsigned int interval = DEFAULT_INTERVAL);
+
+	/**
+	 * Makes sure the index matches the file at the path, reusing what it can.
+	 *
+	 * An index already built for the unchanged file is kept as is. Otherwise a sidecar
+	 * saved for the unchanged file is loaded, and only when neither matches is the file
+	 * indexed again and the sidecar rewritten. Failing to write the sidecar does not fail
+	 * the update since the index itself is still usable.
+	 *
+	 * @param path The path of the text file to index.
+	 * @param sidecarPath The path of the sidecar file, or an empty path to only keep the index in memory.
+	 * @param interval The number of lines between indexed lines.
+	 * @return True if the index matches the file, false otherwise.
+	 */
+	bool update(const String& path, const String& sidecarPath, unsigned int interval = DEFAULT_INTERVAL);
+
+	/**
+	 * Loads an index saved by save().
+	 *
+	 * A sidecar written by a different version of the format is refused with EINVAL.
+	 *
+	 * @param sidecarPath The path of the sidecar file.
+	 * @return True if the index was loaded, false otherwise.
+	 */
+	bool load(const String& sidecarPath);
+
+	/**
+	 * Saves the index so it can be loaded again without indexing the file.
+	 *
+	 * The sidecar is written atomically so a reader never loads half of it. It is stored
+	 * in the byte order of the machine since it is only a cache.
+	 *
+	 * @param sidecarPath The path of the sidecar file.
+	 * @return True if the index was saved, false otherwise.
+	 */
+	bool save(const String& sidecarPath) const;
+
+	/**
+	 * Empties the index.
+	 */
+	void clear();
+
+	/**
+	 * Returns whether the index holds no lines.
+	 *
+	 * @return True if nothing has been indexed, false otherwise.
+	 */
+	bool isEmpty() const;
+
+	/**
+	 * Returns whether the index was built for the file at the path as it is now.
+	 *
+	 * @param path The path of the text file.
+	 * @return True if the path, size, modification time, device and inode all match, false otherwise.
+	 */
+	bool isCurrent(const String& path) const;
+
+	/**
+	 * Returns the path of the file that was indexed.
+	 *
+	 * @return The path of the indexed file.
+	 */
+	const String& path() const;
+
+	/**
+	 * Returns the number of lines between indexed lines.
+	 *
+	 * @return The index interval.
+	 */
+	unsigned int interval() const;
+
+	/**
+	 * Returns the number of lines in the indexed file.
+	 *
+	 * @return The number of lines, 0 if the index is empty.
+	 */
+	unsigned long long numberOfLines() const;
+
+	/**
+	 * Returns the size of the indexed file when it was indexed.
+	 *
+	 * @return The size of the file in bytes.
+	 */
+	unsigned long long fileSize() const;
+
+	/**
+	 * Returns the modification time of the indexed file when it was indexed.
+	 *
+	 * @return The modification time of the file.
+	 */
+	std::time_t modifiedDate() const;
+
+	/**
+	 * Finds the closest indexed line at or before a line.
+	 *
+	 * @param line The line to find, starting at 1.
+	 * @param indexedLine Set to the closest indexed line at or before the line.
+	 * @param offset Set to the byte offset of the indexed line.
+	 * @return True if the line is in the file, false otherwise.
+	 */
+	bool locate(unsigned long long line, unsigned long long& indexedLine, unsigned long long& offset) const;
+
+	/**
+	 * Returns the default sidecar path for a text file.
+	 *
+	 * @code
+	 *   bump::LineIndex::sidecarPath("logs/access.log"); // returns "logs/access.log.lineindex"
+	 * @endcode
+	 *
+	 * @param path The path of the text file.
+	 * @return The path of its sidecar file.
+	 */
+	static String sidecarPath(const String& path);
+
+protected:
+
+	/**
+	 * @internal
+	 * Indexes the contents of the file in one pass.
+	 *
+	 * @param contents The contents of the file.
+	 * @param interval The number of lines between indexed lines.
+	 */
+	void indexContents(const StringView& contents, unsigned int interval);
+
+	/**
+	 * @internal
+	 * The state of a file that tells whether it changed since it was indexed.
+	 */
+	struct FileState
+	{
+		unsigned long long	size;					/**< The size of the file in bytes. */
+		std::time_t			modifiedDate;			/**< The modification time of the file. */
+		unsigned int		modifiedNanoseconds;	/**< The sub-second part of the modification time, 0 where unavailable. */
+		unsigned long long	device;					/**< The device holding the file, 0 where unavailable. */
+		unsigned long long	inode;					/**< The inode of the file, 0 where unavailable. */
+	};
+
+	/**
+	 * @internal
+	 * Reads the state of the file.
+	 *
+	 * @param path The path of the text file.
+	 * @param state Set to the state of the file.
+	 * @return True if the state was read, false otherwise.
+	 */
+	static bool fileState(const String& path, FileState& state);
+
+	// Instance member variables
+	String									_path;					/**< @internal The path of the indexed file. */
+	unsigned int							_interval;				/**< @internal The number of lines between indexed lines. */
+	unsigned long long						_numberOfLines;			/**< @internal The number of lines in the file. */
+	unsigned long long						_fileSize;				/**< @internal The size of the file when indexed. */
+	std::time_t								_modifiedDate;			/**< @internal The modification time of the file when indexed. */
+	unsigned int							_modifiedNanoseconds;	/**< @internal The sub-second part of the modification time when indexed. */
+	unsigned long long						_device;				/**< @internal The device holding the file when indexed. */
+	unsigned long long						_inode;					/**< @internal The inode of the file when indexed. */
+	std::vector<unsigned long long>			_offsets;				/**< @internal The byte offsets of lines 1, 1 + interval, 1 + 2 * interval and so on. */
+};
+
+}	// End of bump namespace
+
+#endif	// End of BUMP_LINE_INDEX_H
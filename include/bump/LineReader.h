@@ -0,0 +1,235 @@
+//
+//  LineReader.h
+//  Bump
+//
+//  Created by Joseph Holub on 10/18/26.
+//  Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+#ifndef BUMP_LINE_READER_H
+#define BUMP_LINE_READER_H
+
+// Bump headers
+#include <bump/Export.h>
+#include <bump/String.h>
+#include <bump/StringView.h>
+
+// C++ headers
+#include <vector>
+
+namespace bump {
+
+// Forward declarations
+class DecompressingReader;
+class FileWatcher;
+
+/**
+ * Streams the lines of a text file of any size through a single reusable buffer.
+ *
+ * The file is read in large chunks and each line is handed out as a StringView pointing
+ * into the buffer, so reading a line never allocates or copies. Only one chunk is in
+ * memory at a time, so files far larger than memory can be processed line by line. The
+ * buffer only grows when a single line does not fit in it.
+ *
+ * Lines end at '\n', and a '\r' right before it is dropped so CRLF files read the same
+ * as LF files. A final line without a newline is still returned, but a file ending in a
+ * newline does not produce an extra empty line.
+ *
+ * Lines appended to the file while it is open can be waited for with followLine(), which
+ * works like tail -f.
+ *
+ * Files compressed with gzip or zstd are recognized by their magic bytes and read through
+ * a DecompressingReader, so the next chunk is decompressed on a background thread while
+ * the lines of the last one are being handed out. Line offsets then count decompressed
+ * bytes, and a compressed file is only followed up to where it ended when it was opened.
+ *
+ * When reading fails, readLine() returns false and errorCode() holds the errno value.
+ *
+ * @code
+ *   bump::LineReader reader;
+ *   if (reader.open("access.log"))
+ *   {
+ *       bump::StringView line;
+ *       while (reader.readLine(line))
+ *       {
+ *           if (line.startsWith("ERROR"))
+ *           {
+ *               std::cout << reader.lineNumber() << ": " << line << std::endl;
+ *           }
+ *       }
+ *   }
+ * @endcode
+ */
+class BUMP_EXPORT LineReader
+{
+public:
+
+	/**
+	 * Constructor.
+	 *
+	 * @param bufferSize The number of bytes read from the file at a time.
+	 */
+	LineReader(unsigned int bufferSize = 1048576);
+
+	/**
+	 * Destructor closing the file.
+	 */
+	~LineReader();
+
+	/**
+	 * Opens the file, closing any file that was already open.
+	 *
+	 * @param path The path of the text file to read.
+	 * @return True if the file was opened, false otherwise with errno set.
+	 */
+	bool open(const String& path);
+
+	/**
+	 * Closes the file and invalidates the last line returned.
+	 */
+	void close();
+
+	/**
+	 * Returns the next line of the file without its line ending.
+	 *
+	 * The view points into the reader's buffer and is only valid until the next call
+	 * to readLine() or close().
+	 *
+	 * @param line Set to the next line when one is read.
+	 * @return True if a line was read, false at the end of the file or if reading failed.
+	 */
+	bool readLine(StringView& line);
+
+	/**
+	 * Returns the next complete line of the file, waiting for it to be written if necessary.
+	 *
+	 * Lines already in the file are returned straight away. At the end of the file the
+	 * reader waits for the file to change, through a FileWatcher where inotify is available
+	 * and by polling otherwise. A last line without a newline is held back until its
+	 * newline is written. If the file is truncated, reading starts over from the beginning.
+	 *
+	 * The view is only valid until the next call to readLine(), followLine() or close().
+	 *
+	 * @param line Set to the next line when one is read.
+	 * @param timeoutMilliseconds How long to wait for a line, 0 only checks the file once.
+	 * @return True if a line was read, false if none was written in time or reading failed.
+	 */
+	bool followLine(StringView& line, unsigned int timeoutMilliseconds);
+
+	/**
+	 * Returns whether a file is open.
+	 *
+	 * @return True if the reader is open, false otherwise.
+	 */
+	bool isOpen() const;
+
+	/**
+	 * Returns whether every line of the file has been returned.
+	 *
+	 * @return True if the end of the file was reached, false otherwise.
+	 */
+	bool isAtEnd() const;
+
+	/**
+	 * Returns the path of the file being read.
+	 *
+	 * @return The path of the file.
+	 */
+	const String& path() const;
+
+	/**
+	 * Returns the number of the last line returned, counting from 1.
+	 *
+	 * @return The line number, 0 if no line has been returned yet.
+	 */
+	unsigned long long lineNumber() const;
+
+	/**
+	 * Returns the byte offset in the file of the first character of the last line returned.
+	 *
+	 * @return The byte offset of the line.
+	 */
+	unsigned long long lineOffset() const;
+
+	/**
+	 * Returns the errno value of the failure that stopped the reader.
+	 *
+	 * @return The errno value, 0 if nothing failed.
+	 */
+	int errorCode() const;
+
+protected:
+
+	/**
+	 * @internal
+	 * Reads more of the file into the free space at the end of the buffer.
+	 *
+	 * @return The number of bytes read, 0 at the end of the file, or -1 if reading failed.
+	 */
+	long readChunk();
+
+	/**
+	 * @internal
+	 * Returns the next line in the buffer, reading more of the file as needed.
+	 *
+	 * @param line Set to the next line when one is read.
+	 * @param holdPartialLine Whether a last line without a newline is left for later.
+	 * @return True if a line was read, false otherwise.
+	 */
+	bool nextLine(StringView& line, bool holdPartialLine);
+
+	/**
+	 * @internal
+	 * Starts reading the file over from the beginning if it has shrunk below what was read.
+	 *
+	 * @return True if the file was truncated, false otherwise.
+	 */
+	bool restartIfTruncated();
+
+	/**
+	 * @internal
+	 * Waits for the file to change or for the timeout to pass.
+	 *
+	 * @param timeoutMilliseconds The longest time to wait.
+	 */
+	void waitForChanges(unsigned int timeoutMilliseconds);
+
+	// Instance member variables
+	String					_path;				/**< @internal The path of the file. */
+	std::vector<char>		_buffer;			/**< @internal The chunk of the file being split, allocated on first use. */
+	unsigned int			_bufferSize;		/**< @internal The initial capacity of the buffer. */
+	std::size_t				_lineStart;			/**< @internal The buffer position where the next line starts. */
+	std::size_t				_scanStart;			/**< @internal The buffer position to keep looking for a newline from. */
+	std::size_t				_dataEnd;			/**< @internal The buffer position where the data read so far ends. */
+	unsigned long long		_bufferOffset;		/**< @internal The file offset of the start of the buffer. */
+	unsigned long long		_lineNumber;		/**< @internal The number of the last line returned. */
+	unsigned long long		_lineOffset;		/**< @internal The file offset of the last line returned. */
+	bool					_isEndOfFile;		/**< @internal Whether the whole file has been read into the buffer. */
+	int						_descriptor;		/**< @internal The platform descriptor of the file. */
+	int						_errorCode;			/**< @internal The errno value of the failure that stopped the reader. */
+	DecompressingReader*	_decompressor;		/**< @internal Decompresses the file when it is compressed, NULL otherwise. */
+	FileWatcher*			_watcher;			/**< @internal Reports changes to the followed file, created on first use. */
+	bool					_isWatcherFailed;	/**< @internal Whether the file could not be watched, so it is polled instead. */
+
+private:
+
+	/**
+	 * @internal
+	 * Copy constructor.
+	 *
+	 * No-op since the file descriptor cannot be shared.
+	 */
+	LineReader(const LineReader& lineReader);
+
+	/**
+	 * @internal
+	 * Overloaded assignment operator.
+	 *
+	 * No-op since the file descriptor cannot be shared.
+	 */
+	void operator=(const LineReader& lineReader);
+};
+
+}	// End of bump namespace
+
+#endif	// End of BUMP_LINE_READER_H
@@ -0,0 +1,213 @@
+//
+//  MappedFile.h
+//  Bump
+//
+//  Created by Joseph Holub on 10/18/26.
+//  Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+#ifndef BUMP_MAPPED_FILE_H
+#define BUMP_MAPPED_FILE_H
+
+// Bump headers
+#include <bump/Export.h>
+#include <bump/String.h>
+#include <bump/StringView.h>
+
+// C++ headers
+#include <cstddef>
+#include <vector>
+
+namespace bump {
+
+/**
+ * A view of the contents of a file mapped straight into memory.
+ *
+ * Reading a file through a stream copies every byte from the page cache into the
+ * stream buffer and then again into the caller's strings. A MappedFile maps the
+ * file's pages into the address space instead, so the contents can be searched,
+ * hashed or written somewhere else without being copied at all. The contents are
+ * exposed as a StringView that stays valid until the file is closed.
+ *
+ * Empty files open successfully with an empty view since they cannot be mapped.
+ * Files that are not regular files, such as pipes and devices, cannot be mapped
+ * either, so read-only opens fall back to reading their contents into memory.
+ *
+ * When a method fails it returns false and leaves errno set to the reason.
+ *
+ * @code
+ *   bump::MappedFile file;
+ *   if (file.open("access.log"))
+ *   {
+ *       file.advise(bump::MappedFile::SEQUENTIAL_ACCESS);
+ *       bump::StringView contents = file.view();
+ *       std::size_t first_line_length = contents.indexOf('\n');
+ *   }
+ * @endcode
+ */
+class BUMP_EXPORT MappedFile
+{
+public:
+
+	/**
+	 * Defines how the file is mapped.
+	 */
+	enum Mode
+	{
+		READ_ONLY,		/**< The contents can only be read. */
+		READ_WRITE		/**< Changes to the contents are written back to the file. */
+	};
+
+	/**
+	 * Defines the hints that can be given to the kernel about how the contents will be used.
+	 */
+	enum Advice
+	{
+		NORMAL_ACCESS,		/**< No particular access pattern, the default read ahead is used. */
+		SEQUENTIAL_ACCESS,	/**< The contents are read from front to back, so read ahead aggressively. */
+		RANDOM_ACCESS,		/**< The contents are read in no particular order, so do not read ahead. */
+		WILL_NEED,			/**< The contents will be needed soon, so start reading them in now. */
+		HUGE_PAGES			/**< Back the mapping with huge pages where the platform supports it. */
+	};
+
+	/**
+	 * Default constructor creating a file that is not open.
+	 */
+	MappedFile();
+
+	/**
+	 * Destructor closing the file.
+	 */
+	~MappedFile();
+
+	/**
+	 * Maps the file at the path, closing any file that was already open.
+	 *
+	 * @param path The path of the file to map.
+	 * @param mode Whether the contents can be changed.
+	 * @return True if the file was opened, false otherwise.
+	 */
+	bool open(const String& path, Mode mode = READ_ONLY);
+
+	/**
+	 * Unmaps the file if it is open, invalidating every view of its contents.
+	 */
+	void close();
+
+	/**
+	 * Returns whether the file is open.
+	 *
+	 * @return True if the file is open, false otherwise.
+	 */
+	bool isOpen() const;
+
+	/**
+	 * Returns whether the contents are mapped rather than read into memory.
+	 *
+	 * @return True if the contents are mapped, false if they were read or the file is empty.
+	 */
+	bool isMapped() const;
+
+	/**
+	 * Returns the path the file was opened with.
+	 *
+	 * @return The path of the file.
+	 */
+	const String& path() const;
+
+	/**
+	 * Returns how the file was mapped.
+	 *
+	 * @return The mode of the file.
+	 */
+	Mode mode() const;
+
+	/**
+	 * Returns the first byte of the contents.
+	 *
+	 * @return The contents, NULL if the file is not open or empty.
+	 */
+	const char* data() const;
+
+	/**
+	 * Returns the first byte of the contents for changing them.
+	 *
+	 * @return The contents, NULL if the file was not opened for writing or is empty.
+	 */
+	char* writableData();
+
+	/**
+	 * Returns the size of the contents in bytes.
+	 *
+	 * @return The size of the contents.
+	 */
+	std::size_t size() const;
+
+	/**
+	 * Returns a view of the contents that is valid until the file is closed.
+	 *
+	 * @return A view of the contents.
+	 */
+	StringView view() const;
+
+	/**
+	 * Hints how the whole file will be used.
+	 *
+	 * @param advice The hint to give.
+	 * @return True if the hint was given or there is nothing mapped, false otherwise.
+	 */
+	bool advise(Advice advice) const;
+
+	/**
+	 * Hints how part of the file will be used.
+	 *
+	 * The range is widened to the pages it touches.
+	 *
+	 * @param advice The hint to give.
+	 * @param offset The first byte the hint applies to.
+	 * @param length The number of bytes the hint applies to.
+	 * @return True if the hint was given or there is nothing mapped, false otherwise.
+	 */
+	bool advise(Advice advice, std::size_t offset, std::size_t length) const;
+
+	/**
+	 * Writes the changed contents back to the file.
+	 *
+	 * @param wait Whether to wait for the contents to reach the disk before returning.
+	 * @return True if the contents were written back, false otherwise.
+	 */
+	bool synchronize(bool wait = true);
+
+protected:
+
+	// Instance member variables
+	String				_path;			/**< @internal The path the file was opened with. */
+	Mode				_mode;			/**< @internal How the file was mapped. */
+	bool				_isOpen;		/**< @internal Whether the file is open. */
+	bool				_isMapped;		/**< @internal Whether the contents are mapped. */
+	char*				_data;			/**< @internal The first byte of the contents. */
+	std::size_t			_size;			/**< @internal The size of the contents in bytes. */
+	std::vector<char>	_contents;		/**< @internal The contents of files that could not be mapped. */
+
+private:
+
+	/**
+	 * @internal
+	 * Copy constructor.
+	 *
+	 * No-op since the mapping cannot be shared.
+	 */
+	MappedFile(const MappedFile& mappedFile);
+
+	/**
+	 * @internal
+	 * Overloaded assignment operator.
+	 *
+	 * No-op since the mapping cannot be shared.
+	 */
+	void operator=(const MappedFile& mappedFile);
+};
+
+}	// End of bump namespace
+
+#endif	// End of BUMP_MAPPED_FILE_H
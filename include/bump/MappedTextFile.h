@@ -0,0 +1,220 @@
+//
+//  MappedTextFile.h
+//  Bump
+//
+//  Created by Joseph Holub on 10/18/26.
+//  Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+#ifndef BUMP_MAPPED_TEXT_FILE_H
+#define BUMP_MAPPED_TEXT_FILE_H
+
+// Bump headers
+#include <bump/Export.h>
+#include <bump/LineIndex.h>
+#include <bump/MappedFile.h>
+#include <bump/String.h>
+#include <bump/StringView.h>
+
+namespace bump {
+
+/**
+ * A text file kept mapped in memory that answers line queries with views.
+ *
+ * Every TextFileReader call opens the file again and copies each line through a
+ * stream buffer into a new String. A MappedTextFile maps the file once when it is
+ * opened and keeps the mapping until it is closed, so firstLine(), header(), footer()
+ * and fileContents() only find the line boundaries and hand back StringView objects
+ * pointing straight into the mapping. Pipes and devices cannot be mapped, so they are
+ * read into memory once instead through the same MappedFile fallback.
+ *
+ * Lines are split exactly as the TextFileReader splits them, so every newline ends a
+ * line, a '\r' before it is kept, and whatever follows the last newline is the final
+ * line, even when empty. Lines are counted starting at 1.
+ *
+ * Skipping to a line normally scans every line before it. Building a LineIndex with
+ * buildIndex() turns that into a jump to the closest indexed line.
+ *
+ * The returned views are only valid until the file is closed.
+ *
+ * @code
+ *   bump::MappedTextFile file;
+ *   if (file.open("access.log"))
+ *   {
+ *       bump::StringView first_line = file.firstLine();
+ *       bump::StringViewList last_lines = file.footer(10);
+ *   }
+ * @endcode
+ */
+class BUMP_EXPORT MappedTextFile
+{
+public:
+
+	/**
+	 * Default constructor creating a file that is not open.
+	 */
+	MappedTextFile();
+
+	/**
+	 * Maps the file at the path, closing any file that was already open.
+	 *
+	 * @param path The path of the text file.
+	 * @return True if the file was opened, false otherwise with errno set.
+	 */
+	bool open(const String& path);
+
+	/**
+	 * Unmaps the file and drops its index, invalidating every view of its lines.
+	 */
+	void close();
+
+	/**
+	 * Returns whether the file is open.
+	 *
+	 * @return True if the file is open, false otherwise.
+	 */
+	bool isOpen() const;
+
+	/**
+	 * Returns whether the contents are mapped rather than read into memory.
+	 *
+	 * @return True if the contents are mapped, false if they were read or the file is empty.
+	 */
+	bool isMapped() const;
+
+	/**
+	 * Returns the path the file was opened with.
+	 *
+	 * @return The path of the file.
+	 */
+	const String& path() const;
+
+	/**
+	 * Returns a view of the whole file.
+	 *
+	 * @return The contents of the file.
+	 */
+	StringView contents() const;
+
+	/**
+	 * Returns the number of lines in the file.
+	 *
+	 * The newlines are counted on every call unless an index has been built.
+	 *
+	 * @return The number of lines, 0 if the file is not open.
+	 */
+	unsigned long long numberOfLines() const;
+
+	/**
+	 * Returns the first line of the file.
+	 *
+	 * @return The first line, empty if the file is not open.
+	 */
+	StringView firstLine() const;
+
+	/**
+	 * Returns every line of the file.
+	 *
+	 * @return The lines of the file, empty if the file is not open.
+	 */
+	StringViewList fileContents() const;
+
+	/**
+	 * Returns numLines lines starting at beginningLine.
+	 *
+	 * Fewer lines are returned when the file ends first.
+	 *
+	 * @param beginningLine The line to start reading from.
+	 * @param numLines The number of lines to read, -1 for every line to the end of the file.
+	 * @return The requested lines, empty if beginningLine is not in the file.
+	 */
+	StringViewList fileContents(int beginningLine, int numLines) const;
+
+	/**
+	 * Returns every line from beginningLine to the end of the file.
+	 *
+	 * @param beginningLine The line to start reading from.
+	 * @return The requested lines, empty if beginningLine is not in the file.
+	 */
+	StringViewList fileContents(int beginningLine) const;
+
+	/**
+	 * Returns the first numLines lines of the file.
+	 *
+	 * @param numLines The number of lines making up the header.
+	 * @return The header lines, empty if numLines is less than 1.
+	 */
+	StringViewList header(int numLines) const;
+
+	/**
+	 * Returns the last numLines lines of the file.
+	 *
+	 * The file is scanned backwards from the end, so only the footer itself is touched.
+	 *
+	 * @param numLines The number of lines making up the footer.
+	 * @return The footer lines, empty if numLines is less than 1.
+	 */
+	StringViewList footer(int numLines) const;
+
+	/**
+	 * Builds a line index over the mapping so reading from any line skips at most interval lines.
+	 *
+	 * @param interval The number of lines between indexed lines.
+	 * @return True if the index was built, false otherwise with errno set.
+	 */
+	bool buildIndex(unsigned int interval = LineIndex::DEFAULT_INTERVAL);
+
+	/**
+	 * Returns the line index, which is empty until buildIndex() is called.
+	 *
+	 * @return The line index of the file.
+	 */
+	const LineIndex& index() const;
+
+protected:
+
+	/**
+	 * @internal
+	 * Finds the byte offset a line starts at.
+	 *
+	 * @param line The line to find, starting at 1.
+	 * @return The offset of the line, StringView::npos if the file has fewer lines.
+	 */
+	std::size_t lineOffset(int line) const;
+
+	/**
+	 * @internal
+	 * Appends the lines starting at an offset.
+	 *
+	 * @param offset The offset of the first line.
+	 * @param numLines The number of lines to append, -1 for every line to the end of the file.
+	 * @param lines The list the lines are appended to.
+	 */
+	void appendLines(std::size_t offset, int numLines, StringViewList& lines) const;
+
+	// Instance member variables
+	MappedFile		_file;		/**< @internal The mapped text file. */
+	LineIndex		_index;		/**< @internal The optional index of the lines in the mapping. */
+
+private:
+
+	/**
+	 * @internal
+	 * Copy constructor.
+	 *
+	 * No-op since the mapping cannot be shared.
+	 */
+	MappedTextFile(const MappedTextFile& mappedTextFile);
+
+	/**
+	 * @internal
+	 * Overloaded assignment operator.
+	 *
+	 * No-op since the mapping cannot be shared.
+	 */
+	void operator=(const MappedTextFile& mappedTextFile);
+};
+
+}	// End of bump namespace
+
+#endif	// End of BUMP_MAPPED_TEXT_FILE_H
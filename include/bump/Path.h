@@ -0,0 +1,334 @@
+//
+//  Path.h
+//  Bump
+//
+//  Created by Joseph Holub on 10/18/26.
+//  Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+#ifndef BUMP_PATH_H
+#define BUMP_PATH_H
+
+// Bump headers
+#include <bump/Export.h>
+#include <bump/String.h>
+#include <bump/StringView.h>
+
+// C++ headers
+#include <cstddef>
+#include <iostream>
+
+namespace bump {
+
+/**
+ * A file system path stored in a normalized form.
+ *
+ * Paths are normalized once when they are built: backslashes become forward slashes and
+ * runs of slashes are collapsed into one. A trailing slash is kept since it marks the path
+ * as a directory, but it is ignored when decomposing the path. Since the form is known,
+ * the decomposition methods return views into the path instead of allocating new strings,
+ * and the components can be iterated over without splitting the path.
+ *
+ * @code
+ *   bump::Path path("C:\\Program Files\\\\Visual Studio\\readme.txt");
+ *   path.toString();     // returns "C:/Program Files/Visual Studio/readme.txt"
+ *   path.filename();     // views "readme.txt"
+ *   path.extension();    // views "txt"
+ *   path.parent();       // views "C:/Program Files/Visual Studio"
+ *
+ *   for (bump::Path::ComponentIterator iter = path.begin(); iter != path.end(); ++iter)
+ *   {
+ *       std::cout << *iter << std::endl;
+ *   }
+ * @endcode
+ */
+class BUMP_EXPORT Path
+{
+public:
+
+	/**
+	 * Iterates over the components of a path, viewing each one in turn.
+	 *
+	 * The root slash of an absolute path is reported as its own "/" component.
+	 */
+	class BUMP_EXPORT ComponentIterator
+	{
+	public:
+
+		/**
+		 * Default constructor creating an iterator that is not attached to a path.
+		 */
+		ComponentIterator();
+
+		/**
+		 * Returns a view of the current component.
+		 *
+		 * @return A view of the current component.
+		 */
+		StringView operator*() const;
+
+		/**
+		 * Moves to the next component.
+		 *
+		 * @return This iterator.
+		 */
+		ComponentIterator& operator++();
+
+		/**
+		 * Returns whether both iterators point to the same component.
+		 *
+		 * @param other The iterator to compare against.
+		 * @return True if the iterators are equal, false otherwise.
+		 */
+		bool operator == (const ComponentIterator& other) const;
+
+		/**
+		 * Returns whether the iterators point to different components.
+		 *
+		 * @param other The iterator to compare against.
+		 * @return True if the iterators differ, false otherwise.
+		 */
+		bool operator != (const ComponentIterator& other) const;
+
+	protected:
+
+		// Allow the path to create attached iterators
+		friend class Path;
+
+		/**
+		 * @internal
+		 * Constructor pointing at the component starting at the position.
+		 *
+		 * @param path The normalized path being iterated over.
+		 * @param position The index of the first character of the component.
+		 */
+		ComponentIterator(const String* path, std::size_t position);
+
+		/**
+		 * @internal
+		 * Finds the length of the component starting at the current position.
+		 */
+		void findComponentLength();
+
+		// Instance member variables
+		const String*		_path;				/**< @internal The normalized path being iterated over. */
+		std::size_t			_position;			/**< @internal The index of the first character of the component. */
+		std::size_t			_componentLength;	/**< @internal The number of characters in the component. */
+	};
+
+	/**
+	 * Default constructor creating an empty path.
+	 */
+	Path();
+
+	/**
+	 * Constructor normalizing a c string.
+	 *
+	 * @param path The path to normalize.
+	 */
+	Path(const char* path);
+
+	/**
+	 * Constructor normalizing a string.
+	 *
+	 * @param path The path to normalize.
+	 */
+	Path(const String& path);
+
+	/**
+	 * Constructor normalizing a view.
+	 *
+	 * @param path The path to normalize.
+	 */
+	Path(const StringView& path);
+
+	/**
+	 * Joins all the components into a single path with one allocation.
+	 *
+	 * The total length is computed up front, then each non-empty component is normalized
+	 * straight into the result with a slash between it and the previous one. Empty
+	 * components are skipped.
+	 *
+	 * @code
+	 *   bump::StringView components[] = {"/opt", "local/", "\\sbin"};
+	 *   bump::Path::join(components, 3);   // returns "/opt/local/sbin"
+	 * @endcode
+	 *
+	 * @param components The components to join.
+	 * @param numberOfComponents The number of components.
+	 * @return The joined path.
+	 */
+	static Path join(const StringView* components, unsigned int numberOfComponents);
+
+	/**
+	 * Returns the normalized path.
+	 *
+	 * @return The normalized path.
+	 */
+	const String& toString() const;
+
+	/**
+	 * Returns the normalized path as a c string.
+	 *
+	 * @return The normalized path as a c string.
+	 */
+	const char* c_str() const;
+
+	/**
+	 * Returns whether the path is empty.
+	 *
+	 * @return True if the path is empty, false otherwise.
+	 */
+	bool isEmpty() const;
+
+	/**
+	 * Returns whether the path starts at a root slash or a drive letter.
+	 *
+	 * @return True if the path is absolute, false otherwise.
+	 */
+	bool isAbsolute() const;
+
+	/**
+	 * Returns whether the path is relative to the current path.
+	 *
+	 * @return True if the path is relative, false otherwise.
+	 */
+	bool isRelative() const;
+
+	/**
+	 * Returns a view of the last component of the path.
+	 *
+	 * @code
+	 *   bump::Path("/home/username/output.tar.gz").filename();   // views "output.tar.gz"
+	 *   bump::Path("/home/username/").filename();                // views "username"
+	 *   bump::Path("/").filename();                              // views ""
+	 * @endcode
+	 *
+	 * @return A view of the filename.
+	 */
+	StringView filename() const;
+
+	/**
+	 * Returns a view of the filename up to its first dot, ignoring a leading dot.
+	 *
+	 * @code
+	 *   bump::Path("output.tar.gz").basename();      // views "output"
+	 *   bump::Path(".hidden_file.txt").basename();   // views ".hidden_file"
+	 * @endcode
+	 *
+	 * @return A view of the basename.
+	 */
+	StringView basename() const;
+
+	/**
+	 * Returns a view of the filename after its last dot, ignoring a leading dot.
+	 *
+	 * @code
+	 *   bump::Path("output.tar.gz").extension();   // views "gz"
+	 *   bump::Path(".bashrc").extension();         // views ""
+	 * @endcode
+	 *
+	 * @return A view of the extension without the dot.
+	 */
+	StringView extension() const;
+
+	/**
+	 * Returns a view of the path without its last component.
+	 *
+	 * @code
+	 *   bump::Path("/home/username").parent();   // views "/home"
+	 *   bump::Path("/home").parent();            // views "/"
+	 *   bump::Path("home").parent();             // views ""
+	 * @endcode
+	 *
+	 * @return A view of the parent path.
+	 */
+	StringView parent() const;
+
+	/**
+	 * Returns the number of components in the path, counting the root slash of absolute paths.
+	 *
+	 * @return The number of components.
+	 */
+	unsigned int numberOfComponents() const;
+
+	/**
+	 * Returns an iterator pointing at the first component.
+	 *
+	 * @return An iterator pointing at the first component.
+	 */
+	ComponentIterator begin() const;
+
+	/**
+	 * Returns an iterator pointing past the last component.
+	 *
+	 * @return An iterator pointing past the last component.
+	 */
+	ComponentIterator end() const;
+
+	/**
+	 * Appends the component to the path, normalizing it in place.
+	 *
+	 * @param component The component to append.
+	 * @return This path.
+	 */
+	Path& operator /= (const StringView& component);
+
+	/**
+	 * Returns a copy of the path with the component appended.
+	 *
+	 * @param component The component to append.
+	 * @return The joined path.
+	 */
+	Path operator / (const StringView& component) const;
+
+	/**
+	 * Returns whether both normalized paths are the same.
+	 *
+	 * @param other The path to compare against.
+	 * @return True if the paths are equal, false otherwise.
+	 */
+	bool operator == (const Path& other) const;
+
+	/**
+	 * Returns whether the normalized paths differ.
+	 *
+	 * @param other The path to compare against.
+	 * @return True if the paths differ, false otherwise.
+	 */
+	bool operator != (const Path& other) const;
+
+	/**
+	 * Returns whether the path sorts before the other path.
+	 *
+	 * @param other The path to compare against.
+	 * @return True if the path sorts first, false otherwise.
+	 */
+	bool operator < (const Path& other) const;
+
+protected:
+
+	/**
+	 * @internal
+	 * Returns a view of the path without its trailing slash, unless the path is only a root.
+	 *
+	 * @return A view of the trimmed path.
+	 */
+	StringView trimmed() const;
+
+	// Instance member variables
+	String		_path;		/**< @internal The normalized path. */
+};
+
+/**
+ * Prints the normalized path to the stream.
+ *
+ * @param os The output stream.
+ * @param path The path to print.
+ * @return The output stream.
+ */
+BUMP_EXPORT std::ostream& operator << (std::ostream& os, const Path& path);
+
+}	// End of bump namespace
+
+#endif	// End of BUMP_PATH_H
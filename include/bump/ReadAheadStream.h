@@ -0,0 +1,205 @@
+//
+//  ReadAheadStream.h
+//  Bump
+//
+//  Created by Joseph Holub on 10/18/26.
+//  Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+#ifndef BUMP_READ_AHEAD_STREAM_H
+#define BUMP_READ_AHEAD_STREAM_H
+
+// Boost headers
+#include <boost/scoped_ptr.hpp>
+#include <boost/thread.hpp>
+
+// Bump headers
+#include <bump/Export.h>
+#include <bump/String.h>
+#include <bump/StringView.h>
+
+namespace bump {
+
+// Forward declarations
+class BufferQueue;
+
+/**
+ * Reads a file from front to back on a background thread, keeping a few large buffers
+ * filled ahead of the caller.
+ *
+ * Reading a file a block at a time on the thread that also processes it leaves the disk
+ * idle while the block is processed and the processing idle while the next block is read.
+ * The stream reads the following blocks while the caller works on the current one, and
+ * hands them over in file order. The reading thread stops once all the buffers are full
+ * and carries on as the caller finishes with them, so memory use stays at a few buffers
+ * however large the file is.
+ *
+ * The kernel is told the file is read sequentially, and each buffer asks it to start
+ * reading the next one in before it is needed.
+ *
+ * The stream can open a file itself, or read from a descriptor the caller already has
+ * open, starting anywhere in the file. The position of the descriptor is left alone.
+ *
+ * @code
+ *   bump::ReadAheadStream stream;
+ *   if (stream.open("measurements.bin"))
+ *   {
+ *       bump::StringView buffer;
+ *       while (stream.nextBuffer(buffer) > 0)
+ *       {
+ *           process(buffer);
+ *       }
+ *   }
+ * @endcode
+ */
+class BUMP_EXPORT ReadAheadStream
+{
+public:
+
+	/**
+	 * Constructor.
+	 *
+	 * @param bufferSize The number of bytes read into each buffer.
+	 * @param numberOfBuffers The number of buffers filled ahead of the caller.
+	 */
+	ReadAheadStream(unsigned int bufferSize = 1048576, unsigned int numberOfBuffers = 4);
+
+	/**
+	 * Destructor stopping the reading thread and closing the file.
+	 */
+	~ReadAheadStream();
+
+	/**
+	 * Opens the file at the path and starts reading it, closing any file that was already open.
+	 *
+	 * @param path The path of the file.
+	 * @param offset The offset in the file to start reading from.
+	 * @return True if the file was opened, false otherwise with errno set.
+	 */
+	bool open(const String& path, unsigned long long offset = 0);
+
+	/**
+	 * Starts reading from a descriptor that is already open, closing any file that was already open.
+	 *
+	 * The descriptor still belongs to the caller and has to stay open until the stream is closed.
+	 *
+	 * @param descriptor The open file descriptor.
+	 * @param offset The offset in the file to start reading from.
+	 * @return True if reading started, false otherwise with errno set.
+	 */
+	bool open(int descriptor, unsigned long long offset = 0);
+
+	/**
+	 * Stops reading and closes the file if the stream opened it.
+	 */
+	void close();
+
+	/**
+	 * Returns whether a file is open.
+	 *
+	 * @return True if a file is open, false otherwise.
+	 */
+	bool isOpen() const;
+
+	/**
+	 * Returns the offset in the file of the next byte to be handed over.
+	 *
+	 * @return The offset of the next byte.
+	 */
+	unsigned long long offset() const;
+
+	/**
+	 * Hands over the next bytes of the file without copying them, waiting for them to be read if necessary.
+	 *
+	 * The bytes stay valid until the next call to nextBuffer(), read() or close(). Everything
+	 * read before a failure is still handed over before the failure is reported.
+	 *
+	 * @param buffer Set to view the next bytes of the file.
+	 * @param maximumLength The most bytes to hand over, the rest of the buffer comes next.
+	 * @return The number of bytes handed over, 0 at the end of the file, or -1 with errno set.
+	 */
+	long nextBuffer(StringView& buffer, std::size_t maximumLength = StringView::npos);
+
+	/**
+	 * Copies the next bytes of the file into the buffer, waiting for them to be read if necessary.
+	 *
+	 * @param buffer The buffer to copy the bytes into.
+	 * @param size The size of the buffer.
+	 * @return The number of bytes copied, 0 at the end of the file, or -1 with errno set.
+	 */
+	long read(char* buffer, std::size_t size);
+
+protected:
+
+	/**
+	 * @internal
+	 * Starts the reading thread at the offset.
+	 *
+	 * @param offset The offset in the file to start reading from.
+	 */
+	void start(unsigned long long offset);
+
+	/**
+	 * @internal
+	 * Reads the file until the end or a failure, queueing the buffers as they fill up.
+	 */
+	void run();
+
+	/**
+	 * @internal
+	 * Reads from the file at the offset, retrying interrupted reads.
+	 *
+	 * @param buffer The buffer to read into.
+	 * @param size The number of bytes to read.
+	 * @param offset The offset in the file to read from.
+	 * @return The number of bytes read, 0 at the end of the file, or -1 with errno set.
+	 */
+	long readAt(char* buffer, std::size_t size, unsigned long long offset);
+
+	/**
+	 * @internal
+	 * Asks the kernel to start reading a range of the file that will be needed soon.
+	 *
+	 * @param offset The offset of the range.
+	 * @param length The length of the range.
+	 */
+	void adviseWillNeed(unsigned long long offset, std::size_t length);
+
+	/**
+	 * @internal
+	 * Closes the descriptor if the stream opened it.
+	 */
+	void closeDescriptor();
+
+	// Instance member variables
+	unsigned int						_bufferSize;		/**< @internal The number of bytes read into each buffer. */
+	unsigned int						_numberOfBuffers;	/**< @internal The most buffers queued at once. */
+	int									_descriptor;		/**< @internal The file being read, -1 if none is open. */
+	bool								_ownsDescriptor;	/**< @internal Whether the stream opened the descriptor and closes it. */
+	unsigned long long					_startOffset;		/**< @internal The offset the reading thread started from. */
+	unsigned long long					_offset;			/**< @internal The offset of the next byte handed to the caller. */
+	boost::scoped_ptr<BufferQueue>		_queue;				/**< @internal The buffers read ahead of the caller. */
+	boost::scoped_ptr<boost::thread>	_thread;			/**< @internal The reading thread. */
+
+private:
+
+	/**
+	 * @internal
+	 * Copy constructor.
+	 *
+	 * No-op since the reading thread cannot be shared.
+	 */
+	ReadAheadStream(const ReadAheadStream& readAheadStream);
+
+	/**
+	 * @internal
+	 * Overloaded assignment operator.
+	 *
+	 * No-op since the reading thread cannot be shared.
+	 */
+	void operator=(const ReadAheadStream& readAheadStream);
+};
+
+}	// End of bump namespace
+
+#endif	// End of BUMP_READ_AHEAD_STREAM_H
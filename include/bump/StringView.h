@@ -0,0 +1,295 @@
+//
+//  StringView.h
+//  Bump
+//
+//  Created by Joseph Holub on 10/18/26.
+//  Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+#ifndef BUMP_STRING_VIEW_H
+#define BUMP_STRING_VIEW_H
+
+// Bump headers
+#include <bump/Export.h>
+#include <bump/String.h>
+
+// C++ headers
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace bump {
+
+/**
+ * A read-only view of a run of characters owned by something else.
+ *
+ * A StringView is just a pointer and a length, so taking substrings of it never allocates
+ * or copies. The characters are not null terminated, and the view is only valid for as
+ * long as the characters it points to. Use toString() to make an owned copy.
+ *
+ * @code
+ *   bump::String path = "/home/username/output.txt";
+ *   bump::StringView view(path);
+ *   view.right(10);          // views "output.txt"
+ *   view.lastIndexOf('/');   // returns 14
+ * @endcode
+ */
+class BUMP_EXPORT StringView
+{
+public:
+
+	/** The value returned by the search methods when nothing was found. */
+	static const std::size_t npos;
+
+	/**
+	 * Default constructor creating an empty view.
+	 */
+	StringView();
+
+	/**
+	 * Constructor viewing a null terminated c string.
+	 *
+	 * @param cString The c string to view, NULL creates an empty view.
+	 */
+	StringView(const char* cString);
+
+	/**
+	 * Constructor viewing a run of characters.
+	 *
+	 * @param data The first character to view.
+	 * @param length The number of characters to view.
+	 */
+	StringView(const char* data, std::size_t length);
+
+	/**
+	 * Constructor viewing the contents of a std::string or a bump::String.
+	 *
+	 * @param stdString The string to view, which must outlive the view.
+	 */
+	StringView(const std::string& stdString);
+
+	/**
+	 * Returns a pointer to the first character, which is not null terminated.
+	 *
+	 * @return A pointer to the first character.
+	 */
+	const char* data() const;
+
+	/**
+	 * Returns the number of characters in the view.
+	 *
+	 * @return The number of characters in the view.
+	 */
+	std::size_t length() const;
+
+	/**
+	 * Returns whether the view contains no characters.
+	 *
+	 * @return True if the view is empty, false otherwise.
+	 */
+	bool isEmpty() const;
+
+	/**
+	 * Returns a pointer to the first character for iterating over the view.
+	 *
+	 * @return A pointer to the first character.
+	 */
+	const char* begin() const;
+
+	/**
+	 * Returns a pointer one past the last character for iterating over the view.
+	 *
+	 * @return A pointer one past the last character.
+	 */
+	const char* end() const;
+
+	/**
+	 * Returns the character at the position without any bounds checking.
+	 *
+	 * @param position The index of the character.
+	 * @return The character at the position.
+	 */
+	char operator[](std::size_t position) const;
+
+	/**
+	 * Returns the character at the position.
+	 *
+	 * @throw bump::OutOfRangeError When the position is past the end of the view.
+	 *
+	 * @param position The index of the character.
+	 * @return The character at the position.
+	 */
+	char at(std::size_t position) const;
+
+	/**
+	 * Returns a view of the first n characters.
+	 *
+	 * @param n The number of characters, clamped to the length of the view.
+	 * @return A view of the first n characters.
+	 */
+	StringView left(std::size_t n) const;
+
+	/**
+	 * Returns a view of the last n characters.
+	 *
+	 * @param n The number of characters, clamped to the length of the view.
+	 * @return A view of the last n characters.
+	 */
+	StringView right(std::size_t n) const;
+
+	/**
+	 * Returns a view of the characters starting at the position.
+	 *
+	 * @param startPosition The index of the first character, clamped to the length of the view.
+	 * @param length The number of characters, npos takes everything up to the end.
+	 * @return A view of the section.
+	 */
+	StringView section(std::size_t startPosition, std::size_t length = npos) const;
+
+	/**
+	 * Returns the index of the first occurrence of the character.
+	 *
+	 * @param character The character to search for.
+	 * @param startPosition The index to start searching at.
+	 * @return The index of the character, npos if it was not found.
+	 */
+	std::size_t indexOf(char character, std::size_t startPosition = 0) const;
+
+	/**
+	 * Returns the index of the first occurrence of the other view.
+	 *
+	 * Candidates are found by searching for the first character, so only the positions
+	 * starting with it are compared in full.
+	 *
+	 * @param subString The characters to search for.
+	 * @param startPosition The index to start searching at.
+	 * @return The index of the characters, npos if they were not found.
+	 */
+	std::size_t indexOf(const StringView& subString, std::size_t startPosition = 0) const;
+
+	/**
+	 * Returns the index of the last occurrence of the character.
+	 *
+	 * @param character The character to search for.
+	 * @return The index of the character, npos if it was not found.
+	 */
+	std::size_t lastIndexOf(char character) const;
+
+	/**
+	 * Returns the number of occurrences of the character.
+	 *
+	 * The characters are compared a vector register at a time, using AVX2 when the library
+	 * is built for it and SSE2 on any other x86 build, so counting the lines of a large
+	 * block runs close to memory bandwidth.
+	 *
+	 * @param character The character to count.
+	 * @return The number of times the character occurs in the view.
+	 */
+	std::size_t count(char character) const;
+
+	/**
+	 * Splits the view at every occurrence of the separator.
+	 *
+	 * The parts are views into this view, so nothing is copied, and the list is cleared
+	 * first so one list can be reused for many splits without allocating. The separators
+	 * are found a vector register at a time on x86 builds. Splitting always produces one
+	 * more part than there are separators, so empty parts are kept.
+	 *
+	 * @param separator The character to split at.
+	 * @param parts Set to the parts between the separators.
+	 */
+	void split(char separator, std::vector<StringView>& parts) const;
+
+	/**
+	 * Returns whether the view starts with the other view.
+	 *
+	 * @param startString The characters to compare against.
+	 * @return True if the view starts with the characters, false otherwise.
+	 */
+	bool startsWith(const StringView& startString) const;
+
+	/**
+	 * Returns whether the view ends with the other view.
+	 *
+	 * @param endString The characters to compare against.
+	 * @return True if the view ends with the characters, false otherwise.
+	 */
+	bool endsWith(const StringView& endString) const;
+
+	/**
+	 * Parses the view as a decimal integer without allocating.
+	 *
+	 * The view must hold an optional sign followed by digits and nothing else.
+	 *
+	 * @param value Set to the parsed integer on success.
+	 * @return True if the whole view is an integer that fits in a long long, false otherwise.
+	 */
+	bool toLongLong(long long& value) const;
+
+	/**
+	 * Parses the view as a floating point number without allocating.
+	 *
+	 * Plain decimal numbers with up to 19 significant digits and a small exponent, which
+	 * covers nearly all numbers written by programs, are converted exactly with a single
+	 * multiplication or division. Anything else, such as "inf" or very long numbers, is
+	 * copied and handed to strtod().
+	 *
+	 * @param value Set to the parsed number on success.
+	 * @return True if the whole view is a number within the range of a double, false otherwise.
+	 */
+	bool toDouble(double& value) const;
+
+	/**
+	 * Copies the viewed characters into a new string.
+	 *
+	 * @return A string owning a copy of the characters.
+	 */
+	String toString() const;
+
+	/**
+	 * Returns whether both views contain the same characters.
+	 *
+	 * @param other The view to compare against.
+	 * @return True if the characters are equal, false otherwise.
+	 */
+	bool operator == (const StringView& other) const;
+
+	/**
+	 * Returns whether the views contain different characters.
+	 *
+	 * @param other The view to compare against.
+	 * @return True if the characters differ, false otherwise.
+	 */
+	bool operator != (const StringView& other) const;
+
+	/**
+	 * Returns whether the view sorts before the other view, comparing characters as unsigned bytes.
+	 *
+	 * @param other The view to compare against.
+	 * @return True if the view sorts first, false otherwise.
+	 */
+	bool operator < (const StringView& other) const;
+
+protected:
+
+	// Instance member variables
+	const char*		_data;		/**< @internal The first viewed character. */
+	std::size_t		_length;	/**< @internal The number of viewed characters. */
+};
+
+// Typedefs
+typedef std::vector<StringView> StringViewList;	/**< A shortcut typedef for an std::vector of bump::StringView objects. */
+
+/**
+ * Prints the viewed characters to the stream.
+ *
+ * @param os The output stream.
+ * @param view The view to print.
+ * @return The output stream.
+ */
+BUMP_EXPORT std::ostream& operator << (std::ostream& os, const StringView& view);
+
+}	// End of bump namespace
+
+#endif	// End of BUMP_STRING_VIEW_H
@@ -0,0 +1,41 @@
+//
+//	TaskError.h
+//	Bump
+//
+//	Created by Joseph Holub on 10/18/26.
+//	Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+#ifndef BUMP_TASK_ERROR_H
+#define BUMP_TASK_ERROR_H
+
+// Bump headers
+#include <bump/Exception.h>
+
+namespace bump {
+
+/**
+ * A public runtime error class which is used when a task run on a thread pool throws, so the
+ * failure can be rethrown on the thread waiting for the task.
+ */
+class BUMP_EXPORT TaskError : public RuntimeError
+{
+public:
+
+	/**
+	 * Constructor.
+	 *
+	 * @param description The description of the exception.
+	 * @param location The file path, line number and function name of where the exception was thrown.
+	 */
+	TaskError(const String& description, const String& location) throw();
+
+	/**
+	 * Destructor.
+	 */
+	~TaskError() throw();
+};
+
+}	// End of bump namespace
+
+#endif	// End of BUMP_TASK_ERROR_H
@@ -0,0 +1,196 @@
+//
+//  TextChunker.h
+//  Bump
+//
+//  Created by Joseph Holub on 10/18/26.
+//  Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+#ifndef BUMP_TEXT_CHUNKER_H
+#define BUMP_TEXT_CHUNKER_H
+
+// Boost headers
+#include <boost/bind.hpp>
+#include <boost/ref.hpp>
+
+// Bump headers
+#include <bump/Export.h>
+#include <bump/StringView.h>
+#include <bump/ThreadPool.h>
+
+// C++ headers
+#include <cstddef>
+#include <vector>
+
+namespace bump {
+
+/**
+ * A run of whole lines of text handed to a single task.
+ */
+struct BUMP_EXPORT TextChunk
+{
+	std::size_t		index;		/**< The position of the chunk among all the chunks. */
+	std::size_t		offset;		/**< The byte offset of the first line of the chunk within the text. */
+	StringView		contents;	/**< The lines of the chunk, ending right after a newline or at the end of the text. */
+};
+
+/**
+ * Splits text into chunks of whole lines and processes the chunks in parallel.
+ *
+ * The text is cut every chunkSize bytes, and each cut is moved forward to just past
+ * the next newline so no line is ever split between two chunks. Each chunk is handed
+ * to a task on a ThreadPool along with its own result, and the results come back in
+ * the order of the chunks so they can be merged as if the text had been processed
+ * front to back. The text is never copied, which makes a MappedFile's view the
+ * natural input.
+ *
+ * Line callbacks see the same lines as the LineReader, so a trailing '\r' is removed
+ * and a newline at the very end of the text does not add an empty line. The offset of
+ * a line within the text is the difference between its data() and the text's data().
+ *
+ * Processing blocks until every chunk is done, so it must not be started from a task
+ * running on the same pool. Callbacks run concurrently and must only touch the result
+ * they are given.
+ *
+ * @code
+ *   void countErrors(const bump::StringView& line, unsigned long& errors)
+ *   {
+ *       errors += line.startsWith("ERROR") ? 1 : 0;
+ *   }
+ *
+ *   bump::MappedFile file;
+ *   file.open("access.log");
+ *   bump::ThreadPool pool;
+ *   std::vector<unsigned long> errors;
+ *   bump::TextChunker(file.view()).processLines(pool, &countErrors, errors);
+ * @endcode
+ */
+class BUMP_EXPORT TextChunker
+{
+public:
+
+	/**
+	 * Defines the default size in bytes that chunks are cut at.
+	 */
+	static const std::size_t DEFAULT_CHUNK_SIZE;
+
+	/**
+	 * Constructor splitting the text into chunks.
+	 *
+	 * @param contents The text to split, which must outlive the chunker.
+	 * @param chunkSize The size in bytes to cut the chunks at, 0 uses DEFAULT_CHUNK_SIZE.
+	 */
+	TextChunker(const StringView& contents, std::size_t chunkSize = DEFAULT_CHUNK_SIZE);
+
+	/**
+	 * Returns the text that was split.
+	 *
+	 * @return The whole text.
+	 */
+	const StringView& contents() const;
+
+	/**
+	 * Returns the number of chunks, which is 0 for empty text.
+	 *
+	 * @return The number of chunks.
+	 */
+	std::size_t numberOfChunks() const;
+
+	/**
+	 * Returns the chunks in the order they appear in the text.
+	 *
+	 * @return The chunks.
+	 */
+	const std::vector<TextChunk>& chunks() const;
+
+	/**
+	 * Runs the callback on every chunk in parallel.
+	 *
+	 * The callback is called as callback(const TextChunk& chunk, Result& result).
+	 *
+	 * @param pool The thread pool to run the chunks on.
+	 * @param callback The callback to run on each chunk.
+	 * @param results Set to one default constructed result per chunk, in chunk order, filled in by the callback.
+	 *
+	 * @throw bump::TaskError When the callback throws on any chunk, once every chunk has finished.
+	 */
+	template <typename Callback, typename Result>
+	void processChunks(ThreadPool& pool, Callback callback, std::vector<Result>& results) const;
+
+	/**
+	 * Runs the callback on every line in parallel, one chunk per task.
+	 *
+	 * The callback is called as callback(const StringView& line, Result& result) with the
+	 * result of the chunk holding the line.
+	 *
+	 * @param pool The thread pool to run the chunks on.
+	 * @param callback The callback to run on each line.
+	 * @param results Set to one default constructed result per chunk, in chunk order, filled in by the callback.
+	 *
+	 * @throw bump::TaskError When the callback throws on any line, once every chunk has finished.
+	 */
+	template <typename Callback, typename Result>
+	void processLines(ThreadPool& pool, Callback callback, std::vector<Result>& results) const;
+
+	/**
+	 * Runs the callback on every line in parallel, then merges the chunk results in order.
+	 *
+	 * The merge is called as merge(Result& merged, const Result& chunkResult) once per chunk,
+	 * front to back, on the calling thread.
+	 *
+	 * @param pool The thread pool to run the chunks on.
+	 * @param callback The callback to run on each line.
+	 * @param merge The function merging each chunk result into the merged result.
+	 * @param merged The result every chunk result is merged into.
+	 *
+	 * @throw bump::TaskError When the callback throws on any line, before anything is merged.
+	 */
+	template <typename Callback, typename Merge, typename Result>
+	void processLines(ThreadPool& pool, Callback callback, Merge merge, Result& merged) const;
+
+	/**
+	 * Calls the callback on every line of a chunk in order.
+	 *
+	 * The callback is called as callback(const StringView& line).
+	 *
+	 * @param chunk The chunk to split into lines.
+	 * @param callback The callback to run on each line.
+	 */
+	template <typename Callback>
+	static void forEachLine(const TextChunk& chunk, Callback callback);
+
+protected:
+
+	/**
+	 * @internal
+	 * Runs one chunk's lines through a line callback.
+	 *
+	 * @param chunk The chunk to process.
+	 * @param callback The callback to run on each line.
+	 * @param result The result of the chunk.
+	 */
+	template <typename Callback, typename Result>
+	static void processChunkLines(const TextChunk& chunk, Callback callback, Result& result);
+
+	/**
+	 * @internal
+	 * Runs the tasks on the pool and waits for just those tasks to finish.
+	 *
+	 * @throw bump::TaskError When any of the tasks threw, describing the first exception.
+	 *
+	 * @param pool The thread pool to run the tasks on.
+	 * @param tasks The tasks to run.
+	 */
+	static void runTasks(ThreadPool& pool, const std::vector<ThreadPool::Task>& tasks);
+
+	// Instance member variables
+	StringView					_contents;		/**< @internal The text that was split. */
+	std::vector<TextChunk>		_chunks;		/**< @internal The chunks in text order. */
+};
+
+}	// End of bump namespace
+
+// Pull in the TextChunker template implementations
+#include <bump/TextChunker_impl.h>
+
+#endif	// End of BUMP_TEXT_CHUNKER_H
@@ -0,0 +1,86 @@
+//
+//  TextChunker_impl.h
+//  Bump
+//
+//  Created by Joseph Holub on 10/18/26.
+//  Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+#ifndef BUMP_TEXT_CHUNKER_IMPL_H
+#define BUMP_TEXT_CHUNKER_IMPL_H
+
+namespace bump {
+
+template <typename Callback, typename Result>
+inline void TextChunker::processChunks(ThreadPool& pool, Callback callback, std::vector<Result>& results) const
+{
+	results.assign(_chunks.size(), Result());
+
+	std::vector<ThreadPool::Task> tasks;
+	tasks.reserve(_chunks.size());
+	for (std::size_t i = 0; i < _chunks.size(); ++i)
+	{
+		tasks.push_back(boost::bind<void>(callback, boost::cref(_chunks[i]), boost::ref(results[i])));
+	}
+
+	runTasks(pool, tasks);
+}
+
+template <typename Callback, typename Result>
+inline void TextChunker::processLines(ThreadPool& pool, Callback callback, std::vector<Result>& results) const
+{
+	results.assign(_chunks.size(), Result());
+
+	std::vector<ThreadPool::Task> tasks;
+	tasks.reserve(_chunks.size());
+	for (std::size_t i = 0; i < _chunks.size(); ++i)
+	{
+		tasks.push_back(boost::bind(&TextChunker::processChunkLines<Callback, Result>,
+			boost::cref(_chunks[i]), callback, boost::ref(results[i])));
+	}
+
+	runTasks(pool, tasks);
+}
+
+template <typename Callback, typename Merge, typename Result>
+inline void TextChunker::processLines(ThreadPool& pool, Callback callback, Merge merge, Result& merged) const
+{
+	std::vector<Result> results;
+	processLines(pool, callback, results);
+
+	for (std::size_t i = 0; i < results.size(); ++i)
+	{
+		merge(merged, results[i]);
+	}
+}
+
+template <typename Callback>
+inline void TextChunker::forEachLine(const TextChunk& chunk, Callback callback)
+{
+	const StringView& contents = chunk.contents;
+	std::size_t line_start = 0;
+	while (line_start < contents.length())
+	{
+		std::size_t newline = contents.indexOf('\n', line_start);
+		std::size_t line_end = newline == StringView::npos ? contents.length() : newline;
+		std::size_t length = line_end - line_start;
+		if (length > 0 && contents[line_end - 1] == '\r')
+		{
+			--length;
+		}
+
+		StringView line = contents.section(line_start, length);
+		callback(line);
+		line_start = line_end + 1;
+	}
+}
+
+template <typename Callback, typename Result>
+inline void TextChunker::processChunkLines(const TextChunk& chunk, Callback callback, Result& result)
+{
+	forEachLine(chunk, boost::bind<void>(callback, _1, boost::ref(result)));
+}
+
+}	// End of bump namespace
+
+#endif	// End of BUMP_TEXT_CHUNKER_IMPL_H
@@ -10,10 +10,30 @@
 #define BUMP_TEXT_FILE_READER_H
 
 #include <bump/Export.h>
+#include <bump/LineIndex.h>
+#include <bump/MappedFile.h>
 #include <bump/String.h>
+#include <bump/StringView.h>
+#include <bump/ThreadPool.h>
+
+// C++ headers
+#include <vector>
 
 namespace bump {
 
+/**
+ * A line of a text file matching a search.
+ */
+struct BUMP_EXPORT TextMatch
+{
+	unsigned long long	lineNumber;		/**< The number of the matching line, starting at 1. */
+	unsigned long long	offset;			/**< The byte offset of the start of the line. */
+	String				line;			/**< The matching line without its line ending. */
+};
+
+// Typedefs
+typedef std::vector<TextMatch> TextMatchList; /**< Shortcut for creating vectors of text matches. */
+
 /**
  * The TextFileReader is a collection of static methods that
  * implement reading from a text file. The functions will
@@ -24,6 +44,14 @@ namespace bump {
  * File line counting starts at 1. So if you want to start
  * at the second line in the file, beginningLine should be
  * set to 2.
+ *
+ * Files compressed with gzip or zstd are recognized by their
+ * magic bytes and decompressed on the fly through a
+ * DecompressingReader, so they read exactly like the plain
+ * file would. Since they can only be decompressed from the
+ * start, line indexes are ignored, the footer costs two passes
+ * over the file and grep() decompresses the whole file into
+ * memory before searching it.
  */
 namespace TextFileReader {
 
@@ -66,6 +94,33 @@ BUMP_EXPORT StringList fileContents(const String& fileName, int beginningLine, i
  */
 BUMP_EXPORT StringList fileContents(const String& fileName, int beginningLine);
 
+/**
+ * Returns a subset of the text file using a line index.
+ *
+ * The index turns finding the beginningLine into one seek followed by skipping
+ * at most the index interval of lines, so paging through a large file costs the
+ * same for every page. An index that is not current for the file is ignored and
+ * the file is read from the start.
+ *
+ * @param fileName The text file's name and/or path.
+ * @param beginningLine The line to start reading from.
+ * @param numLines The number of lines to read.
+ * @param index The line index built for the file.
+ * @return The requested contents of the file with each bump::String being one line from the file.
+ */
+BUMP_EXPORT StringList fileContents(const String& fileName, int beginningLine, int numLines, const LineIndex& index);
+
+/**
+ * Returns the entire contents of the mapped text file.
+ *
+ * The lines are split straight out of the mapping without going through a stream,
+ * and match the lines returned for the file's name.
+ *
+ * @param file The open mapped text file.
+ * @return The entire contents of the file with each bump::String being one line from the file.
+ */
+BUMP_EXPORT StringList fileContents(const MappedFile& file);
+
 /**
  * Returns the first line of the text file.
  *
@@ -106,6 +161,39 @@ BUMP_EXPORT StringList footer(const String& fileName, int numLines);
  */
 BUMP_EXPORT int numberOfLines(const String& fileName);
 
+/**
+ * Returns the number of lines in the file, counting chunks of it in parallel.
+ *
+ * The file is split into chunks of whole lines with a TextChunker and the newlines
+ * of every chunk are counted on the pool, so the count matches numberOfLines().
+ *
+ * This will return -1 if there was an error.
+ *
+ * @param fileName The text file's name and/or path.
+ * @param pool The thread pool to count the chunks on.
+ * @return The number of lines in the file.
+ */
+BUMP_EXPORT int numberOfLines(const String& fileName, ThreadPool& pool);
+
+/**
+ * Returns every line of the file containing the pattern, searching chunks of it in parallel.
+ *
+ * The pattern is a plain string like grep -F, so no character has a special meaning.
+ * Each chunk is searched for the pattern as a whole and only the matching lines are
+ * split out, so the lines that do not match are never copied. Lines matching more than
+ * once are returned once, and the matches are returned in the order of the file.
+ * Compressed files are searched a block at a time as they are decompressed, so they
+ * never have to fit in memory.
+ *
+ * An empty list is returned if there was an error or the pattern holds a newline.
+ *
+ * @param fileName The text file's name and/or path.
+ * @param pattern The characters to search for.
+ * @param pool The thread pool to search the chunks on.
+ * @return The matching lines in file order.
+ */
+BUMP_EXPORT TextMatchList grep(const String& fileName, const StringView& pattern, ThreadPool& pool);
+
 }	// End of TextFileReader namespace
 
 }	// End of bump namespace
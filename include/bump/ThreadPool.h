@@ -0,0 +1,163 @@
+//
+//  ThreadPool.h
+//  Bump
+//
+//  Created by Joseph Holub on 10/18/26.
+//  Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+#ifndef BUMP_THREAD_POOL_H
+#define BUMP_THREAD_POOL_H
+
+// Boost headers
+#include <boost/function.hpp>
+#include <boost/thread.hpp>
+
+// Bump headers
+#include <bump/Export.h>
+
+// C++ headers
+#include <deque>
+#include <vector>
+
+namespace bump {
+
+/**
+ * The ThreadPool class runs tasks on a fixed set of worker threads using work stealing.
+ *
+ * Each worker owns a task queue. Tasks submitted from inside a running task are pushed
+ * onto the submitting worker's own queue and popped in last-in first-out order, which
+ * keeps recursive workloads such as directory traversals depth-first and cache friendly.
+ * Idle workers steal the oldest tasks from the other workers' queues so the load spreads
+ * across all threads as soon as the work fans out. Tasks submitted from outside the
+ * pool are distributed round-robin across the workers.
+ *
+ * @code
+ *   bump::ThreadPool pool(4);
+ *   pool.submit(boost::bind(&processDirectory, &pool, "/data"));
+ *   pool.waitForDone();
+ * @endcode
+ */
+class BUMP_EXPORT ThreadPool
+{
+public:
+
+	/** The signature of a task that can be run on the thread pool. */
+	typedef boost::function<void ()> Task;
+
+	/**
+	 * Constructor.
+	 *
+	 * @param numberOfThreads The number of worker threads to start, 0 uses idealThreadCount().
+	 */
+	ThreadPool(unsigned int numberOfThreads = 0);
+
+	/**
+	 * Destructor.
+	 *
+	 * Waits for all the submitted tasks to finish before stopping the worker threads.
+	 */
+	~ThreadPool();
+
+	/**
+	 * Returns the number of threads the hardware can run concurrently.
+	 *
+	 * @return The number of hardware threads, or 1 if it cannot be determined.
+	 */
+	static unsigned int idealThreadCount();
+
+	/**
+	 * Returns the number of worker threads owned by the pool.
+	 *
+	 * @return The number of worker threads.
+	 */
+	unsigned int numberOfThreads() const;
+
+	/**
+	 * Queues the task to be run on one of the worker threads.
+	 *
+	 * It is safe to call this method from inside a running task.
+	 *
+	 * @param task The task to run.
+	 */
+	void submit(const Task& task);
+
+	/**
+	 * Blocks until all the submitted tasks, including any tasks they submitted, have finished.
+	 *
+	 * This method must not be called from inside a running task. The calling task counts
+	 * as pending until it returns, so the wait would never finish and the worker deadlocks.
+	 */
+	void waitForDone();
+
+protected:
+
+	/**
+	 * @internal
+	 * The task queue owned by a single worker thread.
+	 */
+	struct Worker
+	{
+		std::deque<Task>	tasks;		/**< @internal The queued tasks for the worker. */
+		boost::mutex		mutex;		/**< @internal Guards access to the queued tasks. */
+	};
+
+	/**
+	 * @internal
+	 * The main loop run by each worker thread.
+	 *
+	 * @param index The index of the worker the thread is running.
+	 */
+	void run(unsigned int index);
+
+	/**
+	 * @internal
+	 * Pops a task from the worker's own queue, or steals one from another worker.
+	 *
+	 * @param index The index of the worker looking for a task.
+	 * @param task The task that was found.
+	 * @return True if a task was found, false otherwise.
+	 */
+	bool takeTask(unsigned int index, Task& task);
+
+	/**
+	 * @internal
+	 * Returns the index of the worker running on the current thread.
+	 *
+	 * @return The worker index, or -1 if the current thread is not owned by the pool.
+	 */
+	int currentWorkerIndex() const;
+
+	// Instance member variables
+	std::vector<Worker*>			_workers;			/**< @internal The task queues, one per worker thread. */
+	boost::thread_group				_threads;			/**< @internal The worker threads. */
+	boost::mutex					_mutex;				/**< @internal Guards the counters and the condition variables. */
+	boost::condition_variable		_taskQueued;		/**< @internal Signalled when a task is queued or the pool stops. */
+	boost::condition_variable		_tasksFinished;		/**< @internal Signalled when the last pending task finishes. */
+	long							_queuedTasks;		/**< @internal The number of tasks waiting in the queues. */
+	unsigned long					_pendingTasks;		/**< @internal The number of tasks submitted but not yet finished. */
+	unsigned int					_nextWorker;		/**< @internal The next worker to receive a task submitted from outside. */
+	bool							_stopping;			/**< @internal Whether the worker threads have been asked to exit. */
+
+private:
+
+	/**
+	 * @internal
+	 * Copy constructor.
+	 *
+	 * No-op since the worker threads cannot be copied.
+	 */
+	ThreadPool(const ThreadPool& threadPool);
+
+	/**
+	 * @internal
+	 * Overloaded assignment operator.
+	 *
+	 * No-op since the worker threads cannot be copied.
+	 */
+	void operator=(const ThreadPool& threadPool);
+};
+
+}	// End of bump namespace
+
+#endif	// End of BUMP_THREAD_POOL_H
@@ -9,22 +9,40 @@
 #ifndef BUMP_BUMP_H
 #define BUMP_BUMP_H
 
+#include <bump/AtomicFileWriter.h>
 #include <bump/AutoTimer.h>
+#include <bump/DecompressingReader.h>
+#include <bump/DelimitedReader.h>
+#include <bump/Directory.h>
 #include <bump/Environment.h>
 #include <bump/Exception.h>
 #include <bump/Export.h>
 #include <bump/FileInfo.h>
 #include <bump/FileSystem.h>
 #include <bump/FileSystemError.h>
+#include <bump/FileSystemStatus.h>
+#include <bump/FileWatcher.h>
+#include <bump/GlobPattern.h>
+#include <bump/IdentityCache.h>
 #include <bump/InvalidArgumentError.h>
+#include <bump/LineIndex.h>
+#include <bump/LineReader.h>
 #include <bump/Log.h>
+#include <bump/MappedFile.h>
+#include <bump/MappedTextFile.h>
 #include <bump/NotificationCenter.h>
 #include <bump/NotificationCenter_impl.h>
 #include <bump/NotificationError.h>
 #include <bump/NotImplementedError.h>
 #include <bump/OutOfRangeError.h>
+#include <bump/Path.h>
+#include <bump/ReadAheadStream.h>
 #include <bump/String.h>
 #include <bump/StringSearchError.h>
+#include <bump/StringView.h>
+#include <bump/TaskError.h>
+#include <bump/TextChunker.h>
+#include <bump/ThreadPool.h>
 #include <bump/Timeline.h>
 #include <bump/Timer.h>
 #include <bump/TypeCastError.h>
@@ -44,6 +44,35 @@ namespace sha1
      */
     void toHexString(const unsigned char* hash, char* hexstring);
 
+    /**
+     Holds the state of a hash computed over data handed over in several pieces, such as the blocks of a file.
+     */
+    struct Context
+    {
+        unsigned int result[5];
+        unsigned char block[64];
+        unsigned int blockLength;
+        unsigned long long totalLength;
+    };
+
+    /**
+     @param context is set up to hash a new piece of data.
+     */
+    void init(Context& context);
+
+    /**
+     @param context is the hash to add the data to.
+     @param src points to the next piece of data to be hashed.
+     @param bytelength the number of bytes to hash from the src pointer.
+     */
+    void update(Context& context, const void* src, const int bytelength);
+
+    /**
+     @param context is the hash to finish, it has to be set up with init before it can be used again.
+     @param hash should point to a buffer of at least 20 bytes of size for storing the sha1 result in. This is the same result as calc gives for all the data at once.
+     */
+    void finish(Context& context, unsigned char* hash);
+
 } // namespace sha1
 
 #endif // SHA1_DEFINED
@@ -0,0 +1,120 @@
+//
+//  AtomicFileWriter.cpp
+//  Bump
+//
+//  Created by Joseph Holub on 10/18/26.
+//  Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+// Bump headers
+#include <bump/AtomicFileWriter.h>
+
+// C headers
+#include <string.h>
+
+namespace bump {
+
+AtomicFileWriter::AtomicFileWriter(unsigned int bufferSize) :
+	_path(),
+	_temporaryPath(),
+	_durability(SYNC_FILE_AND_DIRECTORY),
+	_buffer(),
+	_bufferSize(bufferSize),
+	_bufferedBytes(0),
+	_descriptor(-1),
+	_errorCode(0),
+	_replaced(false)
+{
+	;
+}
+
+AtomicFileWriter::~AtomicFileWriter()
+{
+	discard();
+}
+
+bool AtomicFileWriter::write(const StringView& data)
+{
+	if (!isOpen() || _errorCode != 0)
+	{
+		return false;
+	}
+	else if (data.isEmpty())
+	{
+		return true;
+	}
+
+	// Gather small writes in the buffer
+	if (_bufferedBytes + data.length() <= _bufferSize)
+	{
+		if (_buffer.empty())
+		{
+			_buffer.resize(_bufferSize);
+		}
+
+		memcpy(&_buffer[0] + _bufferedBytes, data.data(), data.length());
+		_bufferedBytes += data.length();
+		return true;
+	}
+
+	// Write out what has been gathered, then anything as large as the buffer goes straight to the file
+	if (!flushBuffer())
+	{
+		return false;
+	}
+	else if (data.length() >= _bufferSize)
+	{
+		return writeData(data.data(), data.length());
+	}
+
+	if (_buffer.empty())
+	{
+		_buffer.resize(_bufferSize);
+	}
+
+	memcpy(&_buffer[0], data.data(), data.length());
+	_bufferedBytes = data.length();
+	return true;
+}
+
+bool AtomicFileWriter::isOpen() const
+{
+	return _descriptor >= 0;
+}
+
+const String& AtomicFileWriter::path() const
+{
+	return _path;
+}
+
+bool AtomicFileWriter::destinationReplaced() const
+{
+	return _replaced;
+}
+
+int AtomicFileWriter::errorCode() const
+{
+	return _errorCode;
+}
+
+void AtomicFileWriter::recordError(int errorCode)
+{
+	if (_errorCode == 0)
+	{
+		_errorCode = errorCode;
+	}
+}
+
+bool AtomicFileWriter::flushBuffer()
+{
+	if (_bufferedBytes == 0)
+	{
+		return true;
+	}
+
+	std::size_t length = _bufferedBytes;
+	_bufferedBytes = 0;
+	return writeData(&_buffer[0], length);
+}
+
+}	// End of bump namespace
@@ -0,0 +1,167 @@
+//
+//  AtomicFileWriter_unix.cpp
+//  Bump
+//
+//  Created by Joseph Holub on 10/18/26.
+//  Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+// Bump headers
+#include <bump/AtomicFileWriter.h>
+#include <bump/FileSystem.h>
+#include <bump/Path.h>
+#include <bump/Uuid.h>
+
+// C headers
+#include <stdio.h>
+
+// Unix headers
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+namespace bump {
+
+static String parentDirectory(const String& path)
+{
+	Path normalized(path);
+	StringView parent = normalized.parent();
+	return parent.isEmpty() ? String(".") : parent.toString();
+}
+
+bool AtomicFileWriter::open(const String& path, Durability durability)
+{
+	discard();
+	_path = path;
+	_durability = durability;
+	_bufferedBytes = 0;
+	_errorCode = 0;
+	_replaced = false;
+
+	// Keep the temporary file in the same directory so the final rename never crosses file systems
+	Path normalized(path);
+	String name = normalized.filename().toString();
+	if (name.empty())
+	{
+		recordError(EISDIR);
+		return false;
+	}
+
+	String temporary_name = String(".%1.%2.tmp").arg(name, Uuid::genarateRandom().toString());
+	_temporaryPath = normalized.parent().isEmpty() ? temporary_name : FileSystem::join(normalized.parent().toString(), temporary_name);
+
+	_descriptor = ::open(_temporaryPath.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0666);
+	if (_descriptor < 0)
+	{
+		recordError(errno);
+		return false;
+	}
+
+	// Carry the permissions of the file being replaced over to the new one
+	struct stat info;
+	if (::stat(path.c_str(), &info) == 0 && S_ISREG(info.st_mode) && fchmod(_descriptor, info.st_mode & 07777) != 0)
+	{
+		recordError(errno);
+	}
+
+	return true;
+}
+
+bool AtomicFileWriter::writeData(const char* data, std::size_t length)
+{
+	while (length > 0)
+	{
+		ssize_t written = ::write(_descriptor, data, length);
+		if (written < 0)
+		{
+			if (errno == EINTR)
+			{
+				continue;
+			}
+
+			recordError(errno);
+			return false;
+		}
+
+		data += written;
+		length -= written;
+	}
+
+	return true;
+}
+
+bool AtomicFileWriter::commit()
+{
+	_replaced = false;
+	if (!isOpen())
+	{
+		recordError(EBADF);
+		return false;
+	}
+
+	flushBuffer();
+	if (_errorCode == 0 && _durability != NO_SYNC && fsync(_descriptor) != 0)
+	{
+		recordError(errno);
+	}
+
+	// Write errors on network file systems can surface when the file is closed
+	if (::close(_descriptor) != 0)
+	{
+		recordError(errno);
+	}
+	_descriptor = -1;
+	_bufferedBytes = 0;
+
+	if (_errorCode == 0 && ::rename(_temporaryPath.c_str(), _path.c_str()) != 0)
+	{
+		recordError(errno);
+	}
+
+	if (_errorCode != 0)
+	{
+		unlink(_temporaryPath.c_str());
+		return false;
+	}
+
+	// From here on the destination holds the new contents even if the directory flush fails
+	_replaced = true;
+	if (_durability == SYNC_FILE_AND_DIRECTORY && !synchronizeDirectory(parentDirectory(_path)))
+	{
+		recordError(errno);
+		return false;
+	}
+
+	return true;
+}
+
+void AtomicFileWriter::discard()
+{
+	if (isOpen())
+	{
+		::close(_descriptor);
+		unlink(_temporaryPath.c_str());
+		_descriptor = -1;
+		_bufferedBytes = 0;
+	}
+}
+
+bool AtomicFileWriter::synchronizeDirectory(const String& path)
+{
+	int descriptor = ::open(path.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+	if (descriptor < 0)
+	{
+		return false;
+	}
+
+	int result = fsync(descriptor);
+	int error_code = errno;
+	::close(descriptor);
+	errno = error_code;
+
+	return result == 0;
+}
+
+}	// End of bump namespace
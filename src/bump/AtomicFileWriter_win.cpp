@@ -0,0 +1,44 @@
+//
+//  AtomicFileWriter_win.cpp
+//  Bump
+//
+//  Created by Joseph Holub on 10/18/26.
+//  Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+// Bump headers
+#include <bump/AtomicFileWriter.h>
+#include <bump/NotImplementedError.h>
+
+namespace bump {
+
+bool AtomicFileWriter::open(const String& path, Durability durability)
+{
+	String msg = "The bump::AtomicFileWriter::open() method is not implemented on Windows";
+	throw NotImplementedError(msg, BUMP_LOCATION);
+}
+
+bool AtomicFileWriter::writeData(const char* data, std::size_t length)
+{
+	String msg = "The bump::AtomicFileWriter::write() method is not implemented on Windows";
+	throw NotImplementedError(msg, BUMP_LOCATION);
+}
+
+bool AtomicFileWriter::commit()
+{
+	String msg = "The bump::AtomicFileWriter::commit() method is not implemented on Windows";
+	throw NotImplementedError(msg, BUMP_LOCATION);
+}
+
+void AtomicFileWriter::discard()
+{
+	;
+}
+
+bool AtomicFileWriter::synchronizeDirectory(const String& path)
+{
+	String msg = "The bump::AtomicFileWriter::synchronizeDirectory() method is not implemented on Windows";
+	throw NotImplementedError(msg, BUMP_LOCATION);
+}
+
+}	// End of bump namespace
@@ -0,0 +1,132 @@
+//
+//  BufferQueue.cpp
+//  Bump
+//
+//  Created by Joseph Holub on 10/18/26.
+//  Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+// C headers
+#include <errno.h>
+
+// Private headers
+#include "BufferQueue.h"
+
+namespace bump {
+
+BufferQueue::BufferQueue(std::size_t bufferSize, unsigned int maximumBuffers) :
+	_bufferSize(bufferSize > 0 ? bufferSize : 1),
+	_maximumBuffers(maximumBuffers > 0 ? maximumBuffers : 1),
+	_currentBuffer(),
+	_currentPosition(0),
+	_buffers(),
+	_freeBuffers(),
+	_isFinished(false),
+	_isStopping(false),
+	_errorCode(0)
+{
+	;
+}
+
+bool BufferQueue::push(std::vector<char>& buffer, std::size_t length)
+{
+	boost::mutex::scoped_lock lock(_mutex);
+	while (_buffers.size() >= _maximumBuffers && !_isStopping)
+	{
+		_bufferTaken.wait(lock);
+	}
+
+	if (_isStopping)
+	{
+		return false;
+	}
+
+	_buffers.push_back(std::vector<char>());
+	_buffers.back().swap(buffer);
+	_buffers.back().resize(length);
+	_bufferQueued.notify_one();
+
+	// Refill a buffer the consumer has finished with rather than allocating a new one
+	if (!_freeBuffers.empty())
+	{
+		buffer.swap(_freeBuffers.front());
+		_freeBuffers.pop_front();
+	}
+	buffer.resize(_bufferSize);
+
+	return true;
+}
+
+void BufferQueue::finish(int errorCode)
+{
+	boost::mutex::scoped_lock lock(_mutex);
+	_errorCode = errorCode;
+	_isFinished = true;
+	_bufferQueued.notify_all();
+}
+
+long BufferQueue::next(StringView& buffer, std::size_t maximumLength)
+{
+	// Hand the finished buffer back to be filled again and take the next one off the queue
+	while (_currentPosition == _currentBuffer.size())
+	{
+		boost::mutex::scoped_lock lock(_mutex);
+		if (!_currentBuffer.empty())
+		{
+			_freeBuffers.push_back(std::vector<char>());
+			_freeBuffers.back().swap(_currentBuffer);
+			_currentPosition = 0;
+		}
+
+		while (_buffers.empty() && !_isFinished)
+		{
+			_bufferQueued.wait(lock);
+		}
+
+		if (_buffers.empty())
+		{
+			buffer = StringView();
+			if (_errorCode != 0)
+			{
+				errno = _errorCode;
+				return -1;
+			}
+			return 0;
+		}
+
+		_currentBuffer.swap(_buffers.front());
+		_buffers.pop_front();
+		_bufferTaken.notify_one();
+	}
+
+	std::size_t length = _currentBuffer.size() - _currentPosition;
+	if (length > maximumLength)
+	{
+		length = maximumLength;
+	}
+	buffer = StringView(&_currentBuffer[_currentPosition], length);
+	_currentPosition += length;
+
+	return (long)length;
+}
+
+void BufferQueue::stop()
+{
+	boost::mutex::scoped_lock lock(_mutex);
+	_isStopping = true;
+	_bufferTaken.notify_all();
+}
+
+void BufferQueue::reset()
+{
+	boost::mutex::scoped_lock lock(_mutex);
+	_currentBuffer.clear();
+	_currentPosition = 0;
+	_buffers.clear();
+	_freeBuffers.clear();
+	_isFinished = false;
+	_isStopping = false;
+	_errorCode = 0;
+}
+
+}	// End of bump namespace
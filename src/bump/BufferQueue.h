@@ -0,0 +1,123 @@
+//
+//  BufferQueue.h
+//  Bump
+//
+//  Created by Joseph Holub on 10/18/26.
+//  Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+#ifndef BUMP_BUFFER_QUEUE_H
+#define BUMP_BUFFER_QUEUE_H
+
+// Boost headers
+#include <boost/thread.hpp>
+
+// Bump headers
+#include <bump/StringView.h>
+
+// C++ headers
+#include <deque>
+#include <vector>
+
+namespace bump {
+
+/**
+ * A private bounded queue of large buffers handed from a single producing thread to a
+ * single consumer, shared by ReadAheadStream and DecompressingReader.
+ *
+ * The producer fills a buffer and pushes it, waiting while the queue is full. The consumer
+ * takes the bytes out of the queue in order, and every buffer it finishes with is handed
+ * back to the producer to be filled again, so memory use stays at a few buffers.
+ */
+class BufferQueue
+{
+public:
+
+	/**
+	 * Constructor.
+	 *
+	 * @param bufferSize The size of the buffers the producer fills.
+	 * @param maximumBuffers The most filled buffers queued at once.
+	 */
+	BufferQueue(std::size_t bufferSize, unsigned int maximumBuffers);
+
+	/**
+	 * Queues the first length bytes of the buffer, waiting for room in the queue, and swaps in an empty buffer.
+	 *
+	 * Called by the producing thread.
+	 *
+	 * @param buffer The buffer to queue, replaced with a buffer of the full size to fill next.
+	 * @param length The number of bytes filled in the buffer.
+	 * @return True if the buffer was queued, false if the queue is being stopped.
+	 */
+	bool push(std::vector<char>& buffer, std::size_t length);
+
+	/**
+	 * Marks the producer as done, so the consumer sees the end once the queue is drained.
+	 *
+	 * Called by the producing thread.
+	 *
+	 * @param errorCode The errno value of the failure that stopped the producer, 0 if none.
+	 */
+	void finish(int errorCode);
+
+	/**
+	 * Hands over the next bytes without copying them, waiting for the producer if necessary.
+	 *
+	 * The bytes stay valid until the next call to next() or reset(). Everything pushed before
+	 * a failure is still handed over before the failure is reported.
+	 *
+	 * @param buffer Set to view the next bytes.
+	 * @param maximumLength The most bytes to hand over, the rest of the buffer comes next.
+	 * @return The number of bytes handed over, 0 at the end, or -1 with errno set.
+	 */
+	long next(StringView& buffer, std::size_t maximumLength);
+
+	/**
+	 * Wakes the producer up if it is waiting for room, making every later push() fail.
+	 */
+	void stop();
+
+	/**
+	 * Empties the queue so it can be used again, once the producing thread has exited.
+	 */
+	void reset();
+
+protected:
+
+	// Instance member variables
+	std::size_t							_bufferSize;		/**< @internal The size of the buffers the producer fills. */
+	unsigned int						_maximumBuffers;	/**< @internal The most buffers queued at once. */
+	std::vector<char>					_currentBuffer;		/**< @internal The buffer the consumer is reading from. */
+	std::size_t							_currentPosition;	/**< @internal The position in the current buffer to hand over next. */
+	boost::mutex						_mutex;				/**< @internal Guards the queues and flags below. */
+	boost::condition_variable			_bufferQueued;		/**< @internal Signalled when a buffer is queued or the producer finishes. */
+	boost::condition_variable			_bufferTaken;		/**< @internal Signalled when a buffer is taken off the queue or the queue stops. */
+	std::deque<std::vector<char> >		_buffers;			/**< @internal The filled buffers waiting to be handed over. */
+	std::deque<std::vector<char> >		_freeBuffers;		/**< @internal The buffers already handed over, kept to be filled again. */
+	bool								_isFinished;		/**< @internal Whether the producer has queued its last buffer. */
+	bool								_isStopping;		/**< @internal Whether the producer has been asked to stop. */
+	int									_errorCode;			/**< @internal The errno value of the failure that stopped the producer. */
+
+private:
+
+	/**
+	 * @internal
+	 * Copy constructor.
+	 *
+	 * No-op since the queue is shared between two threads.
+	 */
+	BufferQueue(const BufferQueue& bufferQueue);
+
+	/**
+	 * @internal
+	 * Overloaded assignment operator.
+	 *
+	 * No-op since the queue is shared between two threads.
+	 */
+	void operator=(const BufferQueue& bufferQueue);
+};
+
+}	// End of bump namespace
+
+#endif	// End of BUMP_BUFFER_QUEUE_H
@@ -8,12 +8,23 @@
 
 // Bump headers
 #include <bump/CryptographicHash.h>
+#include <bump/ReadAheadStream.h>
+
+// C++ headers
+#include <algorithm>
+
+// C headers
+#include <errno.h>
+#include <string.h>
 
 // Smallsha1 headers
 #include <smallsha1/sha1.h>
 
 namespace bump {
 
+// sha1::update() takes an int length, so larger data is hashed in pieces of this many bytes
+static const std::size_t MAXIMUM_UPDATE_LENGTH = 1024 * 1024 * 1024;
+
 CryptographicHash::CryptographicHash(const Algorithm& algorithm) :
 	_algorithm(algorithm),
 	_data(NULL),
@@ -39,6 +50,18 @@ void CryptographicHash::setData(const char* data, int length)
 	_length = length;
 }
 
+void CryptographicHash::setData(const char* data)
+{
+	_data = data;
+	_length = data == NULL ? 0 : strlen(data);
+}
+
+void CryptographicHash::setData(const StringView& data)
+{
+	_data = data.data();
+	_length = data.length();
+}
+
 void CryptographicHash::reset()
 {
 	_data = NULL;
@@ -54,10 +77,57 @@ String CryptographicHash::result()
 	}
 
 	// Compute the hash using the sha1 algorithm
+	sha1::Context context;
+	sha1::init(context);
+	for (std::size_t offset = 0; offset < _length; offset += MAXIMUM_UPDATE_LENGTH)
+	{
+		std::size_t length = std::min(_length - offset, MAXIMUM_UPDATE_LENGTH);
+		sha1::update(context, _data + offset, (int)length);
+	}
+
+	unsigned char hash[20];
+	char hexstring[41];
+	hexstring[40] = 0;
+	sha1::finish(context, hash);
+	sha1::toHexString(hash, hexstring);
+
+	return String(hexstring);
+}
+
+String CryptographicHash::fileResult(const String& path)
+{
+	ReadAheadStream stream;
+	if (!stream.open(path))
+	{
+		return String();
+	}
+
+	// Hash each buffer as it arrives while the stream reads the next ones
+	sha1::Context context;
+	sha1::init(context);
+	StringView buffer;
+	long length = 0;
+	while ((length = stream.nextBuffer(buffer)) > 0)
+	{
+		sha1::update(context, buffer.data(), (int)length);
+	}
+
+	if (length < 0)
+	{
+		int error_code = errno;
+		stream.close();
+		errno = error_code;
+		return String();
+	}
+	else if (context.totalLength == 0)
+	{
+		return String();
+	}
+
 	unsigned char hash[20];
 	char hexstring[41];
 	hexstring[40] = 0;
-	sha1::calc(_data, _length, hash);
+	sha1::finish(context, hash);
 	sha1::toHexString(hash, hexstring);
 
 	return String(hexstring);
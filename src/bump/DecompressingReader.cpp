@@ -0,0 +1,355 @@
+//
+//  DecompressingReader.cpp
+//  Bump
+//
+//  Created by Joseph Holub on 10/18/26.
+//  Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+// Boost headers
+#include <boost/bind.hpp>
+
+// Bump headers
+#include <bump/DecompressingReader.h>
+
+// C headers
+#include <errno.h>
+#include <string.h>
+
+// Private headers
+#include "BufferQueue.h"
+
+// Compression headers
+#ifdef Bump_USE_ZLIB
+	#include <zlib.h>
+#endif
+#ifdef Bump_USE_ZSTD
+	#include <zstd.h>
+#endif
+
+namespace bump {
+
+// The number of compressed bytes read from the file at a time
+static const std::size_t INPUT_BLOCK_SIZE = 262144;
+
+DecompressingReader::DecompressingReader(unsigned int blockSize, unsigned int numberOfBlocks) :
+	_blockSize(blockSize > 0 ? blockSize : 1),
+	_numberOfBlocks(numberOfBlocks > 0 ? numberOfBlocks : 1),
+	_file(NULL),
+	_format(UNCOMPRESSED),
+	_queue(new BufferQueue(_blockSize, _numberOfBlocks))
+{
+	;
+}
+
+DecompressingReader::~DecompressingReader()
+{
+	close();
+}
+
+DecompressingReader::Format DecompressingReader::detectFormat(const String& path)
+{
+	FILE* file = fopen(path.c_str(), "rb");
+	if (file == NULL)
+	{
+		return UNCOMPRESSED;
+	}
+
+	char magic[4];
+	std::size_t bytes_read = fread(magic, 1, sizeof(magic), file);
+	fclose(file);
+
+	return detectFormatFromBytes(StringView(magic, bytes_read));
+}
+
+DecompressingReader::Format DecompressingReader::detectFormatFromBytes(const StringView& leadingBytes)
+{
+	const unsigned char* bytes = (const unsigned char*)leadingBytes.data();
+	if (leadingBytes.length() >= 2 && bytes[0] == 0x1f && bytes[1] == 0x8b)
+	{
+		return GZIP_FORMAT;
+	}
+	else if (leadingBytes.length() >= 4 && bytes[0] == 0x28 && bytes[1] == 0xb5 && bytes[2] == 0x2f && bytes[3] == 0xfd)
+	{
+		return ZSTD_FORMAT;
+	}
+
+	return UNCOMPRESSED;
+}
+
+bool DecompressingReader::isFormatSupported(Format format)
+{
+#ifdef Bump_USE_ZLIB
+	if (format == GZIP_FORMAT)
+	{
+		return true;
+	}
+#endif
+#ifdef Bump_USE_ZSTD
+	if (format == ZSTD_FORMAT)
+	{
+		return true;
+	}
+#endif
+#if !defined(Bump_USE_ZLIB) && !defined(Bump_USE_ZSTD)
+	(void)format;
+#endif
+
+	return false;
+}
+
+bool DecompressingReader::open(const String& path)
+{
+	close();
+
+	FILE* file = fopen(path.c_str(), "rb");
+	if (file == NULL)
+	{
+		return false;
+	}
+
+	// Check the magic bytes, then rewind so the decompressor sees the whole file
+	char magic[4];
+	std::size_t bytes_read = fread(magic, 1, sizeof(magic), file);
+	Format format = detectFormatFromBytes(StringView(magic, bytes_read));
+	int error_code = 0;
+	if (ferror(file))
+	{
+		error_code = errno;
+	}
+	else if (format == UNCOMPRESSED)
+	{
+		error_code = EINVAL;
+	}
+	else if (!isFormatSupported(format))
+	{
+		error_code = ENOTSUP;
+	}
+	else if (fseek(file, 0, SEEK_SET) != 0)
+	{
+		error_code = errno;
+	}
+
+	if (error_code != 0)
+	{
+		fclose(file);
+		errno = error_code;
+		return false;
+	}
+
+	_file = file;
+	_format = format;
+	_thread.reset(new boost::thread(boost::bind(&DecompressingReader::run, this)));
+	return true;
+}
+
+void DecompressingReader::close()
+{
+	// Wake the decompressing thread up if it is waiting for room in the queue and wait for it to exit
+	if (_thread.get() != NULL)
+	{
+		_queue->stop();
+		_thread->join();
+		_thread.reset();
+	}
+
+	if (_file != NULL)
+	{
+		fclose(_file);
+		_file = NULL;
+	}
+
+	_format = UNCOMPRESSED;
+	_queue->reset();
+}
+
+bool DecompressingReader::isOpen() const
+{
+	return _file != NULL;
+}
+
+DecompressingReader::Format DecompressingReader::format() const
+{
+	return _format;
+}
+
+long DecompressingReader::read(char* buffer, std::size_t size)
+{
+	if (!isOpen())
+	{
+		errno = EBADF;
+		return -1;
+	}
+
+	StringView next;
+	long length = _queue->next(next, size);
+	if (length > 0)
+	{
+		memcpy(buffer, next.data(), length);
+	}
+
+	return length;
+}
+
+void DecompressingReader::run()
+{
+	std::vector<char> block(_blockSize);
+	int error_code = (_format == GZIP_FORMAT) ? decompressGzip(block) : decompressZstd(block);
+
+	_queue->finish(error_code);
+}
+
+int DecompressingReader::decompressGzip(std::vector<char>& block)
+{
+#ifdef Bump_USE_ZLIB
+	// Adding 16 to the window bits makes zlib expect a gzip header and trailer
+	z_stream stream;
+	memset(&stream, 0, sizeof(stream));
+	if (inflateInit2(&stream, 15 + 16) != Z_OK)
+	{
+		return ENOMEM;
+	}
+
+	std::vector<char> input(INPUT_BLOCK_SIZE);
+	std::size_t filled = 0;
+	bool is_member_open = false;
+	bool is_block_full = false;
+	int error_code = 0;
+	while (true)
+	{
+		// A full block may have left output behind in zlib, so only read more once it is drained
+		if (stream.avail_in == 0 && !is_block_full)
+		{
+			std::size_t bytes_read = fread(&input[0], 1, input.size(), _file);
+			if (bytes_read == 0)
+			{
+				if (ferror(_file))
+				{
+					error_code = errno != 0 ? errno : EIO;
+				}
+				else if (is_member_open)
+				{
+					error_code = EILSEQ;
+				}
+				break;
+			}
+			stream.next_in = (Bytef*)&input[0];
+			stream.avail_in = (uInt)bytes_read;
+		}
+
+		stream.next_out = (Bytef*)&block[filled];
+		stream.avail_out = (uInt)(block.size() - filled);
+		is_member_open = is_member_open || stream.avail_in > 0;
+		int result = inflate(&stream, Z_NO_FLUSH);
+		filled = block.size() - stream.avail_out;
+		if (result == Z_STREAM_END)
+		{
+			// Appending to a gzip file adds another member, which continues the same stream
+			inflateReset(&stream);
+			is_member_open = false;
+		}
+		else if (result != Z_OK && result != Z_BUF_ERROR)
+		{
+			error_code = (result == Z_MEM_ERROR) ? ENOMEM : EILSEQ;
+			break;
+		}
+
+		is_block_full = (filled == block.size());
+		if (is_block_full)
+		{
+			if (!_queue->push(block, filled))
+			{
+				break;
+			}
+			filled = 0;
+		}
+	}
+	inflateEnd(&stream);
+
+	// Whatever was decompressed before a failure is still handed over
+	if (filled > 0)
+	{
+		_queue->push(block, filled);
+	}
+
+	return error_code;
+#else
+	(void)block;
+	return ENOTSUP;
+#endif
+}
+
+int DecompressingReader::decompressZstd(std::vector<char>& block)
+{
+#ifdef Bump_USE_ZSTD
+	ZSTD_DStream* stream = ZSTD_createDStream();
+	if (stream == NULL)
+	{
+		return ENOMEM;
+	}
+	ZSTD_initDStream(stream);
+
+	std::vector<char> input(ZSTD_DStreamInSize());
+	ZSTD_inBuffer in_buffer = { &input[0], 0, 0 };
+	std::size_t filled = 0;
+	std::size_t frame_remaining = 0;
+	bool is_block_full = false;
+	int error_code = 0;
+	while (true)
+	{
+		// A full block may have left output behind in zstd, so only read more once it is drained
+		if (in_buffer.pos == in_buffer.size && !is_block_full)
+		{
+			std::size_t bytes_read = fread(&input[0], 1, input.size(), _file);
+			if (bytes_read == 0)
+			{
+				if (ferror(_file))
+				{
+					error_code = errno != 0 ? errno : EIO;
+				}
+				else if (frame_remaining != 0)
+				{
+					error_code = EILSEQ;
+				}
+				break;
+			}
+			in_buffer.size = bytes_read;
+			in_buffer.pos = 0;
+		}
+
+		// Consecutive frames are decompressed one after the other by the same stream
+		ZSTD_outBuffer out_buffer = { &block[0], block.size(), filled };
+		frame_remaining = ZSTD_decompressStream(stream, &out_buffer, &in_buffer);
+		filled = out_buffer.pos;
+		if (ZSTD_isError(frame_remaining))
+		{
+			error_code = EILSEQ;
+			break;
+		}
+
+		is_block_full = (filled == block.size());
+		if (is_block_full)
+		{
+			if (!_queue->push(block, filled))
+			{
+				break;
+			}
+			filled = 0;
+		}
+	}
+	ZSTD_freeDStream(stream);
+
+	// Whatever was decompressed before a failure is still handed over
+	if (filled > 0)
+	{
+		_queue->push(block, filled);
+	}
+
+	return error_code;
+#else
+	(void)block;
+	return ENOTSUP;
+#endif
+}
+
+}	// End of bump namespace
@@ -0,0 +1,268 @@
+//
+//  DelimitedReader.cpp
+//  Bump
+//
+//  Created by Joseph Holub on 10/18/26.
+//  Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+// Bump headers
+#include <bump/DelimitedReader.h>
+
+namespace bump {
+
+DelimitedFormat::DelimitedFormat(char delimiter) :
+	delimiter(delimiter),
+	quote('"'),
+	escape('\0'),
+	skipEmptyLines(true)
+{
+	;
+}
+
+DelimitedReader::DelimitedReader(const DelimitedFormat& format, unsigned int bufferSize) :
+	_format(format),
+	_reader(bufferSize),
+	_fields(),
+	_fieldBuffer(),
+	_fieldRanges(),
+	_columnNames(),
+	_recordNumber(0)
+{
+	;
+}
+
+bool DelimitedReader::open(const String& path)
+{
+	close();
+	return _reader.open(path);
+}
+
+void DelimitedReader::close()
+{
+	_reader.close();
+	_fields.clear();
+	_fieldRanges.clear();
+	_columnNames.clear();
+	_recordNumber = 0;
+}
+
+bool DelimitedReader::isOpen() const
+{
+	return _reader.isOpen();
+}
+
+const DelimitedFormat& DelimitedReader::format() const
+{
+	return _format;
+}
+
+bool DelimitedReader::readHeader()
+{
+	if (!readFields())
+	{
+		return false;
+	}
+
+	_columnNames.clear();
+	for (std::size_t i = 0; i < _fields.size(); ++i)
+	{
+		_columnNames.push_back(_fields[i].toString());
+	}
+
+	return true;
+}
+
+bool DelimitedReader::readRecord()
+{
+	if (!readFields())
+	{
+		return false;
+	}
+
+	++_recordNumber;
+	return true;
+}
+
+unsigned long long DelimitedReader::recordNumber() const
+{
+	return _recordNumber;
+}
+
+unsigned long long DelimitedReader::lineNumber() const
+{
+	return _reader.lineNumber();
+}
+
+int DelimitedReader::errorCode() const
+{
+	return _reader.errorCode();
+}
+
+unsigned int DelimitedReader::numberOfFields() const
+{
+	return (unsigned int)_fields.size();
+}
+
+const StringViewList& DelimitedReader::fields() const
+{
+	return _fields;
+}
+
+StringView DelimitedReader::field(unsigned int column) const
+{
+	return column < _fields.size() ? _fields[column] : StringView();
+}
+
+const StringList& DelimitedReader::columnNames() const
+{
+	return _columnNames;
+}
+
+int DelimitedReader::columnIndex(const StringView& name) const
+{
+	for (std::size_t i = 0; i < _columnNames.size(); ++i)
+	{
+		if (StringView(_columnNames[i]) == name)
+		{
+			return (int)i;
+		}
+	}
+
+	return -1;
+}
+
+bool DelimitedReader::toLongLong(int column, long long& value) const
+{
+	if (column < 0 || (std::size_t)column >= _fields.size())
+	{
+		return false;
+	}
+
+	return _fields[column].toLongLong(value);
+}
+
+bool DelimitedReader::toDouble(int column, double& value) const
+{
+	if (column < 0 || (std::size_t)column >= _fields.size())
+	{
+		return false;
+	}
+
+	return _fields[column].toDouble(value);
+}
+
+bool DelimitedReader::readFields()
+{
+	_fields.clear();
+
+	StringView line;
+	do
+	{
+		if (!_reader.readLine(line))
+		{
+			return false;
+		}
+	}
+	while (line.isEmpty() && _format.skipEmptyLines);
+
+	// Most records hold no quote or escape characters, so their fields are split straight out of the read buffer
+	bool has_quote = _format.quote != '\0' && line.indexOf(_format.quote) != StringView::npos;
+	bool has_escape = _format.escape != '\0' && line.indexOf(_format.escape) != StringView::npos;
+	if (!has_quote && !has_escape)
+	{
+		line.split(_format.delimiter, _fields);
+		return true;
+	}
+
+	readQuotedFields(line);
+	return true;
+}
+
+void DelimitedReader::readQuotedFields(StringView line)
+{
+	_fieldBuffer.clear();
+	_fieldRanges.clear();
+
+	// Every character is copied out of the line as it is unquoted, so reading the next line never invalidates the record
+	const char delimiter = _format.delimiter;
+	const char quote = _format.quote;
+	const char escape = _format.escape;
+	std::size_t field_start = 0;
+	bool is_field_start = true;
+	bool is_quoted = false;
+	while (true)
+	{
+		bool continues = is_quoted;
+		const char* data = line.data();
+		const std::size_t length = line.length();
+		for (std::size_t i = 0; i < length; ++i)
+		{
+			const char character = data[i];
+			if (escape != '\0' && character == escape)
+			{
+				// An escape at the end of a line makes the newline itself part of the field
+				if (i + 1 == length)
+				{
+					continues = true;
+				}
+				else
+				{
+					_fieldBuffer += data[++i];
+				}
+				is_field_start = false;
+			}
+			else if (is_quoted)
+			{
+				if (character != quote)
+				{
+					_fieldBuffer += character;
+				}
+				else if (i + 1 < length && data[i + 1] == quote)
+				{
+					_fieldBuffer += quote;
+					++i;
+				}
+				else
+				{
+					is_quoted = false;
+					continues = false;
+				}
+			}
+			else if (character == delimiter)
+			{
+				_fieldRanges.push_back(std::make_pair(field_start, _fieldBuffer.length() - field_start));
+				field_start = _fieldBuffer.length();
+				is_field_start = true;
+			}
+			else if (is_field_start && quote != '\0' && character == quote)
+			{
+				is_quoted = true;
+				continues = true;
+				is_field_start = false;
+			}
+			else
+			{
+				_fieldBuffer += character;
+				is_field_start = false;
+			}
+		}
+
+		// An open quote or a trailing escape carries the record onto the next line, or ends it with the file
+		if (!continues || !_reader.readLine(line))
+		{
+			break;
+		}
+		_fieldBuffer += '\n';
+	}
+	_fieldRanges.push_back(std::make_pair(field_start, _fieldBuffer.length() - field_start));
+
+	// The buffer no longer grows, so the fields can finally point into it
+	const char* buffer = _fieldBuffer.data();
+	for (std::size_t i = 0; i < _fieldRanges.size(); ++i)
+	{
+		_fields.push_back(StringView(buffer + _fieldRanges[i].first, _fieldRanges[i].second));
+	}
+}
+
+}	// End of bump namespace
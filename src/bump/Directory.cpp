@@ -0,0 +1,52 @@
+//
+//  Directory.cpp
+//  Bump
+//
+//  Created by Joseph Holub on 10/18/26.
+//  Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+// Bump headers
+#include <bump/Directory.h>
+
+namespace bump {
+
+Directory::Status::Status() :
+	type(FileSystem::OTHER_ENTRY),
+	size(0),
+	mode(0),
+	ownerId(0),
+	groupId(0),
+	modifiedDate(0)
+{
+	;
+}
+
+Directory::Directory() :
+	_path(),
+	_descriptor(-1)
+{
+	;
+}
+
+Directory::~Directory()
+{
+	close();
+}
+
+bool Directory::isOpen() const
+{
+	return _descriptor >= 0;
+}
+
+const String& Directory::path() const
+{
+	return _path;
+}
+
+int Directory::descriptor() const
+{
+	return _descriptor;
+}
+
+}	// End of bump namespace
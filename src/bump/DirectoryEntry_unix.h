@@ -0,0 +1,90 @@
+//
+//  DirectoryEntry_unix.h
+//  Bump
+//
+//  Created by Joseph Holub on 10/18/26.
+//  Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+#ifndef BUMP_DIRECTORY_ENTRY_UNIX_H
+#define BUMP_DIRECTORY_ENTRY_UNIX_H
+
+// Bump headers
+#include <bump/FileSystem.h>
+
+// Unix headers
+#include <dirent.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+namespace bump {
+
+// Private helpers shared by the unix directory listing code in Directory and FileSystem
+
+/**
+ * Returns the entry type matching the st_mode of an lstat result.
+ */
+inline FileSystem::EntryType entryTypeFromMode(mode_t mode)
+{
+	if (S_ISREG(mode))
+	{
+		return FileSystem::FILE_ENTRY;
+	}
+	else if (S_ISDIR(mode))
+	{
+		return FileSystem::DIRECTORY_ENTRY;
+	}
+	else if (S_ISLNK(mode))
+	{
+		return FileSystem::SYMBOLIC_LINK_ENTRY;
+	}
+
+	return FileSystem::OTHER_ENTRY;
+}
+
+/**
+ * Returns whether the directory entry name is "." or "..".
+ */
+inline bool isDotOrDotDot(const char* name)
+{
+	return name[0] == '.' && (name[1] == '\0' || (name[1] == '.' && name[2] == '\0'));
+}
+
+/**
+ * Reads the entry type stored in the directory entry itself.
+ *
+ * @return False if the file system does not store types in its directory entries, in
+ *         which case the caller has to lstat the entry instead.
+ */
+inline bool entryTypeFromDirectoryEntry(const struct dirent* item, FileSystem::EntryType& type)
+{
+#ifdef DT_UNKNOWN
+	if (item->d_type != DT_UNKNOWN)
+	{
+		type = FileSystem::OTHER_ENTRY;
+		if (item->d_type == DT_REG)
+		{
+			type = FileSystem::FILE_ENTRY;
+		}
+		else if (item->d_type == DT_DIR)
+		{
+			type = FileSystem::DIRECTORY_ENTRY;
+		}
+		else if (item->d_type == DT_LNK)
+		{
+			type = FileSystem::SYMBOLIC_LINK_ENTRY;
+		}
+
+		return true;
+	}
+#else
+	(void)item;
+	(void)type;
+#endif
+
+	return false;
+}
+
+}	// End of bump namespace
+
+#endif	// End of BUMP_DIRECTORY_ENTRY_UNIX_H
@@ -0,0 +1,198 @@
+//
+//  Directory_unix.cpp
+//  Bump
+//
+//  Created by Joseph Holub on 10/18/26.
+//  Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+// Bump headers
+#include <bump/Directory.h>
+
+// C headers
+#include <stdio.h>
+
+// Unix headers
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+// Private headers
+#include "DirectoryEntry_unix.h"
+
+namespace bump {
+
+bool Directory::open(const String& path)
+{
+	int descriptor = ::open(path.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+	if (descriptor < 0)
+	{
+		return false;
+	}
+
+	close();
+	_descriptor = descriptor;
+	_path = path;
+
+	return true;
+}
+
+bool Directory::open(const Directory& parent, const String& name)
+{
+	if (!parent.isOpen())
+	{
+		errno = EBADF;
+		return false;
+	}
+
+	// Refuse symbolic links so the child is always a real directory inside the parent
+	int descriptor = openat(parent._descriptor, name.c_str(), O_RDONLY | O_DIRECTORY | O_NOFOLLOW | O_CLOEXEC);
+	if (descriptor < 0)
+	{
+		return false;
+	}
+
+	// The parent may be this directory, so build the new path before closing it
+	String path = FileSystem::join(parent._path, name);
+	close();
+	_descriptor = descriptor;
+	_path = path;
+
+	return true;
+}
+
+void Directory::close()
+{
+	if (_descriptor >= 0)
+	{
+		::close(_descriptor);
+		_descriptor = -1;
+	}
+}
+
+bool Directory::createFile(const String& name) const
+{
+	int descriptor = openat(_descriptor, name.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0666);
+	if (descriptor < 0)
+	{
+		return false;
+	}
+
+	return ::close(descriptor) == 0;
+}
+
+bool Directory::removeFile(const String& name) const
+{
+	return unlinkat(_descriptor, name.c_str(), 0) == 0;
+}
+
+bool Directory::createDirectory(const String& name) const
+{
+	return mkdirat(_descriptor, name.c_str(), 0777) == 0;
+}
+
+bool Directory::removeDirectory(const String& name) const
+{
+	return unlinkat(_descriptor, name.c_str(), AT_REMOVEDIR) == 0;
+}
+
+bool Directory::rename(const String& name, const String& newName) const
+{
+	return renameat(_descriptor, name.c_str(), _descriptor, newName.c_str()) == 0;
+}
+
+bool Directory::rename(const String& name, const Directory& destination, const String& newName) const
+{
+	return renameat(_descriptor, name.c_str(), destination._descriptor, newName.c_str()) == 0;
+}
+
+bool Directory::stat(const String& name, Status& status, bool followSymbolicLinks) const
+{
+	struct stat info;
+	if (fstatat(_descriptor, name.c_str(), &info, followSymbolicLinks ? 0 : AT_SYMLINK_NOFOLLOW) != 0)
+	{
+		return false;
+	}
+
+	status.type = entryTypeFromMode(info.st_mode);
+	status.size = info.st_size;
+	status.mode = info.st_mode;
+	status.ownerId = info.st_uid;
+	status.groupId = info.st_gid;
+	status.modifiedDate = info.st_mtime;
+
+	return true;
+}
+
+bool Directory::list(EntryList& entries) const
+{
+	// Reopen the directory so concurrent listings do not share a read position
+	int descriptor = openat(_descriptor, ".", O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+	if (descriptor < 0)
+	{
+		return false;
+	}
+
+	DIR* directory = fdopendir(descriptor);
+	if (directory == NULL)
+	{
+		int error_code = errno;
+		::close(descriptor);
+		errno = error_code;
+		return false;
+	}
+
+	int error_code = 0;
+	while (true)
+	{
+		errno = 0;
+		struct dirent* item = readdir(directory);
+		if (item == NULL)
+		{
+			if (errno != 0)
+			{
+				error_code = errno;
+			}
+			break;
+		}
+
+		// Skip the dot and dot-dot entries
+		const char* name = item->d_name;
+		if (isDotOrDotDot(name))
+		{
+			continue;
+		}
+
+		Entry entry;
+		entry.name = name;
+		entry.type = FileSystem::OTHER_ENTRY;
+
+		if (!entryTypeFromDirectoryEntry(item, entry.type))
+		{
+			// The file system does not store types in its directory entries
+			struct stat info;
+			if (fstatat(descriptor, name, &info, AT_SYMLINK_NOFOLLOW) != 0)
+			{
+				// Objects removed since the directory was read are simply skipped
+				if (errno != ENOENT)
+				{
+					error_code = errno;
+				}
+				continue;
+			}
+			entry.type = entryTypeFromMode(info.st_mode);
+		}
+
+		entries.push_back(entry);
+	}
+
+	closedir(directory);
+	errno = error_code;
+
+	return error_code == 0;
+}
+
+}	// End of bump namespace
@@ -0,0 +1,80 @@
+//
+//  Directory_win.cpp
+//  Bump
+//
+//  Created by Joseph Holub on 10/18/26.
+//  Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+// Bump headers
+#include <bump/Directory.h>
+#include <bump/NotImplementedError.h>
+
+namespace bump {
+
+bool Directory::open(const String& path)
+{
+	String msg = "The bump::Directory::open() method is not implemented on Windows";
+	throw NotImplementedError(msg, BUMP_LOCATION);
+}
+
+bool Directory::open(const Directory& parent, const String& name)
+{
+	String msg = "The bump::Directory::open() method is not implemented on Windows";
+	throw NotImplementedError(msg, BUMP_LOCATION);
+}
+
+void Directory::close()
+{
+	;
+}
+
+bool Directory::createFile(const String& name) const
+{
+	String msg = "The bump::Directory::createFile() method is not implemented on Windows";
+	throw NotImplementedError(msg, BUMP_LOCATION);
+}
+
+bool Directory::removeFile(const String& name) const
+{
+	String msg = "The bump::Directory::removeFile() method is not implemented on Windows";
+	throw NotImplementedError(msg, BUMP_LOCATION);
+}
+
+bool Directory::createDirectory(const String& name) const
+{
+	String msg = "The bump::Directory::createDirectory() method is not implemented on Windows";
+	throw NotImplementedError(msg, BUMP_LOCATION);
+}
+
+bool Directory::removeDirectory(const String& name) const
+{
+	String msg = "The bump::Directory::removeDirectory() method is not implemented on Windows";
+	throw NotImplementedError(msg, BUMP_LOCATION);
+}
+
+bool Directory::rename(const String& name, const String& newName) const
+{
+	String msg = "The bump::Directory::rename() method is not implemented on Windows";
+	throw NotImplementedError(msg, BUMP_LOCATION);
+}
+
+bool Directory::rename(const String& name, const Directory& destination, const String& newName) const
+{
+	String msg = "The bump::Directory::rename() method is not implemented on Windows";
+	throw NotImplementedError(msg, BUMP_LOCATION);
+}
+
+bool Directory::stat(const String& name, Status& status, bool followSymbolicLinks) const
+{
+	String msg = "The bump::Directory::stat() method is not implemented on Windows";
+	throw NotImplementedError(msg, BUMP_LOCATION);
+}
+
+bool Directory::list(EntryList& entries) const
+{
+	String msg = "The bump::Directory::list() method is not implemented on Windows";
+	throw NotImplementedError(msg, BUMP_LOCATION);
+}
+
+}	// End of bump namespace
@@ -16,8 +16,19 @@
 #include <bump/FileSystem.h>
 #include <bump/FileSystemError.h>
 
+// C headers
+#include <errno.h>
+
 namespace bump {
 
+static bool reportFailure(const boost::system::error_code& error, FileSystemStatus& status)
+{
+	// Leave errno set so callers can tell apart the failures sharing a status
+	errno = error.value();
+	status = fileSystemStatusFromErrorCode(error.value());
+	return false;
+}
+
 FileInfo::FileInfo(const String& path)
 {
 	_path = boost::filesystem::path(path.c_str()).make_preferred();
@@ -73,6 +84,34 @@ unsigned long long FileInfo::fileSize() const
 	return boost::filesystem::file_size(path);
 }
 
+bool FileInfo::fileSize(unsigned long long& size, FileSystemStatus& status) const
+{
+	// A single status call follows symbolic links and reports missing paths through the error code
+	boost::system::error_code error;
+	boost::filesystem::file_status file_status = boost::filesystem::status(_path, error);
+	if (error)
+	{
+		return reportFailure(error, status);
+	}
+
+	if (!boost::filesystem::is_regular_file(file_status))
+	{
+		errno = boost::filesystem::is_directory(file_status) ? EISDIR : EINVAL;
+		status = PATH_NOT_FILE;
+		return false;
+	}
+
+	unsigned long long file_size = boost::filesystem::file_size(_path, error);
+	if (error)
+	{
+		return reportFailure(error, status);
+	}
+
+	size = file_size;
+	status = FILE_SYSTEM_SUCCESS;
+	return true;
+}
+
 bool FileInfo::isAbsolute() const
 {
 	return _path.has_root_path();
@@ -116,6 +155,27 @@ bool FileInfo::isEmpty() const
 	}
 }
 
+bool FileInfo::isEmpty(bool& empty, FileSystemStatus& status) const
+{
+	// Boost's is_empty() does not report missing paths with their own error code, so check them first
+	boost::system::error_code error;
+	boost::filesystem::status(_path, error);
+	if (error)
+	{
+		return reportFailure(error, status);
+	}
+
+	bool is_empty = boost::filesystem::is_empty(_path, error);
+	if (error)
+	{
+		return reportFailure(error, status);
+	}
+
+	empty = is_empty;
+	status = FILE_SYSTEM_SUCCESS;
+	return true;
+}
+
 bool FileInfo::isHidden() const
 {
 	// It is not a hidden file if it isn't even a file
@@ -145,6 +205,20 @@ String FileInfo::canonicalPath() const
 	return bump::FileSystem::convertToUnixPath(path);
 }
 
+bool FileInfo::canonicalPath(String& path, FileSystemStatus& status) const
+{
+	boost::system::error_code error;
+	boost::filesystem::path canonical_path = boost::filesystem::canonical(_path, error);
+	if (error)
+	{
+		return reportFailure(error, status);
+	}
+
+	path = bump::FileSystem::convertToUnixPath(canonical_path.string());
+	status = FILE_SYSTEM_SUCCESS;
+	return true;
+}
+
 String FileInfo::parentPath() const
 {
 	String path = _path.parent_path().string();
@@ -251,6 +325,20 @@ std::time_t FileInfo::modifiedDate() const
 	return boost::filesystem::last_write_time(_path);
 }
 
+bool FileInfo::modifiedDate(std::time_t& date, FileSystemStatus& status) const
+{
+	boost::system::error_code error;
+	std::time_t modified_date = boost::filesystem::last_write_time(_path, error);
+	if (error)
+	{
+		return reportFailure(error, status);
+	}
+
+	date = modified_date;
+	status = FILE_SYSTEM_SUCCESS;
+	return true;
+}
+
 void FileInfo::validatePath() const
 {
 	try
@@ -14,10 +14,10 @@
 #include <bump/FileInfo.h>
 #include <bump/FileSystem.h>
 #include <bump/FileSystemError.h>
+#include <bump/IdentityCache.h>
 
 // Unix headers
-#include <pwd.h>
-#include <grp.h>
+#include <errno.h>
 #include <sys/stat.h>
 
 namespace bump {
@@ -30,11 +30,8 @@ bool FileInfo::isReadableByUser() const
 {
 	// Figure out if we're the owner of the file
 	String owner;
-	try
-	{
-		owner = this->owner();
-	}
-	catch (const bump::FileSystemError& /*e*/)
+	FileSystemStatus status;
+	if (!this->owner(owner, status))
 	{
 		return false;
 	}
@@ -55,11 +52,8 @@ bool FileInfo::isWritableByUser() const
 {
 	// Figure out if we're the owner of the file
 	String owner;
-	try
-	{
-		owner = this->owner();
-	}
-	catch (const bump::FileSystemError& /*e*/)
+	FileSystemStatus status;
+	if (!this->owner(owner, status))
 	{
 		return false;
 	}
@@ -80,11 +74,8 @@ bool FileInfo::isExecutableByUser() const
 {
 	// Figure out if we're the owner of the file
 	String owner;
-	try
-	{
-		owner = this->owner();
-	}
-	catch (const bump::FileSystemError& /*e*/)
+	FileSystemStatus status;
+	if (!this->owner(owner, status))
 	{
 		return false;
 	}
@@ -187,13 +178,26 @@ String FileInfo::owner() const
 	// Make sure we have a valid path
 	validatePath();
 
-	// Since we're on unix, use the native unix calls to dig out the username
-	String filepath = this->canonicalPath();
+	// Since we're on unix, use the native unix calls to dig out the user id and resolve it through the cache
 	struct stat info;
-	stat(filepath.c_str(), &info);
-	struct passwd* password_uid = getpwuid(info.st_uid);
+	stat(_path.c_str(), &info);
 
-	return password_uid->pw_name;
+	return IdentityCache::instance()->userName(info.st_uid);
+}
+
+bool FileInfo::owner(String& name, FileSystemStatus& status) const
+{
+	// A single stat call both validates the path and fetches the user id
+	struct stat info;
+	if (stat(_path.c_str(), &info) != 0)
+	{
+		status = fileSystemStatusFromErrorCode(errno);
+		return false;
+	}
+
+	name = IdentityCache::instance()->userName(info.st_uid);
+	status = FILE_SYSTEM_SUCCESS;
+	return true;
 }
 
 unsigned int FileInfo::ownerId() const
@@ -202,12 +206,24 @@ unsigned int FileInfo::ownerId() const
 	validatePath();
 
 	// Since we're on unix, use the native unix calls to dig out the user id
-	String filepath = this->canonicalPath();
 	struct stat info;
-	stat(filepath.c_str(), &info);
-	struct passwd* password_uid = getpwuid(info.st_uid);
+	stat(_path.c_str(), &info);
+
+	return info.st_uid;
+}
+
+bool FileInfo::ownerId(unsigned int& id, FileSystemStatus& status) const
+{
+	struct stat info;
+	if (stat(_path.c_str(), &info) != 0)
+	{
+		status = fileSystemStatusFromErrorCode(errno);
+		return false;
+	}
 
-	return password_uid->pw_uid;
+	id = info.st_uid;
+	status = FILE_SYSTEM_SUCCESS;
+	return true;
 }
 
 String FileInfo::group() const
@@ -215,13 +231,25 @@ String FileInfo::group() const
 	// Make sure we have a valid path
 	validatePath();
 
-	// Since we're on unix, use the native unix calls to dig out the group name
-	String filepath = this->canonicalPath();
+	// Since we're on unix, use the native unix calls to dig out the group id and resolve it through the cache
 	struct stat info;
-	stat(filepath.c_str(), &info);
-	struct group* group_uid = getgrgid(info.st_gid);
+	stat(_path.c_str(), &info);
 
-	return group_uid->gr_name;
+	return IdentityCache::instance()->groupName(info.st_gid);
+}
+
+bool FileInfo::group(String& name, FileSystemStatus& status) const
+{
+	struct stat info;
+	if (stat(_path.c_str(), &info) != 0)
+	{
+		status = fileSystemStatusFromErrorCode(errno);
+		return false;
+	}
+
+	name = IdentityCache::instance()->groupName(info.st_gid);
+	status = FILE_SYSTEM_SUCCESS;
+	return true;
 }
 
 unsigned int FileInfo::groupId() const
@@ -230,12 +258,24 @@ unsigned int FileInfo::groupId() const
 	validatePath();
 
 	// Since we're on unix, use the native unix calls to dig out the group id
-	String filepath = this->canonicalPath();
 	struct stat info;
-	stat(filepath.c_str(), &info);
-	struct group* group_uid = getgrgid(info.st_gid);
+	stat(_path.c_str(), &info);
+
+	return info.st_gid;
+}
+
+bool FileInfo::groupId(unsigned int& id, FileSystemStatus& status) const
+{
+	struct stat info;
+	if (stat(_path.c_str(), &info) != 0)
+	{
+		status = fileSystemStatusFromErrorCode(errno);
+		return false;
+	}
 
-	return group_uid->gr_gid;
+	id = info.st_gid;
+	status = FILE_SYSTEM_SUCCESS;
+	return true;
 }
 
 }	// End of bump namespace
@@ -94,20 +94,44 @@ String FileInfo::owner() const
 	throw NotImplementedError(msg, BUMP_LOCATION);
 }
 
+bool FileInfo::owner(String& name, FileSystemStatus& status) const
+{
+	String msg = "The bump::FileInfo::owner() method is not implemented on Windows";
+	throw NotImplementedError(msg, BUMP_LOCATION);
+}
+
 unsigned int FileInfo::ownerId() const
 {
 	String msg = "The bump::FileInfo::ownerId() method is not implemented on Windows";
 	throw NotImplementedError(msg, BUMP_LOCATION);
 }
 
+bool FileInfo::ownerId(unsigned int& id, FileSystemStatus& status) const
+{
+	String msg = "The bump::FileInfo::ownerId() method is not implemented on Windows";
+	throw NotImplementedError(msg, BUMP_LOCATION);
+}
+
 String FileInfo::group() const
 {
 	String msg = "The bump::FileInfo::group() method is not implemented on Windows";
 	throw NotImplementedError(msg, BUMP_LOCATION);
 }
 
+bool FileInfo::group(String& name, FileSystemStatus& status) const
+{
+	String msg = "The bump::FileInfo::group() method is not implemented on Windows";
+	throw NotImplementedError(msg, BUMP_LOCATION);
+}
+
 unsigned int FileInfo::groupId() const
 {	
 	String msg = "The bump::FileInfo::groupId() method is not implemented on Windows";
 	throw NotImplementedError(msg, BUMP_LOCATION);
 }
+
+bool FileInfo::groupId(unsigned int& id, FileSystemStatus& status) const
+{
+	String msg = "The bump::FileInfo::groupId() method is not implemented on Windows";
+	throw NotImplementedError(msg, BUMP_LOCATION);
+}
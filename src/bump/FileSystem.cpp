@@ -11,150 +11,270 @@
 #include <boost/foreach.hpp>
 
 // Bump headers
+#include <bump/AtomicFileWriter.h>
 #include <bump/FileSystem.h>
 #include <bump/FileSystemError.h>
+#include <bump/InvalidArgumentError.h>
+#include <bump/Path.h>
 
 // C++ headers
+#include <algorithm>
 #include <fstream>
+#include <sstream>
+
+// C headers
+#include <errno.h>
 
 namespace bump {
 
 namespace FileSystem {
 
-//====================================================================================
-//                               Path Coversion Methods
-//====================================================================================
+WalkOptions::WalkOptions() :
+	numberOfThreads(0),
+	maximumDepth(-1),
+	entryTypes(ALL_ENTRIES),
+	pattern(),
+	symbolicLinkPolicy(REPORT_SYMBOLIC_LINKS),
+	batchSize(1024),
+	errorCallback()
+{
+	;
+}
 
-String convertToWindowsPath(String path)
+CopyProgress::CopyProgress() :
+	filesCopied(0),
+	directoriesCopied(0),
+	symbolicLinksCopied(0),
+	bytesCopied(0),
+	errors(0),
+	path()
 {
-	// Replace a forward slash next to a backward slash with a forward slash
-	String converted = path.replace("/\\", "/");
+	;
+}
 
-	// Replace a backward slash next to a forward slash with a forward slash
-	converted = path.replace("\\/", "/");
+CopyOptions::CopyOptions() :
+	numberOfThreads(0),
+	cloneFiles(true),
+	preservePermissions(true),
+	preserveModifiedDates(true),
+	progressCallback(),
+	errorCallback()
+{
+	;
+}
 
-	// Replace all duplicate forward slashes with a single forward slash
-	converted = path.replace("///", "/");
-	converted = path.replace("//", "/");
+RemoveProgress::RemoveProgress() :
+	filesRemoved(0),
+	directoriesRemoved(0),
+	symbolicLinksRemoved(0),
+	errors(0),
+	path()
+{
+	;
+}
 
-	// Replace all duplicate backward slashes with a single backward slash
-	converted = path.replace("\\\\\\", "\\");
-	converted = path.replace("\\\\", "\\");
+RemoveOptions::RemoveOptions() :
+	numberOfThreads(0),
+	removeInBackground(false),
+	progressCallback(),
+	errorCallback(),
+	completionCallback()
+{
+	;
+}
 
-	// Convert all forward slashes to backward slashes
-	converted = path.replace("/", "\\");
+FileCopyOptions::FileCopyOptions() :
+	cloneFile(true),
+	preserveSparseFiles(true),
+	preservePermissions(true),
+	preserveModifiedDate(false),
+	bufferSize(1024 * 1024),
+	readAheadBuffers(4),
+	chunkSize(64 * 1024 * 1024),
+	progressCallback()
+{
+	;
+}
 
-	return converted;
+FileCopyResult::FileCopyResult() :
+	succeeded(false),
+	cancelled(false),
+	errorCode(0),
+	method(NO_COPY),
+	bytesCopied(0),
+	secondsElapsed(0.0),
+	bytesPerSecond(0.0)
+{
+	;
 }
 
-String convertToUnixPath(String path)
+unsigned int StatBatchResult::size() const
+{
+	return errorCodes.size();
+}
+
+bool StatBatchResult::exists(unsigned int index) const
+{
+	return errorCodes.at(index) == 0;
+}
+
+SnapshotEntry::SnapshotEntry() :
+	path(),
+	type(OTHER_ENTRY),
+	size(0),
+	modifiedDate(0),
+	modifiedNanoseconds(0),
+	mode(0),
+	hash()
+{
+	;
+}
+
+Snapshot::Snapshot() :
+	rootPath(),
+	hashesContents(false),
+	entries()
+{
+	;
+}
+
+static bool isEntryBefore(const SnapshotEntry& entry, const String& path)
+{
+	return entry.path < path;
+}
+
+const SnapshotEntry* Snapshot::find(const String& path) const
+{
+	SnapshotEntryList::const_iterator iter = std::lower_bound(entries.begin(), entries.end(), path, &isEntryBefore);
+	if (iter != entries.end() && iter->path == path)
+	{
+		return &(*iter);
+	}
+
+	return NULL;
+}
+
+bool SnapshotDiff::isEmpty() const
 {
-	// Replace a forward slash next to a backward slash with a forward slash
-	String converted = path.replace("/\\", "/");
+	return added.empty() && removed.empty() && modified.empty();
+}
 
-	// Replace a backward slash next to a forward slash with a forward slash
-	converted = path.replace("\\/", "/");
+DiskUsageEntry::DiskUsageEntry() :
+	path(),
+	size(0),
+	allocatedBytes(0)
+{
+	;
+}
 
-	// Replace all duplicate forward slashes with a single forward slash
-	converted = path.replace("///", "/");
-	converted = path.replace("//", "/");
+DiskUsage::DiskUsage() :
+	logicalBytes(0),
+	allocatedBytes(0),
+	files(0),
+	directories(0),
+	symbolicLinks(0),
+	others(0),
+	hardLinks(0),
+	errors(0),
+	largestEntries()
+{
+	;
+}
 
-	// Replace all duplicate backward slashes with a single backward slash
-	converted = path.replace("\\\\\\", "\\");
-	converted = path.replace("\\\\", "\\");
+DiskUsageOptions::DiskUsageOptions() :
+	numberOfThreads(0),
+	numberOfLargestEntries(10),
+	stayOnFileSystem(false)
+{
+	;
+}
 
-	// Convert all backward slashes to forward slashes
-	converted = path.replace("\\", "/");
+//====================================================================================
+//                               Path Coversion Methods
+//====================================================================================
 
-	return converted;
+static void normalizeSeparators(std::string& path, char separator)
+{
+	// Compact the path in place, turning every run of mixed slashes into a single separator
+	std::size_t length = 0;
+	for (std::size_t i = 0; i < path.size(); ++i)
+	{
+		char character = path[i];
+		if (character == '/' || character == '\\')
+		{
+			if (length > 0 && path[length - 1] == separator)
+			{
+				continue;
+			}
+			character = separator;
+		}
+		path[length++] = character;
+	}
+	path.resize(length);
+}
+
+String convertToWindowsPath(String path)
+{
+	normalizeSeparators(path, '\\');
+	return path;
+}
+
+String convertToUnixPath(String path)
+{
+	normalizeSeparators(path, '/');
+	return path;
 }
 
 String join(const String& path1, const String& path2)
 {
-	boost::filesystem::path joined_path(path1.c_str());
-	joined_path /= path2.c_str();
-	return convertToUnixPath(joined_path.string());
+	StringView components[] = {path1, path2};
+	return Path::join(components, 2).toString();
 }
 
 String join(const String& path1, const String& path2, const String& path3)
 {
-	boost::filesystem::path joined_path(path1.c_str());
-	joined_path /= path2.c_str();
-	joined_path /= path3.c_str();
-	return convertToUnixPath(joined_path.string());
+	StringView components[] = {path1, path2, path3};
+	return Path::join(components, 3).toString();
 }
 
 String join(const String& path1, const String& path2, const String& path3, const String& path4)
 {
-	boost::filesystem::path joined_path(path1.c_str());
-	joined_path /= path2.c_str();
-	joined_path /= path3.c_str();
-	joined_path /= path4.c_str();
-	return convertToUnixPath(joined_path.string());
+	StringView components[] = {path1, path2, path3, path4};
+	return Path::join(components, 4).toString();
 }
 
 String join(const String& path1, const String& path2, const String& path3, const String& path4, const String& path5)
 {
-	boost::filesystem::path joined_path(path1.c_str());
-	joined_path /= path2.c_str();
-	joined_path /= path3.c_str();
-	joined_path /= path4.c_str();
-	joined_path /= path5.c_str();
-	return convertToUnixPath(joined_path.string());
+	StringView components[] = {path1, path2, path3, path4, path5};
+	return Path::join(components, 5).toString();
 }
 
 String join(const String& path1, const String& path2, const String& path3, const String& path4, const String& path5,
 			const String& path6)
 {
-	boost::filesystem::path joined_path(path1.c_str());
-	joined_path /= path2.c_str();
-	joined_path /= path3.c_str();
-	joined_path /= path4.c_str();
-	joined_path /= path5.c_str();
-	joined_path /= path6.c_str();
-	return convertToUnixPath(joined_path.string());
+	StringView components[] = {path1, path2, path3, path4, path5, path6};
+	return Path::join(components, 6).toString();
 }
 
 String join(const String& path1, const String& path2, const String& path3, const String& path4, const String& path5,
 			const String& path6, const String& path7)
 {
-	boost::filesystem::path joined_path(path1.c_str());
-	joined_path /= path2.c_str();
-	joined_path /= path3.c_str();
-	joined_path /= path4.c_str();
-	joined_path /= path5.c_str();
-	joined_path /= path6.c_str();
-	joined_path /= path7.c_str();
-	return convertToUnixPath(joined_path.string());
+	StringView components[] = {path1, path2, path3, path4, path5, path6, path7};
+	return Path::join(components, 7).toString();
 }
 
 String join(const String& path1, const String& path2, const String& path3, const String& path4, const String& path5,
 			const String& path6, const String& path7, const String& path8)
 {
-	boost::filesystem::path joined_path(path1.c_str());
-	joined_path /= path2.c_str();
-	joined_path /= path3.c_str();
-	joined_path /= path4.c_str();
-	joined_path /= path5.c_str();
-	joined_path /= path6.c_str();
-	joined_path /= path7.c_str();
-	joined_path /= path8.c_str();
-	return convertToUnixPath(joined_path.string());
+	StringView components[] = {path1, path2, path3, path4, path5, path6, path7, path8};
+	return Path::join(components, 8).toString();
 }
 
 String join(const String& path1, const String& path2, const String& path3, const String& path4, const String& path5,
 			const String& path6, const String& path7, const String& path8, const String& path9)
 {
-	boost::filesystem::path joined_path(path1.c_str());
-	joined_path /= path2.c_str();
-	joined_path /= path3.c_str();
-	joined_path /= path4.c_str();
-	joined_path /= path5.c_str();
-	joined_path /= path6.c_str();
-	joined_path /= path7.c_str();
-	joined_path /= path8.c_str();
-	joined_path /= path9.c_str();
-	return convertToUnixPath(joined_path.string());
+	StringView components[] = {path1, path2, path3, path4, path5, path6, path7, path8, path9};
+	return Path::join(components, 9).toString();
 }
 
 //====================================================================================
@@ -215,6 +335,59 @@ bool isSymbolicLink(const String& path)
 	return path_info.isSymbolicLink();
 }
 
+//====================================================================================
+//                                 Directory Helpers
+//====================================================================================
+
+static bool listDirectory(const String& path, const GlobPattern* pattern, StringSet& paths, FileSystemStatus& status)
+{
+	// Missing paths and non-directories are reported through the error code rather than thrown
+	boost::system::error_code error;
+	boost::filesystem::directory_iterator iter(boost::filesystem::path(path.c_str()), error);
+	boost::filesystem::directory_iterator end_iter;
+
+	// Only match the raw names so filtering never queries the items themselves
+	bool is_single_component = (pattern == NULL || pattern->numberOfComponents() == 1);
+	while (!error && iter != end_iter)
+	{
+		const boost::filesystem::path& item = iter->path();
+		if (pattern == NULL || (is_single_component && pattern->matches(0, item.filename().string())))
+		{
+			paths.insert(convertToUnixPath(item.string()));
+		}
+		iter.increment(error);
+	}
+
+	if (error)
+	{
+		errno = error.value();
+		status = fileSystemStatusFromErrorCode(error.value());
+		return false;
+	}
+
+	status = FILE_SYSTEM_SUCCESS;
+	return true;
+}
+
+static void throwDirectoryListError(const String& path, FileSystemStatus status)
+{
+	String msg;
+	if (status == PATH_NOT_DIRECTORY)
+	{
+		msg = String("The following path is not a directory: %1").arg(path);
+	}
+	else if (status == PATH_NOT_FOUND)
+	{
+		msg = String("The following path is not valid: %1").arg(path);
+	}
+	else
+	{
+		msg = String("The following path could not be listed: %1").arg(path);
+	}
+
+	throw FileSystemError(msg, BUMP_LOCATION);
+}
+
 //====================================================================================
 //                                 Directory Methods
 //====================================================================================
@@ -254,17 +427,19 @@ bool removeDirectory(const String& path)
 	}
 }
 
-bool removeDirectoryAndContents(const String& path)
+bool copyDirectory(const String& source, const String& destination)
 {
-	// Fail if the path is not a directory
-	if (!FileInfo(path).isDirectory())
+	// Fail if the source path is not a directory
+	if (!FileInfo(source).isDirectory())
 	{
 		return false;
 	}
 
 	try
 	{
-		boost::filesystem::remove_all(boost::filesystem::path(path.c_str()));
+		boost::filesystem::path source_path(source.c_str());
+		boost::filesystem::path destination_path(destination.c_str());
+		boost::filesystem::copy(source_path, destination_path);
 		return true;
 	}
 	catch (const boost::filesystem::filesystem_error& /*e*/)
@@ -273,7 +448,7 @@ bool removeDirectoryAndContents(const String& path)
 	}
 }
 
-bool copyDirectory(const String& source, const String& destination)
+bool renameDirectory(const String& source, const String& destination)
 {
 	// Fail if the source path is not a directory
 	if (!FileInfo(source).isDirectory())
@@ -285,7 +460,7 @@ bool copyDirectory(const String& source, const String& destination)
 	{
 		boost::filesystem::path source_path(source.c_str());
 		boost::filesystem::path destination_path(destination.c_str());
-		boost::filesystem::copy(source_path, destination_path);
+		boost::filesystem::rename(source_path, destination_path);
 		return true;
 	}
 	catch (const boost::filesystem::filesystem_error& /*e*/)
@@ -294,174 +469,400 @@ bool copyDirectory(const String& source, const String& destination)
 	}
 }
 
-bool copyDirectoryAndContents(const String& source, const String& destination)
+StringList directoryList(const String& path)
 {
-	// Fail if the source path is not a directory
-	if (!FileInfo(source).isDirectory())
+	StringList directory_list;
+	FileSystemStatus status;
+	if (!directoryList(path, directory_list, status))
+	{
+		throwDirectoryListError(path, status);
+	}
+
+	return directory_list;
+}
+
+bool directoryList(const String& path, StringList& paths, FileSystemStatus& status)
+{
+	StringSet directory_set;
+	if (!listDirectory(path, NULL, directory_set, status))
 	{
 		return false;
 	}
 
-	// Create a FileInfo objects for the source and destination
-	FileInfo source_info(source);
-	FileInfo destination_info(destination);
+	paths.assign(directory_set.begin(), directory_set.end());
+	return true;
+}
+
+StringList directoryList(const String& path, const GlobPattern& pattern)
+{
+	StringList directory_list;
+	FileSystemStatus status;
+	if (!directoryList(path, pattern, directory_list, status))
+	{
+		throwDirectoryListError(path, status);
+	}
+
+	return directory_list;
+}
 
-	// Make sure the destination does not exist
-	if (destination_info.exists())
+bool directoryList(const String& path, const GlobPattern& pattern, StringList& paths, FileSystemStatus& status)
+{
+	StringSet directory_set;
+	if (!listDirectory(path, &pattern, directory_set, status))
 	{
 		return false;
 	}
 
-	// Create the destination directory
-	bool created_destination_directory = createFullDirectoryPath(destination);
-	if (!created_destination_directory)
+	paths.assign(directory_set.begin(), directory_set.end());
+	return true;
+}
+
+FileInfoList directoryInfoList(const String& path)
+{
+	FileInfoList directory_list;
+	FileSystemStatus status;
+	if (!directoryInfoList(path, directory_list, status))
+	{
+		throwDirectoryListError(path, status);
+	}
+
+	return directory_list;
+}
+
+bool directoryInfoList(const String& path, FileInfoList& infos, FileSystemStatus& status)
+{
+	StringSet directory_set;
+	if (!listDirectory(path, NULL, directory_set, status))
 	{
 		return false;
 	}
 
-	// Iterate through the local source directory
-	FileInfoList local_source_files = directoryInfoList(source);
-	BOOST_FOREACH (const FileInfo& local_source_file, local_source_files)
+	// Build a file info list from the sorted string set
+	infos.clear();
+	infos.reserve(directory_set.size());
+	BOOST_FOREACH (const String& item, directory_set)
 	{
-		bool copied_successfully;
+		infos.push_back(FileInfo(item));
+	}
 
-		// Attempt to copy all types of file system objects
-		if (local_source_file.isDirectory())
-		{
-			// Create the local destination directory path
-			String filename = local_source_file.filename();
-			String local_destination_directory = join(destination, filename);
+	return true;
+}
 
-			// Copy the local source directory to the local destination directory
-			copied_successfully = copyDirectoryAndContents(local_source_file.absolutePath(), local_destination_directory);
-		}
-		else if (local_source_file.isSymbolicLink())
-		{
-			// Create the local destination symbolic link
-			String filename = local_source_file.filename();
-			String local_destination_file = join(destination, filename);
+//====================================================================================
+//                                 Snapshot Helpers
+//====================================================================================
 
-			// Copy the local source symbolic link to the local destination
-			copied_successfully = copySymbolicLink(local_source_file.absolutePath(), local_destination_file);
-		}
-		else // local_source_info.isFile()
-		{
-			// Create the local destination filepath
-			String filename = local_source_file.filename();
-			String local_destination_file = join(destination, filename);
+// Identifies snapshot index files and the version of their layout
+static const char SNAPSHOT_MAGIC[8] = {'B', 'U', 'M', 'P', 'S', 'N', 'A', 'P'};
+static const unsigned long long SNAPSHOT_VERSION = 1;
+
+// The number of raw bytes in a sha1 hash
+static const unsigned int HASH_LENGTH = 20;
 
-			// Copy the local source file to the local destination
-			copied_successfully = copyFile(local_source_file.absolutePath(), local_destination_file);
+static void writeNumber(std::string& buffer, unsigned long long value)
+{
+	// Seven bits per byte with the high bit set on every byte but the last
+	while (value >= 0x80)
+	{
+		buffer.push_back((char)((value & 0x7F) | 0x80));
+		value >>= 7;
+	}
+	buffer.push_back((char)value);
+}
+
+static void writeBytes(std::string& buffer, const char* bytes, unsigned long long length)
+{
+	writeNumber(buffer, length);
+	buffer.append(bytes, length);
+}
+
+static int hexDigitValue(char digit)
+{
+	if (digit >= '0' && digit <= '9')
+	{
+		return digit - '0';
+	}
+	else if (digit >= 'a' && digit <= 'f')
+	{
+		return digit - 'a' + 10;
+	}
+	else if (digit >= 'A' && digit <= 'F')
+	{
+		return digit - 'A' + 10;
+	}
+
+	return -1;
+}
+
+/**
+ * Reads the values back out of a snapshot index, failing on anything out of bounds.
+ */
+struct SnapshotReader
+{
+	SnapshotReader(const std::string& data) : data(data), position(0), valid(true) {}
+
+	unsigned long long readNumber()
+	{
+		unsigned long long value = 0;
+		for (unsigned int shift = 0; shift < 64; shift += 7)
+		{
+			if (position >= data.size())
+			{
+				break;
+			}
+
+			unsigned char byte = (unsigned char)data[position++];
+			value |= (unsigned long long)(byte & 0x7F) << shift;
+			if ((byte & 0x80) == 0)
+			{
+				return value;
+			}
 		}
 
-		// Fail if we did not copy the file system object successfully
-		if (!copied_successfully)
+		valid = false;
+		return 0;
+	}
+
+	const char* readBytes(unsigned long long length)
+	{
+		if (!valid || length > data.size() - position)
 		{
-			return false;
+			valid = false;
+			return NULL;
 		}
+
+		const char* bytes = data.data() + position;
+		position += length;
+		return bytes;
 	}
 
-	return true;
-}
+	const std::string&		data;		/**< The entire contents of the index file. */
+	std::size_t				position;	/**< The offset of the next value to read. */
+	bool					valid;		/**< Whether every value read so far was in bounds. */
+};
 
-bool renameDirectory(const String& source, const String& destination)
+static bool isEntryModified(const SnapshotEntry& before, const SnapshotEntry& after)
 {
-	// Fail if the source path is not a directory
-	if (!FileInfo(source).isDirectory())
+	if (before.type != after.type || before.mode != after.mode)
+	{
+		return true;
+	}
+	else if (after.type == DIRECTORY_ENTRY)
 	{
 		return false;
 	}
-
-	try
+	else if (before.size != after.size)
 	{
-		boost::filesystem::path source_path(source.c_str());
-		boost::filesystem::path destination_path(destination.c_str());
-		boost::filesystem::rename(source_path, destination_path);
 		return true;
 	}
-	catch (const boost::filesystem::filesystem_error& /*e*/)
+	else if (!before.hash.empty() && !after.hash.empty())
 	{
-		return false;
+		return before.hash != after.hash;
 	}
+
+	return before.modifiedDate != after.modifiedDate || before.modifiedNanoseconds != after.modifiedNanoseconds;
 }
 
-StringList directoryList(const String& path)
+//====================================================================================
+//                                 Snapshot Methods
+//====================================================================================
+
+Snapshot snapshot(const String& path, bool hashContents)
 {
-	// Throw an exception if the path does not exist
-	if (!FileInfo(path).exists())
+	return snapshot(path, Snapshot(), hashContents);
+}
+
+SnapshotDiff diff(const Snapshot& before, const Snapshot& after)
+{
+	SnapshotDiff result;
+	const SnapshotEntryList& before_entries = before.entries;
+	const SnapshotEntryList& after_entries = after.entries;
+
+	// Both lists are sorted, so walk them side by side like a merge
+	unsigned int i = 0;
+	unsigned int j = 0;
+	while (i < before_entries.size() && j < after_entries.size())
 	{
-		String msg = String("The following path is not valid: %1").arg(path);
-		throw FileSystemError(msg, BUMP_LOCATION);
+		const String& before_path = before_entries[i].path;
+		const String& after_path = after_entries[j].path;
+		if (before_path < after_path)
+		{
+			result.removed.push_back(before_entries[i++].path);
+		}
+		else if (after_path < before_path)
+		{
+			result.added.push_back(after_entries[j++].path);
+		}
+		else
+		{
+			if (isEntryModified(before_entries[i], after_entries[j]))
+			{
+				result.modified.push_back(after_entries[j].path);
+			}
+			++i;
+			++j;
+		}
 	}
 
-	// Throw an exception if the path is not a directory
-	if (!FileInfo(path).isDirectory())
+	for (; i < before_entries.size(); ++i)
 	{
-		String msg = String("The following path is not a directory: %1").arg(path);
-		throw FileSystemError(msg, BUMP_LOCATION);
+		result.removed.push_back(before_entries[i].path);
+	}
+	for (; j < after_entries.size(); ++j)
+	{
+		result.added.push_back(after_entries[j].path);
 	}
 
-	// Create a path and two directory iterators
-	boost::filesystem::path directory_path(path.c_str());
-	boost::filesystem::directory_iterator iter(directory_path);
-	boost::filesystem::directory_iterator end_iter;
+	return result;
+}
 
-	// Iterate through the directory collecting all the item paths as strings
-	StringSet directory_set;
-	BOOST_FOREACH (const boost::filesystem::path& item, std::make_pair(iter, end_iter))
+bool writeSnapshot(const Snapshot& snapshot, const String& path)
+{
+	// Encode the whole index in memory so it is written with a single call
+	std::string buffer(SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+	writeNumber(buffer, SNAPSHOT_VERSION);
+	writeNumber(buffer, snapshot.hashesContents ? 1 : 0);
+	writeBytes(buffer, snapshot.rootPath.data(), snapshot.rootPath.size());
+	writeNumber(buffer, snapshot.entries.size());
+
+	const String* previous_path = NULL;
+	for (unsigned int i = 0; i < snapshot.entries.size(); ++i)
 	{
-		String unix_item_str = convertToUnixPath(item.string());
-		directory_set.insert(unix_item_str);
+		const SnapshotEntry& entry = snapshot.entries[i];
+
+		// Sorted paths share long prefixes with the path before them
+		std::size_t shared_length = 0;
+		if (previous_path != NULL)
+		{
+			std::size_t maximum_length = std::min(previous_path->size(), entry.path.size());
+			while (shared_length < maximum_length && (*previous_path)[shared_length] == entry.path[shared_length])
+			{
+				++shared_length;
+			}
+		}
+		previous_path = &entry.path;
+
+		writeNumber(buffer, shared_length);
+		writeBytes(buffer, entry.path.data() + shared_length, entry.path.size() - shared_length);
+		writeNumber(buffer, entry.type);
+		writeNumber(buffer, entry.size);
+		writeNumber(buffer, (unsigned long long)(long long)entry.modifiedDate);
+		writeNumber(buffer, entry.modifiedNanoseconds);
+		writeNumber(buffer, entry.mode);
+
+		// Store the hash as raw bytes, or nothing if the contents were not hashed
+		bool has_hash = (entry.hash.size() == 2 * HASH_LENGTH);
+		writeNumber(buffer, has_hash ? HASH_LENGTH : 0);
+		for (unsigned int k = 0; has_hash && k < HASH_LENGTH; ++k)
+		{
+			int high = hexDigitValue(entry.hash[2 * k]);
+			int low = hexDigitValue(entry.hash[2 * k + 1]);
+			buffer.push_back((char)(((high & 0xF) << 4) | (low & 0xF)));
+		}
 	}
 
-	// Build a string list from the sorted string set
-	StringList directory_list;
-	BOOST_FOREACH (const String& item, directory_set)
+	std::ofstream stream(path.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+	if (!stream.is_open())
 	{
-		directory_list.push_back(item);
+		return false;
 	}
 
-	return directory_list;
+	stream.write(buffer.data(), buffer.size());
+	stream.close();
+
+	return !stream.fail();
 }
 
-FileInfoList directoryInfoList(const String& path)
+Snapshot readSnapshot(const String& path)
 {
-	// Throw an exception if the path does not exist
-	if (!FileInfo(path).exists())
+	std::ifstream stream(path.c_str(), std::ios::in | std::ios::binary);
+	if (!stream.is_open())
 	{
-		String msg = String("The following path is not valid: %1").arg(path);
+		String msg = String("The following snapshot index could not be opened: %1").arg(path);
 		throw FileSystemError(msg, BUMP_LOCATION);
 	}
 
-	// Throw an exception if the path is not a directory
-	if (!FileInfo(path).isDirectory())
-	{
-		String msg = String("The following path is not a directory: %1").arg(path);
-		throw FileSystemError(msg, BUMP_LOCATION);
-	}
+	std::ostringstream contents;
+	contents << stream.rdbuf();
+	std::string data = contents.str();
 
-	// Create a path and two directory iterators
-	boost::filesystem::path directory_path(path.c_str());
-	boost::filesystem::directory_iterator iter(directory_path);
-	boost::filesystem::directory_iterator end_iter;
+	// Make sure the file is an index we know how to read
+	SnapshotReader reader(data);
+	const char* magic = reader.readBytes(sizeof(SNAPSHOT_MAGIC));
+	bool valid = (magic != NULL && std::equal(magic, magic + sizeof(SNAPSHOT_MAGIC), SNAPSHOT_MAGIC));
+	valid = valid && reader.readNumber() == SNAPSHOT_VERSION;
 
-	// Iterate through the directory collecting all the item paths as strings
-	StringSet directory_set;
-	BOOST_FOREACH (const boost::filesystem::path& item, std::make_pair(iter, end_iter))
+	Snapshot snapshot;
+	if (valid)
 	{
-		String unix_item_str = convertToUnixPath(item.string());
-		directory_set.insert(unix_item_str);
+		snapshot.hashesContents = (reader.readNumber() & 1) != 0;
+		unsigned long long root_length = reader.readNumber();
+		const char* root_path = reader.readBytes(root_length);
+		if (root_path != NULL)
+		{
+			snapshot.rootPath.assign(root_path, root_length);
+		}
+
+		// Every entry takes at least eight bytes, which bounds the count of a corrupt index
+		unsigned long long count = reader.readNumber();
+		valid = reader.valid && count <= (data.size() - reader.position) / 8;
+		if (valid)
+		{
+			snapshot.entries.resize(count);
+		}
+
+		static const char HEX_DIGITS[] = "0123456789abcdef";
+		for (unsigned long long i = 0; valid && i < count; ++i)
+		{
+			SnapshotEntry& entry = snapshot.entries[i];
+
+			// Rebuild the path from the prefix it shares with the previous path
+			unsigned long long shared_length = reader.readNumber();
+			unsigned long long suffix_length = reader.readNumber();
+			const char* suffix = reader.readBytes(suffix_length);
+			if (suffix == NULL || (i == 0 && shared_length > 0) || (i > 0 && shared_length > snapshot.entries[i - 1].path.size()))
+			{
+				valid = false;
+				break;
+			}
+			std::string entry_path;
+			if (i > 0)
+			{
+				entry_path.assign(snapshot.entries[i - 1].path, 0, shared_length);
+			}
+			entry_path.append(suffix, suffix_length);
+			entry.path = entry_path;
+
+			entry.type = (EntryType)reader.readNumber();
+			entry.size = reader.readNumber();
+			entry.modifiedDate = (std::time_t)(long long)reader.readNumber();
+			entry.modifiedNanoseconds = (unsigned int)reader.readNumber();
+			entry.mode = (unsigned int)reader.readNumber();
+
+			unsigned long long hash_length = reader.readNumber();
+			const char* hash = reader.readBytes(hash_length);
+			if (hash == NULL || (hash_length != 0 && hash_length != HASH_LENGTH))
+			{
+				valid = false;
+				break;
+			}
+			for (unsigned int k = 0; k < hash_length; ++k)
+			{
+				entry.hash.push_back(HEX_DIGITS[((unsigned char)hash[k]) >> 4]);
+				entry.hash.push_back(HEX_DIGITS[((unsigned char)hash[k]) & 0xF]);
+			}
+		}
+
+		valid = valid && reader.valid && reader.position == data.size();
 	}
 
-	// Build a file info list from the sorted string set
-	FileInfoList directory_list;
-	BOOST_FOREACH (const String& item, directory_set)
+	if (!valid)
 	{
-		FileInfo item_info(item);
-		directory_list.push_back(item_info);
+		String msg = String("The following path is not a valid snapshot index: %1").arg(path);
+		throw FileSystemError(msg, BUMP_LOCATION);
 	}
 
-	return directory_list;
+	return snapshot;
 }
 
 //====================================================================================
@@ -496,7 +897,7 @@ bool removeFile(const String& path)
 	return boost::filesystem::remove(boost::filesystem::path(path.c_str()));
 }
 
-bool copyFile(const String& source, const String& destination)
+bool renameFile(const String& source, const String& destination)
 {
 	// Fail if source is not a file
 	if (!FileInfo(source).isFile())
@@ -508,7 +909,7 @@ bool copyFile(const String& source, const String& destination)
 	{
 		boost::filesystem::path source_path(source.c_str());
 		boost::filesystem::path destination_path(destination.c_str());
-		boost::filesystem::copy(source_path, destination_path);
+		boost::filesystem::rename(source_path, destination_path);
 		return true;
 	}
 	catch (const boost::filesystem::filesystem_error& /*e*/)
@@ -517,25 +918,53 @@ bool copyFile(const String& source, const String& destination)
 	}
 }
 
-bool renameFile(const String& source, const String& destination)
+bool writeFileAtomically(const String& path, const StringView& data, bool synchronize)
 {
-	// Fail if source is not a file
-	if (!FileInfo(source).isFile())
+	// The data is already in one piece so there is nothing to gain from buffering it
+	AtomicFileWriter writer(0);
+	AtomicFileWriter::Durability durability = synchronize ? AtomicFileWriter::SYNC_FILE_AND_DIRECTORY : AtomicFileWriter::NO_SYNC;
+
+	return writer.open(path, durability) && writer.write(data) && writer.commit();
+}
+
+bool writeFilesAtomically(const StringList& paths, const StringList& contents, bool synchronize)
+{
+	if (paths.size() != contents.size())
 	{
-		return false;
+		throw InvalidArgumentError("The number of paths and contents must match", BUMP_LOCATION);
 	}
 
-	try
+	// Flush each file as it is committed, but leave the directories until every rename is done
+	AtomicFileWriter writer(0);
+	AtomicFileWriter::Durability durability = synchronize ? AtomicFileWriter::SYNC_FILE : AtomicFileWriter::NO_SYNC;
+	StringSet directories;
+	bool written = true;
+	for (unsigned int i = 0; i < paths.size(); ++i)
 	{
-		boost::filesystem::path source_path(source.c_str());
-		boost::filesystem::path destination_path(destination.c_str());
-		boost::filesystem::rename(source_path, destination_path);
-		return true;
+		if (!writer.open(paths[i], durability) || !writer.write(contents[i]) || !writer.commit())
+		{
+			written = false;
+			continue;
+		}
+
+		// The parent is a view into the path, so the path has to outlive it
+		Path normalized(paths[i]);
+		StringView parent = normalized.parent();
+		directories.insert(parent.isEmpty() ? String(".") : parent.toString());
 	}
-	catch (const boost::filesystem::filesystem_error& /*e*/)
+
+	if (synchronize)
 	{
-		return false;
+		BOOST_FOREACH (const String& directory, directories)
+		{
+			if (!AtomicFileWriter::synchronizeDirectory(directory))
+			{
+				written = false;
+			}
+		}
 	}
+
+	return written;
 }
 
 //====================================================================================
@@ -669,6 +1098,12 @@ std::time_t modifiedDate(const String& path)
 	return info.modifiedDate();
 }
 
+bool modifiedDate(const String& path, std::time_t& date, FileSystemStatus& status)
+{
+	FileInfo info(path);
+	return info.modifiedDate(date, status);
+}
+
 }	// End of FileSystem namespace
 
 }	// End of bump namespace
@@ -0,0 +1,43 @@
+//
+//  FileSystemStatus.cpp
+//  Bump
+//
+//  Created by Joseph Holub on 10/18/26.
+//  Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+// Bump headers
+#include <bump/FileSystemStatus.h>
+
+// C headers
+#include <errno.h>
+
+namespace bump {
+
+FileSystemStatus fileSystemStatusFromErrorCode(int errorCode)
+{
+	if (errorCode == 0)
+	{
+		return FILE_SYSTEM_SUCCESS;
+	}
+	else if (errorCode == ENOENT || errorCode == ELOOP || errorCode == ENAMETOOLONG)
+	{
+		return PATH_NOT_FOUND;
+	}
+	else if (errorCode == ENOTDIR)
+	{
+		return PATH_NOT_DIRECTORY;
+	}
+	else if (errorCode == EISDIR)
+	{
+		return PATH_NOT_FILE;
+	}
+	else if (errorCode == EACCES || errorCode == EPERM)
+	{
+		return PERMISSION_DENIED;
+	}
+
+	return FILE_SYSTEM_FAILURE;
+}
+
+}	// End of bump namespace
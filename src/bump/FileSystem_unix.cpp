@@ -7,15 +7,2086 @@
 //
 
 // Boost headers
+#include <boost/bind.hpp>
 #include <boost/filesystem.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/thread.hpp>
 
 // Bump headers
+#include <bump/Directory.h>
 #include <bump/FileSystem.h>
 #include <bump/FileSystemError.h>
+#include <bump/MappedFile.h>
+#include <bump/Path.h>
+#include <bump/ReadAheadStream.h>
+#include <bump/ThreadPool.h>
+#include <bump/Timer.h>
+#include <bump/Uuid.h>
+
+// C++ headers
+#include <algorithm>
+#include <set>
+#include <vector>
+
+// C headers
+#include <limits.h>
+#include <stdlib.h>
+
+// Unix headers
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+// Smallsha1 headers
+#include <smallsha1/sha1.h>
+
+// Private headers
+#include "DirectoryEntry_unix.h"
+
+// Linux headers
+#ifdef __linux__
+#include <linux/fs.h>
+#include <sys/ioctl.h>
+#include <sys/sendfile.h>
+#endif
+
+// copy_file_range() was added to glibc in 2.27
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 27))
+#define BUMP_HAS_COPY_FILE_RANGE
+#endif
 
 namespace bump {
 
-namespace FileSystem {
+namespace FileSystem {
+
+//====================================================================================
+//                                  Walk Helpers
+//====================================================================================
+
+/**
+ * The state shared between all the tasks of a single walk.
+ */
+struct WalkContext
+{
+	WalkOptions								options;				/**< The options the walk was started with. */
+	WalkVisitor								visitor;				/**< The visitor receiving the batches of entries. */
+	GlobPattern								pattern;				/**< The compiled pattern entry filenames must match. */
+	ThreadPool*								pool;					/**< The pool running the directory tasks. */
+	boost::mutex							visitorMutex;			/**< Makes sure the visitor is never called concurrently. */
+	boost::mutex							stateMutex;				/**< Guards the visited directories, the error callback and the failed flag. */
+	std::set<std::pair<dev_t, ino_t> >		visitedDirectories;		/**< The directories already descended into when following symbolic links. */
+	bool									failed;					/**< Whether any error occurred during the walk. */
+};
+
+static void reportWalkError(WalkContext* context, const String& path, int errorCode)
+{
+	boost::mutex::scoped_lock lock(context->stateMutex);
+	context->failed = true;
+	if (context->options.errorCallback)
+	{
+		context->options.errorCallback(path, errorCode);
+	}
+}
+
+static bool markDirectoryVisited(WalkContext* context, const struct stat& info)
+{
+	boost::mutex::scoped_lock lock(context->stateMutex);
+	return context->visitedDirectories.insert(std::make_pair(info.st_dev, info.st_ino)).second;
+}
+
+static void deliverWalkEntries(WalkContext* context, WalkEntryList& entries)
+{
+	if (!entries.empty())
+	{
+		bool visitor_failed = false;
+		{
+			// The pool would swallow the exception, so record it as a walk failure
+			boost::mutex::scoped_lock lock(context->visitorMutex);
+			try
+			{
+				context->visitor(entries);
+			}
+			catch (...)
+			{
+				visitor_failed = true;
+			}
+		}
+		entries.clear();
+
+		if (visitor_failed)
+		{
+			boost::mutex::scoped_lock lock(context->stateMutex);
+			context->failed = true;
+		}
+	}
+}
+
+static void walkDirectory(WalkContext* context, const String& path, unsigned int depth)
+{
+	const WalkOptions& options = context->options;
+
+	DIR* directory = opendir(path.c_str());
+	if (directory == NULL)
+	{
+		reportWalkError(context, path, errno);
+		return;
+	}
+
+	// Children are reported one level deeper than the directory being listed
+	unsigned int child_depth = depth + 1;
+	bool can_descend = (options.maximumDepth < 0 || (int)child_depth < options.maximumDepth);
+	String prefix = path;
+	if (!prefix.endsWith("/"))
+	{
+		prefix.append("/");
+	}
+
+	WalkEntryList batch;
+	while (true)
+	{
+		errno = 0;
+		struct dirent* item = readdir(directory);
+		if (item == NULL)
+		{
+			if (errno != 0)
+			{
+				reportWalkError(context, path, errno);
+			}
+			break;
+		}
+
+		// Skip the dot and dot-dot entries
+		const char* name = item->d_name;
+		if (isDotOrDotDot(name))
+		{
+			continue;
+		}
+
+		String child_path = prefix + name;
+
+		// Use the type stored in the directory entry when the file system provides it
+		EntryType type = OTHER_ENTRY;
+		if (!entryTypeFromDirectoryEntry(item, type))
+		{
+			struct stat info;
+			if (lstat(child_path.c_str(), &info) != 0)
+			{
+				reportWalkError(context, child_path, errno);
+				continue;
+			}
+			type = entryTypeFromMode(info.st_mode);
+		}
+
+		bool descend = (type == DIRECTORY_ENTRY && can_descend);
+
+		// Apply the symbolic link policy
+		if (type == SYMBOLIC_LINK_ENTRY)
+		{
+			if (options.symbolicLinkPolicy == SKIP_SYMBOLIC_LINKS)
+			{
+				continue;
+			}
+			else if (options.symbolicLinkPolicy == FOLLOW_SYMBOLIC_LINKS)
+			{
+				// Dangling symbolic links are still reported as symbolic links
+				struct stat target_info;
+				if (stat(child_path.c_str(), &target_info) == 0)
+				{
+					type = entryTypeFromMode(target_info.st_mode);
+					descend = (type == DIRECTORY_ENTRY && can_descend && markDirectoryVisited(context, target_info));
+				}
+			}
+		}
+		else if (descend && options.symbolicLinkPolicy == FOLLOW_SYMBOLIC_LINKS)
+		{
+			// Real directories must be tracked as well since a link can point back up the tree
+			struct stat info;
+			if (stat(child_path.c_str(), &info) == 0)
+			{
+				descend = markDirectoryVisited(context, info);
+			}
+		}
+
+		// Report the entry if it passes the filters
+		bool matches_type = (options.entryTypes & type) != 0;
+		bool matches_pattern = options.pattern.empty() ||
+			(context->pattern.numberOfComponents() == 1 && context->pattern.matches(0, name));
+		if (matches_type && matches_pattern)
+		{
+			WalkEntry entry;
+			entry.path = child_path;
+			entry.type = type;
+			entry.depth = child_depth;
+			batch.push_back(entry);
+
+			if (batch.size() >= options.batchSize)
+			{
+				deliverWalkEntries(context, batch);
+			}
+		}
+
+		// Hand the subdirectory off to the pool so idle workers can steal it
+		if (descend)
+		{
+			context->pool->submit(boost::bind(&walkDirectory, context, child_path, child_depth));
+		}
+	}
+
+	closedir(directory);
+	deliverWalkEntries(context, batch);
+}
+
+//====================================================================================
+//                                  Glob Helpers
+//====================================================================================
+
+/**
+ * A subdirectory found while listing a directory that still has to be searched.
+ */
+struct GlobDirectory
+{
+	String			path;		/**< The path of the subdirectory. */
+	unsigned int	component;	/**< The pattern component to match inside it. */
+};
+
+static String globChildPath(const String& path, const char* name)
+{
+	if (path.empty())
+	{
+		return String(name);
+	}
+	else if (path.endsWith("/"))
+	{
+		return path + name;
+	}
+
+	return path + "/" + name;
+}
+
+static bool isGlobDirectory(const String& path, const struct dirent* item, bool followSymbolicLinks)
+{
+	// Use the type stored in the directory entry unless it is missing or a symbolic link to follow
+	EntryType type = OTHER_ENTRY;
+	if (entryTypeFromDirectoryEntry(item, type) && (type != SYMBOLIC_LINK_ENTRY || !followSymbolicLinks))
+	{
+		return type == DIRECTORY_ENTRY;
+	}
+
+	struct stat info;
+	int result = followSymbolicLinks ? stat(path.c_str(), &info) : lstat(path.c_str(), &info);
+	return result == 0 && S_ISDIR(info.st_mode);
+}
+
+static void globDirectory(const GlobPattern& pattern, const String& path, unsigned int component, StringList& matches)
+{
+	unsigned int last_component = pattern.numberOfComponents() - 1;
+	bool directories_only = pattern.matchesDirectoriesOnly();
+
+	// Literal components are joined straight onto the path without listing the directory
+	if (pattern.isLiteral(component))
+	{
+		String child_path = globChildPath(path, pattern.literal(component).c_str());
+		if (component < last_component)
+		{
+			globDirectory(pattern, child_path, component + 1, matches);
+			return;
+		}
+
+		struct stat info;
+		int result = directories_only ? stat(child_path.c_str(), &info) : lstat(child_path.c_str(), &info);
+		if (result == 0 && (!directories_only || S_ISDIR(info.st_mode)))
+		{
+			matches.push_back(child_path);
+		}
+		return;
+	}
+
+	// A '**' in the middle of the pattern can also match no directories at all
+	bool is_recursive = pattern.isRecursive(component);
+	if (is_recursive && component < last_component)
+	{
+		globDirectory(pattern, path, component + 1, matches);
+	}
+
+	DIR* directory = opendir(path.empty() ? "." : path.c_str());
+	if (directory == NULL)
+	{
+		return;
+	}
+
+	// A trailing '**' matches the directory itself along with everything below it
+	if (is_recursive && component == last_component && !path.empty())
+	{
+		matches.push_back(path);
+	}
+
+	// Collect the subdirectories to search so only one directory is open at a time
+	std::vector<GlobDirectory> subdirectories;
+	struct dirent* item = NULL;
+	while ((item = readdir(directory)) != NULL)
+	{
+		const char* name = item->d_name;
+		if (isDotOrDotDot(name))
+		{
+			continue;
+		}
+
+		GlobDirectory subdirectory;
+		if (is_recursive)
+		{
+			// Descend through every real directory without following symbolic links, which could loop
+			subdirectory.path = globChildPath(path, name);
+			subdirectory.component = component;
+			if (isGlobDirectory(subdirectory.path, item, false))
+			{
+				subdirectories.push_back(subdirectory);
+			}
+			else if (component == last_component && !directories_only)
+			{
+				matches.push_back(subdirectory.path);
+			}
+			continue;
+		}
+
+		if (!pattern.matches(component, name))
+		{
+			continue;
+		}
+
+		subdirectory.path = globChildPath(path, name);
+		subdirectory.component = component + 1;
+		if (component < last_component)
+		{
+			// Skip entries known not to be directories, anything else is simply tried
+			EntryType type = OTHER_ENTRY;
+			if (!entryTypeFromDirectoryEntry(item, type) || type == DIRECTORY_ENTRY || type == SYMBOLIC_LINK_ENTRY)
+			{
+				subdirectories.push_back(subdirectory);
+			}
+		}
+		else if (!directories_only || isGlobDirectory(subdirectory.path, item, true))
+		{
+			matches.push_back(subdirectory.path);
+		}
+	}
+
+	closedir(directory);
+
+	for (std::size_t i = 0; i < subdirectories.size(); ++i)
+	{
+		globDirectory(pattern, subdirectories[i].path, subdirectories[i].component, matches);
+	}
+}
+
+//====================================================================================
+//                                File Copy Helpers
+//====================================================================================
+
+/**
+ * The state of a single copyFile() call.
+ */
+struct FileCopyContext
+{
+	const FileCopyOptions*	options;				/**< The options the copy was started with. */
+	FileCopyResult*			result;					/**< The result being filled in. */
+	int						sourceDescriptor;		/**< The open source file. */
+	int						destinationDescriptor;	/**< The open destination file. */
+	unsigned long long		totalBytes;				/**< The size of the source file. */
+	FileCopyMethod			method;					/**< The fastest method that still looks usable. */
+	char*					buffer;					/**< The aligned buffer for the read and write fallback, allocated on first use. */
+	ReadAheadStream*		readAhead;				/**< The stream reading the source ahead for the read and write fallback, created on first use. */
+};
+
+static void accessAndModifiedTimes(const struct stat& info, struct timespec times[2])
+{
+#ifdef __APPLE__
+	times[0] = info.st_atimespec;
+	times[1] = info.st_mtimespec;
+#else
+	times[0] = info.st_atim;
+	times[1] = info.st_mtim;
+#endif
+}
+
+static bool updateFileCopyProgress(FileCopyContext& context)
+{
+	const FileCopyProgressCallback& callback = context.options->progressCallback;
+	if (callback && !callback(context.result->bytesCopied, context.totalBytes))
+	{
+		context.result->cancelled = true;
+		errno = ECANCELED;
+		return false;
+	}
+
+	return true;
+}
+
+static bool writeFileChunk(FileCopyContext& context, const char* data, size_t length, off_t offset)
+{
+	size_t bytes_written = 0;
+	while (bytes_written < length)
+	{
+		ssize_t result = pwrite(context.destinationDescriptor, data + bytes_written, length - bytes_written,
+			offset + bytes_written);
+		if (result < 0 && errno == EINTR)
+		{
+			continue;
+		}
+		else if (result < 0)
+		{
+			return false;
+		}
+
+		bytes_written += result;
+	}
+
+	return true;
+}
+
+static ssize_t copyFileChunkReadAhead(FileCopyContext& context, off_t offset, size_t length)
+{
+	// Keep reading on from where the last chunk stopped, only starting over when the copy jumps past a hole
+	if (context.readAhead == NULL)
+	{
+		context.readAhead = new ReadAheadStream(context.options->bufferSize, context.options->readAheadBuffers);
+	}
+	if (!context.readAhead->isOpen() || context.readAhead->offset() != (unsigned long long)offset)
+	{
+		if (!context.readAhead->open(context.sourceDescriptor, offset))
+		{
+			return -1;
+		}
+	}
+
+	// The next buffers are read while this one is written
+	size_t copied = 0;
+	StringView buffer;
+	while (copied < length)
+	{
+		long bytes_read = context.readAhead->nextBuffer(buffer, length - copied);
+		if (bytes_read < 0)
+		{
+			return -1;
+		}
+		else if (bytes_read == 0)
+		{
+			break;
+		}
+
+		if (!writeFileChunk(context, buffer.data(), bytes_read, offset + copied))
+		{
+			return -1;
+		}
+
+		copied += bytes_read;
+	}
+
+	return copied;
+}
+
+static ssize_t copyFileChunkThroughBuffer(FileCopyContext& context, off_t offset, size_t length)
+{
+	if (context.options->readAheadBuffers > 0)
+	{
+		return copyFileChunkReadAhead(context, offset, length);
+	}
+
+	size_t buffer_size = context.options->bufferSize == 0 ? 1 : context.options->bufferSize;
+	if (context.buffer == NULL)
+	{
+		// Page aligned buffers let the kernel skip the unaligned copy paths
+		void* buffer = NULL;
+		int error_code = posix_memalign(&buffer, 4096, buffer_size);
+		if (error_code != 0)
+		{
+			errno = error_code;
+			return -1;
+		}
+		context.buffer = static_cast<char*>(buffer);
+	}
+
+	size_t copied = 0;
+	while (copied < length)
+	{
+		size_t requested = std::min(buffer_size, length - copied);
+		ssize_t bytes_read = pread(context.sourceDescriptor, context.buffer, requested, offset + copied);
+		if (bytes_read < 0 && errno == EINTR)
+		{
+			continue;
+		}
+		else if (bytes_read < 0)
+		{
+			return -1;
+		}
+		else if (bytes_read == 0)
+		{
+			break;
+		}
+
+		if (!writeFileChunk(context, context.buffer, bytes_read, offset + copied))
+		{
+			return -1;
+		}
+
+		copied += bytes_read;
+	}
+
+	return copied;
+}
+
+static ssize_t copyFileChunk(FileCopyContext& context, off_t offset, size_t length)
+{
+	while (true)
+	{
+#ifdef BUMP_HAS_COPY_FILE_RANGE
+		if (context.method == COPY_FILE_RANGE_COPY)
+		{
+			off_t input_offset = offset;
+			off_t output_offset = offset;
+			ssize_t copied = copy_file_range(context.sourceDescriptor, &input_offset,
+				context.destinationDescriptor, &output_offset, length, 0);
+
+			// Pseudo file systems report nothing to copy, so let the next method decide
+			if (copied > 0 || (copied < 0 && errno != ENOSYS && errno != EXDEV && errno != EINVAL && errno != EOPNOTSUPP))
+			{
+				return copied;
+			}
+
+			context.method = SENDFILE_COPY;
+			continue;
+		}
+#endif
+
+#ifdef __linux__
+		if (context.method == COPY_FILE_RANGE_COPY || context.method == SENDFILE_COPY)
+		{
+			context.method = SENDFILE_COPY;
+			off_t input_offset = offset;
+			if (lseek(context.destinationDescriptor, offset, SEEK_SET) < 0)
+			{
+				return -1;
+			}
+
+			ssize_t copied = sendfile(context.destinationDescriptor, context.sourceDescriptor, &input_offset, length);
+			if (copied > 0 || (copied < 0 && errno != ENOSYS && errno != EINVAL))
+			{
+				return copied;
+			}
+		}
+#endif
+
+		context.method = READ_WRITE_COPY;
+		return copyFileChunkThroughBuffer(context, offset, length);
+	}
+}
+
+static bool copyFileRange(FileCopyContext& context, off_t offset, off_t length)
+{
+	off_t end = offset + length;
+	unsigned long long chunk_size = context.options->chunkSize == 0 ? 1 : context.options->chunkSize;
+	while (offset < end)
+	{
+		size_t chunk_length = (size_t)std::min<unsigned long long>(end - offset, chunk_size);
+		ssize_t copied = copyFileChunk(context, offset, chunk_length);
+		if (copied < 0 && errno == EINTR)
+		{
+			continue;
+		}
+		else if (copied < 0)
+		{
+			return false;
+		}
+		else if (copied == 0)
+		{
+			// The source file is shorter than it was when the copy started
+			return true;
+		}
+
+		offset += copied;
+		context.result->method = context.method;
+		context.result->bytesCopied += copied;
+		if (!updateFileCopyProgress(context))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static bool copyFileData(FileCopyContext& context, const struct stat& info)
+{
+#ifdef FICLONE
+	// Share the data blocks outright on file systems that support reflinks
+	if (context.options->cloneFile && ioctl(context.destinationDescriptor, FICLONE, context.sourceDescriptor) == 0)
+	{
+		context.result->method = CLONE_COPY;
+		context.result->bytesCopied = info.st_size;
+		return updateFileCopyProgress(context);
+	}
+#endif
+
+#ifdef POSIX_FADV_SEQUENTIAL
+	posix_fadvise(context.sourceDescriptor, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+
+#ifdef SEEK_DATA
+	// Only copy the data regions of sparse files, the holes come back when the size is set
+	bool is_sparse = (unsigned long long)info.st_blocks * 512 < (unsigned long long)info.st_size;
+	if (context.options->preserveSparseFiles && is_sparse)
+	{
+		off_t data_offset = lseek(context.sourceDescriptor, 0, SEEK_DATA);
+		if (data_offset >= 0 || errno == ENXIO)
+		{
+			while (data_offset >= 0 && data_offset < info.st_size)
+			{
+				off_t hole_offset = lseek(context.sourceDescriptor, data_offset, SEEK_HOLE);
+				if (hole_offset < 0)
+				{
+					return false;
+				}
+
+				if (!copyFileRange(context, data_offset, hole_offset - data_offset))
+				{
+					return false;
+				}
+
+				data_offset = lseek(context.sourceDescriptor, hole_offset, SEEK_DATA);
+			}
+
+			if (data_offset < 0 && errno != ENXIO)
+			{
+				return false;
+			}
+
+			return ftruncate(context.destinationDescriptor, info.st_size) == 0;
+		}
+	}
+#endif
+
+	if (!copyFileRange(context, 0, info.st_size))
+	{
+		return false;
+	}
+
+	// Pseudo files report a size of zero and files can grow while they are copied, so copy until the end
+	context.method = READ_WRITE_COPY;
+	size_t buffer_size = context.options->bufferSize == 0 ? 1 : context.options->bufferSize;
+	ssize_t copied = 0;
+	off_t offset = info.st_size;
+	while ((copied = copyFileChunkThroughBuffer(context, offset, buffer_size)) > 0)
+	{
+		offset += copied;
+		context.result->method = READ_WRITE_COPY;
+		context.result->bytesCopied += copied;
+	}
+
+	return copied == 0;
+}
+
+static FileCopyResult copyFileAt(int sourceDirectory, const char* source, int destinationDirectory, const char* destination,
+	const FileCopyOptions& options)
+{
+	FileCopyResult result;
+	Timer timer;
+	timer.start();
+
+	FileCopyContext context;
+	context.options = &options;
+	context.result = &result;
+	context.destinationDescriptor = -1;
+	context.totalBytes = 0;
+	context.method = COPY_FILE_RANGE_COPY;
+	context.buffer = NULL;
+	context.readAhead = NULL;
+
+	// Open without blocking so a named pipe cannot hang the copy, it has no effect on regular files
+	context.sourceDescriptor = openat(sourceDirectory, source, O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+	if (context.sourceDescriptor < 0)
+	{
+		result.errorCode = errno;
+		return result;
+	}
+
+	// Only regular files can be copied
+	struct stat info;
+	if (fstat(context.sourceDescriptor, &info) != 0)
+	{
+		result.errorCode = errno;
+	}
+	else if (S_ISDIR(info.st_mode))
+	{
+		result.errorCode = EISDIR;
+	}
+	else if (!S_ISREG(info.st_mode))
+	{
+		result.errorCode = ENOTSUP;
+	}
+
+	if (result.errorCode != 0)
+	{
+		close(context.sourceDescriptor);
+		return result;
+	}
+	context.totalBytes = info.st_size;
+
+	// Never overwrite an existing destination
+	context.destinationDescriptor = openat(destinationDirectory, destination, O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC,
+		info.st_mode & 0777);
+	if (context.destinationDescriptor < 0)
+	{
+		result.errorCode = errno;
+		close(context.sourceDescriptor);
+		return result;
+	}
+
+	int error_code = 0;
+	if (!copyFileData(context, info))
+	{
+		error_code = errno;
+	}
+	else if (options.preservePermissions && fchmod(context.destinationDescriptor, info.st_mode & 07777) != 0)
+	{
+		error_code = errno;
+	}
+	else if (options.preserveModifiedDate)
+	{
+		struct timespec times[2];
+		accessAndModifiedTimes(info, times);
+		if (futimens(context.destinationDescriptor, times) != 0)
+		{
+			error_code = errno;
+		}
+	}
+
+	// Write errors on network file systems can surface when the file is closed
+	// The read ahead thread has to stop before the source it reads from is closed
+	delete context.readAhead;
+	free(context.buffer);
+	close(context.sourceDescriptor);
+	if (close(context.destinationDescriptor) != 0 && error_code == 0)
+	{
+		error_code = errno;
+	}
+
+	// Never leave a partial copy behind
+	if (error_code != 0)
+	{
+		unlinkat(destinationDirectory, destination, 0);
+		result.errorCode = error_code;
+		return result;
+	}
+
+	result.succeeded = true;
+	result.secondsElapsed = timer.secondsElapsed();
+	if (result.secondsElapsed > 0.0)
+	{
+		result.bytesPerSecond = result.bytesCopied / result.secondsElapsed;
+	}
+
+	return result;
+}
+
+//====================================================================================
+//                                Stat Batch Helpers
+//====================================================================================
+
+// The number of paths stat'ed by each task when a batch is split across a thread pool
+static const unsigned int STAT_BATCH_CHUNK_SIZE = 256;
+
+static void recordStatus(StatBatchResult* result, unsigned int index, mode_t mode, unsigned long long size,
+	uid_t ownerId, gid_t groupId, std::time_t modifiedDate)
+{
+	result->types[index] = entryTypeFromMode(mode);
+	result->sizes[index] = size;
+	result->modes[index] = mode;
+	result->ownerIds[index] = ownerId;
+	result->groupIds[index] = groupId;
+	result->modifiedDates[index] = modifiedDate;
+}
+
+static void statBatchRange(const StringList* paths, bool followSymbolicLinks, StatBatchResult* result,
+	unsigned int begin, unsigned int end)
+{
+#ifdef STATX_BASIC_STATS
+	// Only ask for the fields we store so network file systems can skip the rest
+	bool use_statx = true;
+	int statx_flags = AT_STATX_SYNC_AS_STAT | (followSymbolicLinks ? 0 : AT_SYMLINK_NOFOLLOW);
+	unsigned int statx_mask = STATX_TYPE | STATX_MODE | STATX_UID | STATX_GID | STATX_MTIME | STATX_SIZE;
+#endif
+
+	for (unsigned int i = begin; i < end; ++i)
+	{
+		const char* path = (*paths)[i].c_str();
+
+#ifdef STATX_BASIC_STATS
+		if (use_statx)
+		{
+			struct statx info;
+			if (statx(AT_FDCWD, path, statx_flags, statx_mask, &info) == 0)
+			{
+				recordStatus(result, i, info.stx_mode, info.stx_size, info.stx_uid, info.stx_gid, info.stx_mtime.tv_sec);
+				continue;
+			}
+			else if (errno != ENOSYS)
+			{
+				result->errorCodes[i] = errno;
+				continue;
+			}
+
+			// The kernel is older than the C library, so fall back to stat for the rest of the range
+			use_statx = false;
+		}
+#endif
+
+		struct stat info;
+		int status = followSymbolicLinks ? stat(path, &info) : lstat(path, &info);
+		if (status != 0)
+		{
+			result->errorCodes[i] = errno;
+			continue;
+		}
+
+		recordStatus(result, i, info.st_mode, info.st_size, info.st_uid, info.st_gid, info.st_mtime);
+	}
+}
+
+//====================================================================================
+//                                 Snapshot Helpers
+//====================================================================================
+
+// The number of entries each task stat's, or hashes when hashing contents
+static const unsigned int SNAPSHOT_CHUNK_SIZE = 256;
+static const unsigned int SNAPSHOT_HASH_CHUNK_SIZE = 16;
+
+// The sha1 of no data
+static const char EMPTY_CONTENTS_HASH[] = "da39a3ee5e6b4b0d3255bfef95601890afd80709";
+
+// The largest piece of a file handed to the sha1 at once, since it only takes an int length
+static const unsigned long long MAXIMUM_HASH_LENGTH = 1ULL << 30;
+
+/**
+ * The state shared between all the tasks of a single snapshot.
+ */
+struct SnapshotContext
+{
+	String					prefix;			/**< The snapshot root ending with a slash. */
+	const Snapshot*			previous;		/**< The snapshot whose hashes can be reused. */
+	Snapshot*				snapshot;		/**< The snapshot being filled in. */
+	std::vector<char>		missing;		/**< Whether each entry disappeared before it could be stat'ed. */
+	StringList				unreadable;		/**< The paths the walk could not read, which would otherwise look removed. */
+	unsigned int			vanished;		/**< The number of paths that disappeared while the tree was walked. */
+};
+
+static bool isSnapshotEntryBefore(const SnapshotEntry& left, const SnapshotEntry& right)
+{
+	return left.path < right.path;
+}
+
+static void collectSnapshotEntries(SnapshotEntryList* entries, unsigned int prefixLength, const WalkEntryList& batch)
+{
+	for (unsigned int i = 0; i < batch.size(); ++i)
+	{
+		SnapshotEntry entry;
+		entry.path.assign(batch[i].path, prefixLength, String::npos);
+		entry.type = batch[i].type;
+		entries->push_back(entry);
+	}
+}
+
+static void collectSnapshotError(SnapshotContext* context, const String& path, int errorCode)
+{
+	// Objects that disappear while the snapshot is taken are simply left out
+	if (errorCode == ENOENT)
+	{
+		++context->vanished;
+	}
+	else
+	{
+		context->unreadable.push_back(path);
+	}
+}
+
+static bool hashFileContents(const String& path, String& hash)
+{
+	MappedFile file;
+	if (!file.open(path))
+	{
+		return false;
+	}
+	else if (file.size() == 0)
+	{
+		hash = EMPTY_CONTENTS_HASH;
+		return true;
+	}
+	file.advise(MappedFile::SEQUENTIAL_ACCESS);
+
+	// Hash the file a piece at a time into the same sha1, so even huge files get the hash sha1sum gives
+	sha1::Context context;
+	sha1::init(context);
+	StringView contents = file.view();
+	for (std::size_t offset = 0; offset < contents.length(); offset += MAXIMUM_HASH_LENGTH)
+	{
+		StringView piece = contents.section(offset, MAXIMUM_HASH_LENGTH);
+		sha1::update(context, piece.data(), (int)piece.length());
+	}
+
+	unsigned char digest[20];
+	char hexstring[41];
+	sha1::finish(context, digest);
+	sha1::toHexString(digest, hexstring);
+	hash = hexstring;
+
+	return true;
+}
+
+static void snapshotRange(SnapshotContext* context, unsigned int begin, unsigned int end)
+{
+	Snapshot* snapshot = context->snapshot;
+	for (unsigned int i = begin; i < end; ++i)
+	{
+		SnapshotEntry& entry = snapshot->entries[i];
+		String path = context->prefix + entry.path;
+
+		struct stat info;
+		if (lstat(path.c_str(), &info) != 0)
+		{
+			context->missing[i] = 1;
+			continue;
+		}
+
+		entry.type = entryTypeFromMode(info.st_mode);
+		entry.size = info.st_size;
+		entry.mode = info.st_mode;
+		entry.modifiedDate = info.st_mtime;
+#ifdef __APPLE__
+		entry.modifiedNanoseconds = info.st_mtimespec.tv_nsec;
+#else
+		entry.modifiedNanoseconds = info.st_mtim.tv_nsec;
+#endif
+
+		if (!snapshot->hashesContents || entry.type != FILE_ENTRY)
+		{
+			continue;
+		}
+
+		// Only hash the files that changed since the previous snapshot
+		const SnapshotEntry* previous = context->previous->find(entry.path);
+		if (previous != NULL && previous->type == FILE_ENTRY && !previous->hash.empty() &&
+			previous->size == entry.size && previous->modifiedDate == entry.modifiedDate &&
+			previous->modifiedNanoseconds == entry.modifiedNanoseconds)
+		{
+			entry.hash = previous->hash;
+		}
+		else
+		{
+			hashFileContents(path, entry.hash);
+		}
+	}
+}
+
+//====================================================================================
+//                                  Copy Helpers
+//====================================================================================
+
+/**
+ * A copied directory whose permissions and modified date are applied after its contents.
+ */
+struct CopiedDirectory
+{
+	String			path;		/**< The destination path of the directory. */
+	unsigned int	depth;		/**< The depth below the destination root. */
+	struct stat		info;		/**< The status of the source directory. */
+};
+
+/**
+ * The state shared between all the tasks of a single directory copy.
+ */
+struct CopyContext
+{
+	CopyOptions						options;		/**< The options the copy was started with. */
+	ThreadPool*						pool;			/**< The pool running the directory and file tasks. */
+	boost::mutex					mutex;			/**< Guards the progress, the copied directories, the callbacks and the failed flag. */
+	CopyProgress					progress;		/**< The running totals handed to the progress callback. */
+	std::vector<CopiedDirectory>	directories;	/**< The directories waiting for their permissions and modified dates. */
+	bool							failed;			/**< Whether any object could not be copied. */
+};
+
+/** A directory handle shared by the tasks copying its contents, closed when the last one finishes. */
+typedef boost::shared_ptr<Directory> DirectoryHandle;
+
+static bool isDeeperDirectory(const CopiedDirectory& left, const CopiedDirectory& right)
+{
+	return left.depth > right.depth;
+}
+
+static void reportCopyError(CopyContext* context, const String& path, int errorCode)
+{
+	boost::mutex::scoped_lock lock(context->mutex);
+	context->failed = true;
+	++context->progress.errors;
+	if (context->options.errorCallback)
+	{
+		context->options.errorCallback(path, errorCode);
+	}
+}
+
+static void reportCopyProgress(CopyContext* context, const String& path, EntryType type, unsigned long long bytes)
+{
+	boost::mutex::scoped_lock lock(context->mutex);
+	if (type == FILE_ENTRY)
+	{
+		++context->progress.filesCopied;
+	}
+	else if (type == DIRECTORY_ENTRY)
+	{
+		++context->progress.directoriesCopied;
+	}
+	else if (type == SYMBOLIC_LINK_ENTRY)
+	{
+		++context->progress.symbolicLinksCopied;
+	}
+	context->progress.bytesCopied += bytes;
+	context->progress.path = path;
+
+	if (context->options.progressCallback)
+	{
+		context->options.progressCallback(context->progress);
+	}
+}
+
+static void copyFileTask(CopyContext* context, DirectoryHandle source, DirectoryHandle destination, const String& name)
+{
+	const CopyOptions& options = context->options;
+
+	FileCopyOptions file_options;
+	file_options.cloneFile = options.cloneFiles;
+	file_options.preservePermissions = options.preservePermissions;
+	file_options.preserveModifiedDate = options.preserveModifiedDates;
+
+	FileCopyResult result = copyFileAt(source->descriptor(), name.c_str(), destination->descriptor(), name.c_str(), file_options);
+	String destination_path = join(destination->path(), name);
+	if (!result.succeeded)
+	{
+		reportCopyError(context, destination_path, result.errorCode);
+		return;
+	}
+
+	reportCopyProgress(context, destination_path, FILE_ENTRY, result.bytesCopied);
+}
+
+static bool copySymbolicLinkEntry(CopyContext* context, const Directory& source, const Directory& destination,
+	const String& name)
+{
+	char target[PATH_MAX + 1];
+	ssize_t length = readlinkat(source.descriptor(), name.c_str(), target, PATH_MAX);
+	if (length < 0)
+	{
+		int error_code = errno;
+		reportCopyError(context, join(source.path(), name), error_code);
+		return false;
+	}
+	target[length] = '\0';
+
+	String destination_path = join(destination.path(), name);
+	if (symlinkat(target, destination.descriptor(), name.c_str()) != 0)
+	{
+		reportCopyError(context, destination_path, errno);
+		return false;
+	}
+
+	// The modified date of the link itself is best effort since not every platform can set it
+	if (context->options.preserveModifiedDates)
+	{
+		struct stat info;
+		if (fstatat(source.descriptor(), name.c_str(), &info, AT_SYMLINK_NOFOLLOW) == 0)
+		{
+			struct timespec times[2];
+			accessAndModifiedTimes(info, times);
+			utimensat(destination.descriptor(), name.c_str(), times, AT_SYMLINK_NOFOLLOW);
+		}
+	}
+
+	reportCopyProgress(context, destination_path, SYMBOLIC_LINK_ENTRY, 0);
+	return true;
+}
+
+static void copyDirectoryContents(CopyContext* context, DirectoryHandle source, DirectoryHandle destination,
+	unsigned int depth);
+
+static void copyDirectoryTask(CopyContext* context, DirectoryHandle sourceParent, DirectoryHandle destinationParent,
+	const String& name, unsigned int depth)
+{
+	// The child handles are only opened once the task runs so queued directories do not hold descriptors
+	DirectoryHandle source(new Directory());
+	if (!source->open(*sourceParent, name))
+	{
+		int error_code = errno;
+		reportCopyError(context, join(sourceParent->path(), name), error_code);
+		return;
+	}
+
+	DirectoryHandle destination(new Directory());
+	if (!destination->open(*destinationParent, name))
+	{
+		int error_code = errno;
+		reportCopyError(context, join(destinationParent->path(), name), error_code);
+		return;
+	}
+
+	copyDirectoryContents(context, source, destination, depth);
+}
+
+static void copyDirectoryContents(CopyContext* context, DirectoryHandle source, DirectoryHandle destination,
+	unsigned int depth)
+{
+	const CopyOptions& options = context->options;
+
+	Directory::EntryList entries;
+	if (!source->list(entries))
+	{
+		reportCopyError(context, source->path(), errno);
+	}
+
+	for (unsigned int i = 0; i < entries.size(); ++i)
+	{
+		const String& name = entries[i].name;
+		EntryType type = entries[i].type;
+
+		if (type == DIRECTORY_ENTRY)
+		{
+			// Directories need their status since their attributes are applied at the end
+			struct stat info;
+			if (fstatat(source->descriptor(), name.c_str(), &info, AT_SYMLINK_NOFOLLOW) != 0)
+			{
+				int error_code = errno;
+				reportCopyError(context, join(source->path(), name), error_code);
+				continue;
+			}
+
+			// Keep the directory writable by the owner until all its contents have been copied
+			String destination_child = join(destination->path(), name);
+			mode_t mode = options.preservePermissions ? S_IRWXU : ((info.st_mode & 0777) | S_IRWXU);
+			if (mkdirat(destination->descriptor(), name.c_str(), mode) != 0)
+			{
+				reportCopyError(context, destination_child, errno);
+				continue;
+			}
+
+			if (options.preservePermissions || options.preserveModifiedDates)
+			{
+				CopiedDirectory copied_directory;
+				copied_directory.path = destination_child;
+				copied_directory.depth = depth + 1;
+				copied_directory.info = info;
+
+				boost::mutex::scoped_lock lock(context->mutex);
+				context->directories.push_back(copied_directory);
+			}
+
+			reportCopyProgress(context, destination_child, DIRECTORY_ENTRY, 0);
+			context->pool->submit(boost::bind(&copyDirectoryTask, context, source, destination, name, depth + 1));
+		}
+		else if (type == SYMBOLIC_LINK_ENTRY)
+		{
+			copySymbolicLinkEntry(context, *source, *destination, name);
+		}
+		else if (type == FILE_ENTRY)
+		{
+			// Hand each file off to the pool so many copies are in flight at once
+			context->pool->submit(boost::bind(&copyFileTask, context, source, destination, name));
+		}
+		else
+		{
+			// Devices, sockets and named pipes cannot be copied
+			reportCopyError(context, join(source->path(), name), ENOTSUP);
+		}
+	}
+}
+
+static void applyDirectoryAttributes(CopyContext* context, const CopiedDirectory& directory)
+{
+	const CopyOptions& options = context->options;
+
+	if (options.preserveModifiedDates)
+	{
+		struct timespec times[2];
+		accessAndModifiedTimes(directory.info, times);
+		if (utimensat(AT_FDCWD, directory.path.c_str(), times, 0) != 0)
+		{
+			reportCopyError(context, directory.path, errno);
+		}
+	}
+
+	if (options.preservePermissions && chmod(directory.path.c_str(), directory.info.st_mode & 07777) != 0)
+	{
+		reportCopyError(context, directory.path, errno);
+	}
+}
+
+//====================================================================================
+//                                  Remove Helpers
+//====================================================================================
+
+// The number of files each task unlinks when a directory is split across the pool
+static const unsigned int REMOVE_CHUNK_SIZE = 256;
+
+/**
+ * A directory being removed, which is removed itself once all its pending work is done.
+ */
+struct RemoveNode
+{
+	boost::shared_ptr<RemoveNode>	parent;				/**< The node of the parent directory, NULL for the root. */
+	DirectoryHandle					parentDirectory;	/**< The open parent directory. */
+	DirectoryHandle					directory;			/**< The open directory, opened when its task runs. */
+	String							name;				/**< The name of the directory inside the parent. */
+	unsigned int					pending;			/**< The number of tasks still working inside the directory. */
+	bool							failed;				/**< Whether anything inside the directory could not be removed. */
+};
+
+// Remove typedefs
+typedef boost::shared_ptr<RemoveNode> RemoveNodeHandle; /**< A node shared by the tasks working inside it. */
+
+/**
+ * The state shared between all the tasks of a single directory removal.
+ */
+struct RemoveContext
+{
+	RemoveOptions		options;		/**< The options the removal was started with. */
+	ThreadPool*			pool;			/**< The pool running the directory and file tasks. */
+	boost::mutex		mutex;			/**< Guards the progress, the pending counts and the failed flags. */
+	RemoveProgress		progress;		/**< The running totals handed to the progress callback. */
+	bool				failed;			/**< Whether any object could not be removed. */
+};
+
+static bool isNotDirectoryEntry(const Directory::Entry& entry)
+{
+	return entry.type != DIRECTORY_ENTRY;
+}
+
+static void reportRemoveError(RemoveContext* context, const RemoveNodeHandle& node, const String& path, int errorCode)
+{
+	{
+		boost::mutex::scoped_lock lock(context->mutex);
+		context->failed = true;
+		node->failed = true;
+		++context->progress.errors;
+	}
+
+	// Call back without the lock so the other threads never wait on user code
+	if (context->options.errorCallback)
+	{
+		context->options.errorCallback(path, errorCode);
+	}
+}
+
+static void reportRemoveProgress(RemoveContext* context, const String& path, unsigned long long files,
+	unsigned long long directories, unsigned long long symbolicLinks)
+{
+	RemoveProgress progress;
+	{
+		boost::mutex::scoped_lock lock(context->mutex);
+		context->progress.filesRemoved += files;
+		context->progress.directoriesRemoved += directories;
+		context->progress.symbolicLinksRemoved += symbolicLinks;
+		context->progress.path = path;
+		progress = context->progress;
+	}
+
+	// Hand over a copy of the totals so the callback runs without the lock
+	if (context->options.progressCallback)
+	{
+		context->options.progressCallback(progress);
+	}
+}
+
+static void finishRemoveNode(RemoveContext* context, RemoveNodeHandle node)
+{
+	// Whichever task finishes the last piece of work inside a directory removes it, then moves up to its parent
+	while (node)
+	{
+		bool failed = false;
+		{
+			boost::mutex::scoped_lock lock(context->mutex);
+			if (--node->pending > 0)
+			{
+				return;
+			}
+			failed = node->failed;
+		}
+
+		if (node->directory)
+		{
+			node->directory->close();
+		}
+
+		RemoveNodeHandle parent = node->parent;
+		String path = join(node->parentDirectory->path(), node->name);
+		if (failed)
+		{
+			// The directory cannot be empty, so let the failure bubble up without reporting it again
+			if (parent)
+			{
+				boost::mutex::scoped_lock lock(context->mutex);
+				parent->failed = true;
+			}
+		}
+		else if (!node->parentDirectory->removeDirectory(node->name))
+		{
+			reportRemoveError(context, parent ? parent : node, path, errno);
+		}
+		else
+		{
+			reportRemoveProgress(context, path, 0, 1, 0);
+		}
+
+		node = parent;
+	}
+}
+
+static void removeEntries(RemoveContext* context, const RemoveNodeHandle& node, const Directory::EntryList& entries,
+	unsigned int begin, unsigned int end)
+{
+	const Directory& directory = *node->directory;
+
+	unsigned long long files = 0;
+	unsigned long long symbolic_links = 0;
+	String last_name;
+	for (unsigned int i = begin; i < end; ++i)
+	{
+		const Directory::Entry& entry = entries[i];
+		if (!directory.removeFile(entry.name))
+		{
+			// Objects already removed by someone else are not errors
+			int error_code = errno;
+			if (error_code != ENOENT)
+			{
+				reportRemoveError(context, node, join(directory.path(), entry.name), error_code);
+			}
+			continue;
+		}
+
+		if (entry.type == SYMBOLIC_LINK_ENTRY)
+		{
+			++symbolic_links;
+		}
+		else
+		{
+			++files;
+		}
+		last_name = entry.name;
+	}
+
+	if (files > 0 || symbolic_links > 0)
+	{
+		reportRemoveProgress(context, join(directory.path(), last_name), files, 0, symbolic_links);
+	}
+}
+
+static void removeEntriesTask(RemoveContext* context, RemoveNodeHandle node, boost::shared_ptr<Directory::EntryList> entries,
+	unsigned int begin, unsigned int end)
+{
+	removeEntries(context, node, *entries, begin, end);
+	finishRemoveNode(context, node);
+}
+
+static void removeDirectoryTask(RemoveContext* context, RemoveNodeHandle node)
+{
+	// The handle is only opened once the task runs so queued directories do not hold descriptors
+	node->directory.reset(new Directory());
+	if (!node->directory->open(*node->parentDirectory, node->name))
+	{
+		int error_code = errno;
+		reportRemoveError(context, node, join(node->parentDirectory->path(), node->name), error_code);
+		finishRemoveNode(context, node);
+		return;
+	}
+
+	boost::shared_ptr<Directory::EntryList> entries(new Directory::EntryList());
+	if (!node->directory->list(*entries))
+	{
+		reportRemoveError(context, node, node->directory->path(), errno);
+	}
+
+	// Move the subdirectories to the end so the files form a single range that can be split up
+	Directory::EntryList::iterator first_directory = std::stable_partition(entries->begin(), entries->end(), &isNotDirectoryEntry);
+	unsigned int number_of_files = first_directory - entries->begin();
+
+	for (unsigned int i = number_of_files; i < entries->size(); ++i)
+	{
+		RemoveNodeHandle child(new RemoveNode());
+		child->parent = node;
+		child->parentDirectory = node->directory;
+		child->name = (*entries)[i].name;
+		child->pending = 1;
+		child->failed = false;
+
+		{
+			boost::mutex::scoped_lock lock(context->mutex);
+			++node->pending;
+		}
+		context->pool->submit(boost::bind(&removeDirectoryTask, context, child));
+	}
+
+	// Hand all but the last batch of files to other threads and unlink the last one here
+	unsigned int begin = 0;
+	while (number_of_files - begin > REMOVE_CHUNK_SIZE)
+	{
+		{
+			boost::mutex::scoped_lock lock(context->mutex);
+			++node->pending;
+		}
+		context->pool->submit(boost::bind(&removeEntriesTask, context, node, entries, begin, begin + REMOVE_CHUNK_SIZE));
+		begin += REMOVE_CHUNK_SIZE;
+	}
+	removeEntries(context, node, *entries, begin, number_of_files);
+
+	finishRemoveNode(context, node);
+}
+
+static bool removeTree(RemoveContext* context, DirectoryHandle parentDirectory, const String& name)
+{
+	RemoveNodeHandle root(new RemoveNode());
+	root->parentDirectory = parentDirectory;
+	root->name = name;
+	root->pending = 1;
+	root->failed = false;
+
+	{
+		ThreadPool pool(context->options.numberOfThreads);
+		context->pool = &pool;
+		pool.submit(boost::bind(&removeDirectoryTask, context, root));
+		pool.waitForDone();
+		context->pool = NULL;
+	}
+
+	return !context->failed;
+}
+
+static void removeTreeInBackground(RemoveContext* context, DirectoryHandle parentDirectory, const String& name)
+{
+	bool removed = removeTree(context, parentDirectory, name);
+	RemoveCompletionCallback completion_callback = context->options.completionCallback;
+	delete context;
+
+	if (completion_callback)
+	{
+		completion_callback(removed);
+	}
+}
+
+//====================================================================================
+//                                Disk Usage Helpers
+//====================================================================================
+
+/**
+ * A regular file with several hard links, counted once its inode has been checked.
+ */
+struct LinkedFile
+{
+	dev_t				device;				/**< The device holding the file. */
+	ino_t				inode;				/**< The inode of the file. */
+	unsigned long long	size;				/**< The logical size of the file in bytes. */
+	unsigned long long	allocatedBytes;		/**< The bytes allocated on disk for the file. */
+	String				name;				/**< The name of the file inside its directory. */
+};
+
+/**
+ * The state shared between all the tasks of a single diskUsage() call.
+ */
+struct DiskUsageContext
+{
+	DiskUsageOptions						options;		/**< The options the walk was started with. */
+	ThreadPool*								pool;			/**< The pool running the directory tasks. */
+	dev_t									rootDevice;		/**< The device holding the root directory. */
+	boost::mutex							mutex;			/**< Guards the usage and the linked files. */
+	DiskUsage								usage;			/**< The totals of every directory finished so far. */
+	std::set<std::pair<dev_t, ino_t> >		linkedFiles;	/**< The files with several hard links already counted. */
+};
+
+static bool isLargerEntry(const DiskUsageEntry& left, const DiskUsageEntry& right)
+{
+	return left.size > right.size;
+}
+
+static unsigned long long keepLargestEntries(DiskUsageEntryList& entries, unsigned int count)
+{
+	// Returns the size a file must beat to still make it into the list
+	if (count == 0)
+	{
+		entries.clear();
+		return 0;
+	}
+	else if (entries.size() < count)
+	{
+		return 0;
+	}
+
+	std::partial_sort(entries.begin(), entries.begin() + count, entries.end(), &isLargerEntry);
+	entries.resize(count);
+	return entries.back().size;
+}
+
+static void addLargestEntry(DiskUsageEntryList& entries, unsigned long long& threshold, unsigned int count,
+	const String& path, const String& name, unsigned long long size, unsigned long long allocatedBytes)
+{
+	if (count == 0 || (threshold > 0 && size <= threshold))
+	{
+		return;
+	}
+
+	DiskUsageEntry entry;
+	entry.path = join(path, name);
+	entry.size = size;
+	entry.allocatedBytes = allocatedBytes;
+	entries.push_back(entry);
+
+	// Trim the list now and then so huge directories do not keep every file
+	if (entries.size() >= 2 * count)
+	{
+		threshold = keepLargestEntries(entries, count);
+	}
+}
+
+static void addDirectoryUsage(DiskUsageContext* context, DirectoryHandle directory);
+
+static void diskUsageDirectoryTask(DiskUsageContext* context, DirectoryHandle parent, const String& name)
+{
+	// The child handle is only opened once the task runs so queued directories do not hold descriptors
+	DirectoryHandle directory(new Directory());
+	if (!directory->open(*parent, name))
+	{
+		boost::mutex::scoped_lock lock(context->mutex);
+		++context->usage.errors;
+		return;
+	}
+
+	addDirectoryUsage(context, directory);
+}
+
+static void addDirectoryUsage(DiskUsageContext* context, DirectoryHandle directory)
+{
+	const DiskUsageOptions& options = context->options;
+	unsigned int largest_count = options.numberOfLargestEntries;
+
+	// Add up the directory on its own and only lock once to merge it into the totals
+	DiskUsage usage;
+	unsigned long long threshold = 0;
+	std::vector<LinkedFile> linked_files;
+
+	Directory::EntryList entries;
+	if (!directory->list(entries))
+	{
+		++usage.errors;
+	}
+
+	for (unsigned int i = 0; i < entries.size(); ++i)
+	{
+		const String& name = entries[i].name;
+
+		struct stat info;
+		if (fstatat(directory->descriptor(), name.c_str(), &info, AT_SYMLINK_NOFOLLOW) != 0)
+		{
+			// Objects removed since the directory was listed are simply skipped
+			if (errno != ENOENT)
+			{
+				++usage.errors;
+			}
+			continue;
+		}
+
+		unsigned long long allocated_bytes = (unsigned long long)info.st_blocks * 512;
+		if (S_ISDIR(info.st_mode))
+		{
+			if (options.stayOnFileSystem && info.st_dev != context->rootDevice)
+			{
+				continue;
+			}
+
+			++usage.directories;
+			usage.allocatedBytes += allocated_bytes;
+			context->pool->submit(boost::bind(&diskUsageDirectoryTask, context, directory, name));
+		}
+		else if (S_ISREG(info.st_mode) && info.st_nlink > 1)
+		{
+			// Whether another name already counted the file is only known once the totals are locked
+			LinkedFile linked_file;
+			linked_file.device = info.st_dev;
+			linked_file.inode = info.st_ino;
+			linked_file.size = info.st_size;
+			linked_file.allocatedBytes = allocated_bytes;
+			linked_file.name = name;
+			linked_files.push_back(linked_file);
+		}
+		else if (S_ISREG(info.st_mode))
+		{
+			++usage.files;
+			usage.logicalBytes += info.st_size;
+			usage.allocatedBytes += allocated_bytes;
+			addLargestEntry(usage.largestEntries, threshold, largest_count, directory->path(), name, info.st_size, allocated_bytes);
+		}
+		else
+		{
+			++(S_ISLNK(info.st_mode) ? usage.symbolicLinks : usage.others);
+			usage.allocatedBytes += allocated_bytes;
+		}
+	}
+
+	boost::mutex::scoped_lock lock(context->mutex);
+	DiskUsage& totals = context->usage;
+	for (unsigned int i = 0; i < linked_files.size(); ++i)
+	{
+		const LinkedFile& linked_file = linked_files[i];
+		if (!context->linkedFiles.insert(std::make_pair(linked_file.device, linked_file.inode)).second)
+		{
+			++totals.hardLinks;
+			continue;
+		}
+
+		++usage.files;
+		usage.logicalBytes += linked_file.size;
+		usage.allocatedBytes += linked_file.allocatedBytes;
+		addLargestEntry(usage.largestEntries, threshold, largest_count, directory->path(), linked_file.name,
+			linked_file.size, linked_file.allocatedBytes);
+	}
+
+	totals.logicalBytes += usage.logicalBytes;
+	totals.allocatedBytes += usage.allocatedBytes;
+	totals.files += usage.files;
+	totals.directories += usage.directories;
+	totals.symbolicLinks += usage.symbolicLinks;
+	totals.others += usage.others;
+	totals.errors += usage.errors;
+	if (largest_count > 0 && !usage.largestEntries.empty())
+	{
+		totals.largestEntries.insert(totals.largestEntries.end(), usage.largestEntries.begin(), usage.largestEntries.end());
+		if (totals.largestEntries.size() >= 2 * largest_count)
+		{
+			keepLargestEntries(totals.largestEntries, largest_count);
+		}
+	}
+}
+
+//====================================================================================
+//                                Path Query Methods
+//====================================================================================
+
+StatBatchResult statBatch(const StringList& paths, bool followSymbolicLinks)
+{
+	unsigned int count = paths.size();
+
+	StatBatchResult result;
+	result.errorCodes.resize(count, 0);
+	result.types.resize(count, OTHER_ENTRY);
+	result.sizes.resize(count, 0);
+	result.modes.resize(count, 0);
+	result.ownerIds.resize(count, 0);
+	result.groupIds.resize(count, 0);
+	result.modifiedDates.resize(count, 0);
+
+	// Small batches finish faster than the threads of a pool can be started
+	if (count < 2 * STAT_BATCH_CHUNK_SIZE)
+	{
+		statBatchRange(&paths, followSymbolicLinks, &result, 0, count);
+		return result;
+	}
+
+	// Each task fills in its own range of the arrays so no locking is needed
+	unsigned int number_of_tasks = (count + STAT_BATCH_CHUNK_SIZE - 1) / STAT_BATCH_CHUNK_SIZE;
+	ThreadPool pool(std::min(number_of_tasks, ThreadPool::idealThreadCount()));
+	for (unsigned int begin = 0; begin < count; begin += STAT_BATCH_CHUNK_SIZE)
+	{
+		unsigned int end = std::min(begin + STAT_BATCH_CHUNK_SIZE, count);
+		pool.submit(boost::bind(&statBatchRange, &paths, followSymbolicLinks, &result, begin, end));
+	}
+	pool.waitForDone();
+
+	return result;
+}
+
+//====================================================================================
+//                                 Directory Methods
+//====================================================================================
+
+bool removeDirectoryAndContents(const String& path, const RemoveOptions& options)
+{
+	// Split off the last component so the directory itself is removed relative to its parent
+	Path normalized(path);
+	String name = normalized.filename().toString();
+	String parent_path = normalized.parent().isEmpty() ? String(".") : normalized.parent().toString();
+	if (name.empty())
+	{
+		return false;
+	}
+
+	DirectoryHandle parent(new Directory());
+	Directory::Status status;
+	if (!parent->open(parent_path) || !parent->stat(name, status))
+	{
+		return false;
+	}
+
+	// Only remove the link itself when the path is a symbolic link to a directory
+	if (status.type == SYMBOLIC_LINK_ENTRY)
+	{
+		Directory::Status target_status;
+		if (!parent->stat(name, target_status, true) || target_status.type != DIRECTORY_ENTRY)
+		{
+			return false;
+		}
+
+		return parent->removeFile(name);
+	}
+	else if (status.type != DIRECTORY_ENTRY)
+	{
+		return false;
+	}
+
+	if (!options.removeInBackground)
+	{
+		RemoveContext context;
+		context.options = options;
+		context.pool = NULL;
+		context.failed = false;
+		return removeTree(&context, parent, name);
+	}
+
+	// Free up the path right away by renaming the tree to a hidden name next to it
+	String aside_name = String(".%1.removing-%2").arg(name, Uuid::genarateRandom().toString());
+	if (!parent->rename(name, aside_name))
+	{
+		return false;
+	}
+
+	RemoveContext* context = new RemoveContext();
+	context->options = options;
+	context->pool = NULL;
+	context->failed = false;
+	boost::thread thread(boost::bind(&removeTreeInBackground, context, parent, aside_name));
+	thread.detach();
+
+	return true;
+}
+
+bool copyDirectoryAndContents(const String& source, const String& destination, const CopyOptions& options)
+{
+	CopyContext context;
+	context.options = options;
+	context.pool = NULL;
+	context.failed = false;
+
+	// Fail if the source path is not a directory, everything below it is then read relative to the handle
+	DirectoryHandle source_directory(new Directory());
+	struct stat info;
+	if (!source_directory->open(source) || fstat(source_directory->descriptor(), &info) != 0)
+	{
+		reportCopyError(&context, source, errno);
+		return false;
+	}
+
+	// Make sure the destination does not exist
+	struct stat destination_info;
+	if (lstat(destination.c_str(), &destination_info) == 0)
+	{
+		reportCopyError(&context, destination, EEXIST);
+		return false;
+	}
+
+	// Create the destination directory along with any missing parent directories
+	mode_t mode = options.preservePermissions ? S_IRWXU : ((info.st_mode & 0777) | S_IRWXU);
+	if (mkdir(destination.c_str(), mode) != 0)
+	{
+		int error_code = errno;
+		if (error_code != ENOENT || !createFullDirectoryPath(destination))
+		{
+			reportCopyError(&context, destination, error_code);
+			return false;
+		}
+	}
+
+	DirectoryHandle destination_directory(new Directory());
+	if (!destination_directory->open(destination))
+	{
+		reportCopyError(&context, destination, errno);
+		return false;
+	}
+
+	CopiedDirectory root;
+	root.path = destination;
+	root.depth = 0;
+	root.info = info;
+	context.directories.push_back(root);
+
+	// Copy the whole tree before touching any directory attributes
+	{
+		ThreadPool pool(options.numberOfThreads);
+		context.pool = &pool;
+		pool.submit(boost::bind(&copyDirectoryContents, &context, source_directory, destination_directory, 0));
+		pool.waitForDone();
+		context.pool = NULL;
+	}
+
+	// Apply the deepest directories first since a parent may end up without write or search permission
+	std::stable_sort(context.directories.begin(), context.directories.end(), &isDeeperDirectory);
+	for (unsigned int i = 0; i < context.directories.size(); ++i)
+	{
+		applyDirectoryAttributes(&context, context.directories[i]);
+	}
+
+	return !context.failed;
+}
+
+//====================================================================================
+//                                   Walk Methods
+//====================================================================================
+
+bool walk(const String& path, const WalkVisitor& visitor, const WalkOptions& options)
+{
+	// Fail if the path is not a directory
+	struct stat info;
+	int error_code = 0;
+	if (stat(path.c_str(), &info) != 0)
+	{
+		error_code = errno;
+	}
+	else if (!S_ISDIR(info.st_mode))
+	{
+		error_code = ENOTDIR;
+	}
+
+	if (error_code != 0)
+	{
+		if (options.errorCallback)
+		{
+			options.errorCallback(path, error_code);
+		}
+		return false;
+	}
+
+	// Nothing can be reported without descending at least one level
+	if (options.maximumDepth == 0)
+	{
+		return true;
+	}
+
+	ThreadPool pool(options.numberOfThreads);
+
+	WalkContext context;
+	context.options = options;
+	context.visitor = visitor;
+	context.pattern = GlobPattern(options.pattern);
+	context.pool = &pool;
+	context.failed = false;
+	if (context.options.batchSize == 0)
+	{
+		context.options.batchSize = 1;
+	}
+	if (options.symbolicLinkPolicy == FOLLOW_SYMBOLIC_LINKS)
+	{
+		markDirectoryVisited(&context, info);
+	}
+
+	pool.submit(boost::bind(&walkDirectory, &context, path, 0));
+	pool.waitForDone();
+
+	return !context.failed;
+}
+
+StringList glob(const String& pattern)
+{
+	StringList matches;
+	GlobPattern compiled(pattern);
+	if (compiled.isEmpty())
+	{
+		return matches;
+	}
+
+	globDirectory(compiled, compiled.isAbsolute() ? String("/") : String(), 0, matches);
+
+	// Several '**' components can reach the same path along different splits
+	std::sort(matches.begin(), matches.end());
+	matches.erase(std::unique(matches.begin(), matches.end()), matches.end());
+
+	return matches;
+}
+
+//====================================================================================
+//                                 Snapshot Methods
+//====================================================================================
+
+Snapshot snapshot(const String& path, const Snapshot& previous, bool hashContents)
+{
+	// Throw an exception if the path is not a directory
+	struct stat info;
+	if (stat(path.c_str(), &info) != 0 || !S_ISDIR(info.st_mode))
+	{
+		String msg = String("The following path is not a directory: %1").arg(path);
+		throw FileSystemError(msg, BUMP_LOCATION);
+	}
+
+	Snapshot result;
+	result.rootPath = path;
+	result.hashesContents = hashContents;
+
+	SnapshotContext context;
+	context.prefix = path;
+	if (!context.prefix.endsWith("/"))
+	{
+		context.prefix.append("/");
+	}
+	context.previous = &previous;
+	context.snapshot = &result;
+	context.vanished = 0;
+
+	// Collect every path in the tree, then sort them so the diff can run in a single pass
+	WalkOptions walk_options;
+	walk_options.errorCallback = boost::bind(&collectSnapshotError, &context, _1, _2);
+	bool walked = walk(path, boost::bind(&collectSnapshotEntries, &result.entries, context.prefix.length(), _1), walk_options);
+
+	// A subtree that could not be read would show up as removed in a diff, so fail instead
+	if (!context.unreadable.empty())
+	{
+		String msg = String("Could not read %1 while taking a snapshot of %2").arg(context.unreadable.front(), path);
+		throw FileSystemError(msg, BUMP_LOCATION);
+	}
+	else if (!walked && context.vanished == 0)
+	{
+		String msg = String("Could not collect the entries while taking a snapshot of %1").arg(path);
+		throw FileSystemError(msg, BUMP_LOCATION);
+	}
+	std::sort(result.entries.begin(), result.entries.end(), &isSnapshotEntryBefore);
+
+	// Each task fills in its own range of the entries so no locking is needed
+	unsigned int count = result.entries.size();
+	unsigned int chunk_size = hashContents ? SNAPSHOT_HASH_CHUNK_SIZE : SNAPSHOT_CHUNK_SIZE;
+	unsigned int number_of_tasks = (count + chunk_size - 1) / chunk_size;
+	context.missing.resize(count, 0);
+	if (number_of_tasks < 2)
+	{
+		snapshotRange(&context, 0, count);
+	}
+	else
+	{
+		ThreadPool pool(std::min(number_of_tasks, ThreadPool::idealThreadCount()));
+		for (unsigned int begin = 0; begin < count; begin += chunk_size)
+		{
+			pool.submit(boost::bind(&snapshotRange, &context, begin, std::min(begin + chunk_size, count)));
+		}
+		pool.waitForDone();
+	}
+
+	// Drop the entries that disappeared while the snapshot was taken
+	unsigned int kept = 0;
+	for (unsigned int i = 0; i < count; ++i)
+	{
+		if (!context.missing[i])
+		{
+			if (kept != i)
+			{
+				result.entries[kept] = result.entries[i];
+			}
+			++kept;
+		}
+	}
+	result.entries.resize(kept);
+
+	return result;
+}
+
+//====================================================================================
+//                                Disk Usage Methods
+//====================================================================================
+
+DiskUsage diskUsage(const String& path, const DiskUsageOptions& options)
+{
+	// Throw an exception if the path does not exist
+	struct stat info;
+	if (stat(path.c_str(), &info) != 0)
+	{
+		String msg = String("The following path is not valid: %1").arg(path);
+		throw FileSystemError(msg, BUMP_LOCATION);
+	}
+
+	DiskUsageContext context;
+	context.options = options;
+	context.pool = NULL;
+	context.rootDevice = info.st_dev;
+	DiskUsage& usage = context.usage;
+	usage.allocatedBytes = (unsigned long long)info.st_blocks * 512;
+
+	if (!S_ISDIR(info.st_mode))
+	{
+		if (S_ISREG(info.st_mode))
+		{
+			usage.files = 1;
+			usage.logicalBytes = info.st_size;
+			if (options.numberOfLargestEntries > 0)
+			{
+				DiskUsageEntry entry;
+				entry.path = path;
+				entry.size = info.st_size;
+				entry.allocatedBytes = usage.allocatedBytes;
+				usage.largestEntries.push_back(entry);
+			}
+		}
+		else
+		{
+			usage.others = 1;
+		}
+		return usage;
+	}
+
+	usage.directories = 1;
+	DirectoryHandle root(new Directory());
+	if (!root->open(path))
+	{
+		usage.errors = 1;
+		return usage;
+	}
+
+	{
+		ThreadPool pool(options.numberOfThreads);
+		context.pool = &pool;
+		pool.submit(boost::bind(&addDirectoryUsage, &context, root));
+		pool.waitForDone();
+		context.pool = NULL;
+	}
+
+	keepLargestEntries(usage.largestEntries, options.numberOfLargestEntries);
+	std::sort(usage.largestEntries.begin(), usage.largestEntries.end(), &isLargerEntry);
+
+	return usage;
+}
+
+//====================================================================================
+//                                   File Methods
+//====================================================================================
+
+bool copyFile(const String& source, const String& destination)
+{
+	// Copy symbolic links as links like boost::filesystem::copy() always has
+	if (isSymbolicLink(source))
+	{
+		return FileInfo(source).isFile() && copySymbolicLink(source, destination);
+	}
+
+	// Fail if source is not a file
+	if (!isFile(source))
+	{
+		return false;
+	}
+
+	return copyFile(source, destination, FileCopyOptions()).succeeded;
+}
+
+FileCopyResult copyFile(const String& source, const String& destination, const FileCopyOptions& options)
+{
+	return copyFileAt(AT_FDCWD, source.c_str(), AT_FDCWD, destination.c_str(), options);
+}
 
 //====================================================================================
 //                                Permissions Methods
@@ -80,54 +2151,43 @@ bool setPermissions(const String& path, Permissions permissions)
 	}
 }
 
-Permissions permissions(const String& path)
+static Permissions convertPermissions(boost::filesystem::perms boostPermissions)
 {
-	// Make sure the path exists or throw an exception
-	if (!exists(path))
-	{
-		String msg = String("The following path is not valid: %1").arg(path);
-		throw FileSystemError(msg, BUMP_LOCATION);
-	}
-
-	// Get the permissions using boost
-	boost::filesystem::file_status status = boost::filesystem::status(boost::filesystem::path(path.c_str()));
-	boost::filesystem::perms boost_permissions = status.permissions();
-
 	// Create a bump permissions object by or'ing in all the boost permissions
 	Permissions permissions = 0;
-	if (boost_permissions & boost::filesystem::owner_read)
+	if (boostPermissions & boost::filesystem::owner_read)
 	{
         permissions |= OWNER_READ;
 	}
-	if (boost_permissions & boost::filesystem::owner_write)
+	if (boostPermissions & boost::filesystem::owner_write)
 	{
         permissions |= OWNER_WRITE;
 	}
-	if (boost_permissions & boost::filesystem::owner_exe)
+	if (boostPermissions & boost::filesystem::owner_exe)
 	{
         permissions |= OWNER_EXE;
 	}
-	if (boost_permissions & boost::filesystem::group_read)
+	if (boostPermissions & boost::filesystem::group_read)
 	{
         permissions |= GROUP_READ;
 	}
-	if (boost_permissions & boost::filesystem::group_write)
+	if (boostPermissions & boost::filesystem::group_write)
 	{
         permissions |= GROUP_WRITE;
 	}
-	if (boost_permissions & boost::filesystem::group_exe)
+	if (boostPermissions & boost::filesystem::group_exe)
 	{
         permissions |= GROUP_EXE;
 	}
-	if (boost_permissions & boost::filesystem::others_read)
+	if (boostPermissions & boost::filesystem::others_read)
 	{
         permissions |= OTHERS_READ;
 	}
-	if (boost_permissions & boost::filesystem::others_write)
+	if (boostPermissions & boost::filesystem::others_write)
 	{
         permissions |= OTHERS_WRITE;
 	}
-	if (boost_permissions & boost::filesystem::others_exe)
+	if (boostPermissions & boost::filesystem::others_exe)
 	{
         permissions |= OTHERS_EXE;
 	}
@@ -135,14 +2195,43 @@ Permissions permissions(const String& path)
 	return permissions;
 }
 
-bool setIsReadableByOwner(const String& path, bool isReadable)
+Permissions permissions(const String& path)
 {
-	Permissions permissions;
-	try
+	// Make sure the path exists or throw an exception
+	if (!exists(path))
+	{
+		String msg = String("The following path is not valid: %1").arg(path);
+		throw FileSystemError(msg, BUMP_LOCATION);
+	}
+
+	// Get the permissions using boost
+	boost::filesystem::file_status status = boost::filesystem::status(boost::filesystem::path(path.c_str()));
+	boost::filesystem::perms boost_permissions = status.permissions();
+
+	return convertPermissions(boost_permissions);
+}
+
+bool permissions(const String& path, Permissions& permissions, FileSystemStatus& status)
+{
+	boost::system::error_code error;
+	boost::filesystem::file_status file_status = boost::filesystem::status(boost::filesystem::path(path.c_str()), error);
+	if (error)
 	{
-		permissions = FileSystem::permissions(path);
+		errno = error.value();
+		status = fileSystemStatusFromErrorCode(error.value());
+		return false;
 	}
-	catch (const FileSystemError& /*e*/)
+
+	permissions = convertPermissions(file_status.permissions());
+	status = FILE_SYSTEM_SUCCESS;
+	return true;
+}
+
+bool setIsReadableByOwner(const String& path, bool isReadable)
+{
+	Permissions permissions;
+	FileSystemStatus status;
+	if (!FileSystem::permissions(path, permissions, status))
 	{
 		return false;
 	}
@@ -154,11 +2243,8 @@ bool setIsReadableByOwner(const String& path, bool isReadable)
 bool setIsWritableByOwner(const String& path, bool isWritable)
 {
 	Permissions permissions;
-	try
-	{
-		permissions = FileSystem::permissions(path);
-	}
-	catch (const FileSystemError& /*e*/)
+	FileSystemStatus status;
+	if (!FileSystem::permissions(path, permissions, status))
 	{
 		return false;
 	}
@@ -170,11 +2256,8 @@ bool setIsWritableByOwner(const String& path, bool isWritable)
 bool setIsExecutableByOwner(const String& path, bool isExecutable)
 {
 	Permissions permissions;
-	try
-	{
-		permissions = FileSystem::permissions(path);
-	}
-	catch (const FileSystemError& /*e*/)
+	FileSystemStatus status;
+	if (!FileSystem::permissions(path, permissions, status))
 	{
 		return false;
 	}
@@ -186,11 +2269,8 @@ bool setIsExecutableByOwner(const String& path, bool isExecutable)
 bool setIsReadableByGroup(const String& path, bool isReadable)
 {
 	Permissions permissions;
-	try
-	{
-		permissions = FileSystem::permissions(path);
-	}
-	catch (const FileSystemError& /*e*/)
+	FileSystemStatus status;
+	if (!FileSystem::permissions(path, permissions, status))
 	{
 		return false;
 	}
@@ -202,11 +2282,8 @@ bool setIsReadableByGroup(const String& path, bool isReadable)
 bool setIsWritableByGroup(const String& path, bool isWritable)
 {
 	Permissions permissions;
-	try
-	{
-		permissions = FileSystem::permissions(path);
-	}
-	catch (const FileSystemError& /*e*/)
+	FileSystemStatus status;
+	if (!FileSystem::permissions(path, permissions, status))
 	{
 		return false;
 	}
@@ -218,11 +2295,8 @@ bool setIsWritableByGroup(const String& path, bool isWritable)
 bool setIsExecutableByGroup(const String& path, bool isExecutable)
 {
 	Permissions permissions;
-	try
-	{
-		permissions = FileSystem::permissions(path);
-	}
-	catch (const FileSystemError& /*e*/)
+	FileSystemStatus status;
+	if (!FileSystem::permissions(path, permissions, status))
 	{
 		return false;
 	}
@@ -234,11 +2308,8 @@ bool setIsExecutableByGroup(const String& path, bool isExecutable)
 bool setIsReadableByOthers(const String& path, bool isReadable)
 {
 	Permissions permissions;
-	try
-	{
-		permissions = FileSystem::permissions(path);
-	}
-	catch (const FileSystemError& /*e*/)
+	FileSystemStatus status;
+	if (!FileSystem::permissions(path, permissions, status))
 	{
 		return false;
 	}
@@ -250,11 +2321,8 @@ bool setIsReadableByOthers(const String& path, bool isReadable)
 bool setIsWritableByOthers(const String& path, bool isWritable)
 {
 	Permissions permissions;
-	try
-	{
-		permissions = FileSystem::permissions(path);
-	}
-	catch (const FileSystemError& /*e*/)
+	FileSystemStatus status;
+	if (!FileSystem::permissions(path, permissions, status))
 	{
 		return false;
 	}
@@ -266,11 +2334,8 @@ bool setIsWritableByOthers(const String& path, bool isWritable)
 bool setIsExecutableByOthers(const String& path, bool isExecutable)
 {
 	Permissions permissions;
-	try
-	{
-		permissions = FileSystem::permissions(path);
-	}
-	catch (const FileSystemError& /*e*/)
+	FileSystemStatus status;
+	if (!FileSystem::permissions(path, permissions, status))
 	{
 		return false;
 	}
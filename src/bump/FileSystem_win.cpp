@@ -6,6 +6,10 @@
 //  Copyright (c) 2012 Christian Noon. All rights reserved.
 //
 
+// Boost headers
+#include <boost/filesystem.hpp>
+#include <boost/foreach.hpp>
+
 // Bump headers
 #include <bump/FileSystem.h>
 #include <bump/NotImplementedError.h>
@@ -14,6 +18,176 @@ namespace bump {
 
 namespace FileSystem {
 
+//====================================================================================
+//                                Path Query Methods
+//====================================================================================
+
+StatBatchResult statBatch(const StringList& paths, bool followSymbolicLinks)
+{
+	String msg = "The bump::FileSystem::statBatch() method is not implemented on Windows";
+	throw NotImplementedError(msg, BUMP_LOCATION);
+}
+
+//====================================================================================
+//                                 Directory Methods
+//====================================================================================
+
+bool removeDirectoryAndContents(const String& path, const RemoveOptions& /*options*/)
+{
+	// Fail if the path is not a directory
+	if (!FileInfo(path).isDirectory())
+	{
+		return false;
+	}
+
+	try
+	{
+		boost::filesystem::remove_all(boost::filesystem::path(path.c_str()));
+		return true;
+	}
+	catch (const boost::filesystem::filesystem_error& /*e*/)
+	{
+		return false;
+	}
+}
+
+bool copyDirectoryAndContents(const String& source, const String& destination, const CopyOptions& /*options*/)
+{
+	// Fail if the source path is not a directory
+	if (!FileInfo(source).isDirectory())
+	{
+		return false;
+	}
+
+	// Create a FileInfo objects for the source and destination
+	FileInfo source_info(source);
+	FileInfo destination_info(destination);
+
+	// Make sure the destination does not exist
+	if (destination_info.exists())
+	{
+		return false;
+	}
+
+	// Create the destination directory
+	bool created_destination_directory = createFullDirectoryPath(destination);
+	if (!created_destination_directory)
+	{
+		return false;
+	}
+
+	// Iterate through the local source directory
+	FileInfoList local_source_files = directoryInfoList(source);
+	BOOST_FOREACH (const FileInfo& local_source_file, local_source_files)
+	{
+		bool copied_successfully;
+
+		// Attempt to copy all types of file system objects
+		if (local_source_file.isDirectory())
+		{
+			// Create the local destination directory path
+			String filename = local_source_file.filename();
+			String local_destination_directory = join(destination, filename);
+
+			// Copy the local source directory to the local destination directory
+			copied_successfully = copyDirectoryAndContents(local_source_file.absolutePath(), local_destination_directory, CopyOptions());
+		}
+		else if (local_source_file.isSymbolicLink())
+		{
+			// Create the local destination symbolic link
+			String filename = local_source_file.filename();
+			String local_destination_file = join(destination, filename);
+
+			// Copy the local source symbolic link to the local destination
+			copied_successfully = copySymbolicLink(local_source_file.absolutePath(), local_destination_file);
+		}
+		else // local_source_info.isFile()
+		{
+			// Create the local destination filepath
+			String filename = local_source_file.filename();
+			String local_destination_file = join(destination, filename);
+
+			// Copy the local source file to the local destination
+			copied_successfully = copyFile(local_source_file.absolutePath(), local_destination_file);
+		}
+
+		// Fail if we did not copy the file system object successfully
+		if (!copied_successfully)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+//====================================================================================
+//                                   Walk Methods
+//====================================================================================
+
+bool walk(const String& path, const WalkVisitor& visitor, const WalkOptions& options)
+{
+	String msg = "The bump::FileSystem::walk() method is not implemented on Windows";
+	throw NotImplementedError(msg, BUMP_LOCATION);
+}
+
+StringList glob(const String& pattern)
+{
+	String msg = "The bump::FileSystem::glob() method is not implemented on Windows";
+	throw NotImplementedError(msg, BUMP_LOCATION);
+}
+
+//====================================================================================
+//                                 Snapshot Methods
+//====================================================================================
+
+Snapshot snapshot(const String& path, const Snapshot& previous, bool hashContents)
+{
+	String msg = "The bump::FileSystem::snapshot() method is not implemented on Windows";
+	throw NotImplementedError(msg, BUMP_LOCATION);
+}
+
+//====================================================================================
+//                                Disk Usage Methods
+//====================================================================================
+
+DiskUsage diskUsage(const String& path, const DiskUsageOptions& options)
+{
+	String msg = "The bump::FileSystem::diskUsage() method is not implemented on Windows";
+	throw NotImplementedError(msg, BUMP_LOCATION);
+}
+
+//====================================================================================
+//                                   File Methods
+//====================================================================================
+
+bool copyFile(const String& source, const String& destination)
+{
+	// Fail if source is not a file
+	if (!FileInfo(source).isFile())
+	{
+		return false;
+	}
+
+	try
+	{
+		boost::filesystem::path source_path(source.c_str());
+		boost::filesystem::path destination_path(destination.c_str());
+		boost::filesystem::copy(source_path, destination_path);
+		return true;
+	}
+	catch (const boost::filesystem::filesystem_error& /*e*/)
+	{
+		return false;
+	}
+}
+
+FileCopyResult copyFile(const String& source, const String& destination, const FileCopyOptions& options)
+{
+	String msg = "The bump::FileSystem::copyFile() method with options is not implemented on Windows";
+	throw NotImplementedError(msg, BUMP_LOCATION);
+}
+
 //====================================================================================
 //                                Permissions Methods
 //====================================================================================
@@ -30,6 +204,12 @@ Permissions permissions(const String& path)
 	throw NotImplementedError(msg, BUMP_LOCATION);
 }
 
+bool permissions(const String& path, Permissions& permissions, FileSystemStatus& status)
+{
+	String msg = "The bump::FileSystem::permissions() method is not implemented on Windows";
+	throw NotImplementedError(msg, BUMP_LOCATION);
+}
+
 bool setIsReadableByOwner(const String& path, bool isReadable)
 {
 	String msg = "The bump::FileSystem::setIsReadableByOwner() method is not implemented on Windows";
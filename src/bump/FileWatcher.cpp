@@ -0,0 +1,161 @@
+//
+//  FileWatcher.cpp
+//  Bump
+//
+//  Created by Joseph Holub on 10/18/26.
+//  Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+// Bump headers
+#include <bump/FileWatcher.h>
+#include <bump/NotificationCenter.h>
+
+namespace bump {
+
+FileWatcher::FileWatcher() :
+	_coalescingInterval(50),
+	_deliveryMode(IMMEDIATE_DELIVERY),
+	_descriptor(-1)
+{
+	_wakeDescriptors[0] = -1;
+	_wakeDescriptors[1] = -1;
+	initialize();
+}
+
+FileWatcher::~FileWatcher()
+{
+	stop();
+	cleanup();
+}
+
+StringList FileWatcher::watchedPaths()
+{
+	boost::mutex::scoped_lock lock(_mutex);
+	StringList paths;
+	for (WatchMap::const_iterator iter = _watches.begin(); iter != _watches.end(); ++iter)
+	{
+		paths.push_back(iter->second.path);
+	}
+
+	return paths;
+}
+
+void FileWatcher::setCoalescingInterval(unsigned int milliseconds)
+{
+	boost::mutex::scoped_lock lock(_mutex);
+	_coalescingInterval = milliseconds;
+}
+
+unsigned int FileWatcher::coalescingInterval()
+{
+	boost::mutex::scoped_lock lock(_mutex);
+	return _coalescingInterval;
+}
+
+void FileWatcher::setCallback(const ChangeCallback& callback, DeliveryMode deliveryMode)
+{
+	boost::mutex::scoped_lock lock(_mutex);
+	_callback = callback;
+	_deliveryMode = deliveryMode;
+}
+
+void FileWatcher::setNotificationName(const String& notificationName)
+{
+	boost::mutex::scoped_lock lock(_mutex);
+	_notificationName = notificationName;
+}
+
+String FileWatcher::notificationName()
+{
+	boost::mutex::scoped_lock lock(_mutex);
+	return _notificationName;
+}
+
+unsigned int FileWatcher::processChanges(unsigned int timeoutMilliseconds)
+{
+	// Wait for the first batch, then take everything that is queued
+	std::deque<FileChangeList> batches;
+	ChangeCallback callback;
+	{
+		boost::mutex::scoped_lock lock(_mutex);
+		if (_queuedChanges.empty() && timeoutMilliseconds > 0)
+		{
+			boost::system_time timeout = boost::get_system_time() + boost::posix_time::milliseconds(timeoutMilliseconds);
+			while (_queuedChanges.empty())
+			{
+				if (!_changesQueued.timed_wait(lock, timeout))
+				{
+					break;
+				}
+			}
+		}
+
+		batches.swap(_queuedChanges);
+		callback = _callback;
+	}
+
+	// Call the callback without holding the lock so it can use the watcher
+	if (callback)
+	{
+		for (unsigned int i = 0; i < batches.size(); ++i)
+		{
+			callback(batches[i]);
+		}
+	}
+
+	return batches.size();
+}
+
+bool FileWatcher::isRunning()
+{
+	boost::mutex::scoped_lock lock(_mutex);
+	return _thread.get() != NULL;
+}
+
+void FileWatcher::coalesceChange(std::map<String, FileChange>& pending, const String& path, unsigned int changes, bool isDirectory)
+{
+	std::map<String, FileChange>::iterator iter = pending.find(path);
+	if (iter != pending.end())
+	{
+		iter->second.changes |= changes;
+		iter->second.isDirectory = iter->second.isDirectory || isDirectory;
+		return;
+	}
+
+	FileChange change;
+	change.path = path;
+	change.changes = changes;
+	change.isDirectory = isDirectory;
+	pending.insert(std::make_pair(path, change));
+}
+
+void FileWatcher::deliverChanges(const FileChangeList& changes)
+{
+	ChangeCallback callback;
+	DeliveryMode delivery_mode;
+	String notification_name;
+	{
+		boost::mutex::scoped_lock lock(_mutex);
+		callback = _callback;
+		delivery_mode = _deliveryMode;
+		notification_name = _notificationName;
+
+		if (delivery_mode == QUEUED_DELIVERY)
+		{
+			_queuedChanges.push_back(changes);
+			_changesQueued.notify_all();
+		}
+	}
+
+	if (delivery_mode == IMMEDIATE_DELIVERY && callback)
+	{
+		callback(changes);
+	}
+
+	if (!notification_name.isEmpty())
+	{
+		NotificationCenter::instance()->postNotificationWithObject(notification_name, changes);
+	}
+}
+
+}	// End of bump namespace
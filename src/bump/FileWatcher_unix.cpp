@@ -0,0 +1,404 @@
+//
+//  FileWatcher_unix.cpp
+//  Bump
+//
+//  Created by Joseph Holub on 10/18/26.
+//  Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+// Boost headers
+#include <boost/bind.hpp>
+#include <boost/chrono.hpp>
+
+// Bump headers
+#include <bump/Directory.h>
+#include <bump/FileSystem.h>
+#include <bump/FileWatcher.h>
+#include <bump/NotImplementedError.h>
+
+// C++ headers
+#include <algorithm>
+
+// Unix headers
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+
+// Linux headers
+#ifdef __linux__
+#include <sys/inotify.h>
+#endif
+
+namespace bump {
+
+#ifdef __linux__
+
+// The inotify events the watcher listens for
+static const uint32_t WATCH_MASK = IN_CREATE | IN_MODIFY | IN_DELETE | IN_ATTRIB | IN_MOVED_FROM |
+	IN_MOVED_TO | IN_DELETE_SELF | IN_MOVE_SELF;
+
+// Deliver a batch after this many coalescing intervals even if the changes never stop
+static const unsigned int MAXIMUM_COALESCING_INTERVALS = 10;
+
+// The clock used to time the coalescing intervals
+typedef boost::chrono::steady_clock Clock;
+
+static unsigned int changesFromMask(uint32_t mask)
+{
+	unsigned int changes = 0;
+	if (mask & IN_CREATE)
+	{
+		changes |= FileWatcher::CREATED;
+	}
+	if (mask & IN_MODIFY)
+	{
+		changes |= FileWatcher::MODIFIED;
+	}
+	if (mask & (IN_DELETE | IN_DELETE_SELF))
+	{
+		changes |= FileWatcher::REMOVED;
+	}
+	if (mask & IN_ATTRIB)
+	{
+		changes |= FileWatcher::ATTRIBUTES_CHANGED;
+	}
+	if (mask & (IN_MOVED_FROM | IN_MOVE_SELF))
+	{
+		changes |= FileWatcher::MOVED_FROM;
+	}
+	if (mask & IN_MOVED_TO)
+	{
+		changes |= FileWatcher::MOVED_TO;
+	}
+
+	return changes;
+}
+
+static long long millisecondsSince(const Clock::time_point& time)
+{
+	return boost::chrono::duration_cast<boost::chrono::milliseconds>(Clock::now() - time).count();
+}
+
+#endif
+
+void FileWatcher::initialize()
+{
+#ifdef __linux__
+	_descriptor = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+	if (pipe(_wakeDescriptors) == 0)
+	{
+		fcntl(_wakeDescriptors[0], F_SETFL, O_NONBLOCK);
+	}
+#endif
+}
+
+void FileWatcher::cleanup()
+{
+	if (_descriptor >= 0)
+	{
+		close(_descriptor);
+	}
+
+	for (unsigned int i = 0; i < 2; ++i)
+	{
+		if (_wakeDescriptors[i] >= 0)
+		{
+			close(_wakeDescriptors[i]);
+		}
+	}
+}
+
+bool FileWatcher::addPath(const String& path, bool recursive)
+{
+#ifdef __linux__
+	// Store the paths without trailing slashes so the changed paths are joined consistently
+	String watch_path = path;
+	while (watch_path.length() > 1 && watch_path.endsWith("/"))
+	{
+		watch_path = watch_path.left(watch_path.length() - 1);
+	}
+
+	return addWatches(watch_path, watch_path, recursive, NULL);
+#else
+	String msg = "The bump::FileWatcher::addPath() method is only implemented on Linux";
+	throw NotImplementedError(msg, BUMP_LOCATION);
+#endif
+}
+
+bool FileWatcher::removePath(const String& path)
+{
+#ifdef __linux__
+	String root_path = path;
+	while (root_path.length() > 1 && root_path.endsWith("/"))
+	{
+		root_path = root_path.left(root_path.length() - 1);
+	}
+
+	// Remove the path along with every directory that was watched because of it
+	boost::mutex::scoped_lock lock(_mutex);
+	bool removed = false;
+	WatchMap::iterator iter = _watches.begin();
+	while (iter != _watches.end())
+	{
+		if (iter->second.rootPath == root_path)
+		{
+			inotify_rm_watch(_descriptor, iter->first);
+			_watches.erase(iter++);
+			removed = true;
+		}
+		else
+		{
+			++iter;
+		}
+	}
+
+	return removed;
+#else
+	String msg = "The bump::FileWatcher::removePath() method is only implemented on Linux";
+	throw NotImplementedError(msg, BUMP_LOCATION);
+#endif
+}
+
+bool FileWatcher::addWatches(const String& path, const String& rootPath, bool recursive, std::map<String, FileChange>* created)
+{
+#ifdef __linux__
+	if (_descriptor < 0)
+	{
+		return false;
+	}
+
+	// Walk the tree serially, watching each directory before listing it so nothing created in between is missed
+	bool watched = false;
+	StringList directories(1, path);
+	while (!directories.empty())
+	{
+		String directory_path = directories.back();
+		directories.pop_back();
+
+		int watch_descriptor = inotify_add_watch(_descriptor, directory_path.c_str(), WATCH_MASK);
+		if (watch_descriptor < 0)
+		{
+			continue;
+		}
+
+		{
+			boost::mutex::scoped_lock lock(_mutex);
+			Watch& watch = _watches[watch_descriptor];
+			watch.path = directory_path;
+			watch.rootPath = rootPath;
+			watch.recursive = recursive;
+		}
+		watched = watched || (directory_path == path);
+
+		Directory directory;
+		Directory::EntryList entries;
+		if (!recursive || !directory.open(directory_path))
+		{
+			continue;
+		}
+		directory.list(entries);
+
+		String prefix = directory_path.endsWith("/") ? directory_path : directory_path + "/";
+		for (unsigned int i = 0; i < entries.size(); ++i)
+		{
+			String child_path = prefix + entries[i].name;
+			bool is_directory = entries[i].type == FileSystem::DIRECTORY_ENTRY;
+			if (created != NULL)
+			{
+				coalesceChange(*created, child_path, CREATED, is_directory);
+			}
+			if (is_directory)
+			{
+				directories.push_back(child_path);
+			}
+		}
+	}
+
+	return watched;
+#else
+	String msg = "The bump::FileWatcher::addPath() method is only implemented on Linux";
+	throw NotImplementedError(msg, BUMP_LOCATION);
+#endif
+}
+
+bool FileWatcher::start()
+{
+#ifdef __linux__
+	boost::mutex::scoped_lock lock(_mutex);
+	if (_thread.get() != NULL)
+	{
+		return true;
+	}
+	else if (_descriptor < 0 || _wakeDescriptors[0] < 0)
+	{
+		return false;
+	}
+
+	_thread.reset(new boost::thread(boost::bind(&FileWatcher::run, this)));
+	return true;
+#else
+	String msg = "The bump::FileWatcher::start() method is only implemented on Linux";
+	throw NotImplementedError(msg, BUMP_LOCATION);
+#endif
+}
+
+void FileWatcher::stop()
+{
+	boost::scoped_ptr<boost::thread> thread;
+	{
+		boost::mutex::scoped_lock lock(_mutex);
+		thread.swap(_thread);
+	}
+
+	if (thread.get() == NULL)
+	{
+		return;
+	}
+
+	// Wake the watcher thread up and wait for it to exit
+	char wake = 1;
+	while (write(_wakeDescriptors[1], &wake, 1) < 0 && errno == EINTR)
+	{
+		;
+	}
+	thread->join();
+
+	// Drain the pipe so the watcher can be started again
+	while (read(_wakeDescriptors[0], &wake, 1) > 0)
+	{
+		;
+	}
+}
+
+void FileWatcher::run()
+{
+#ifdef __linux__
+	// The buffer must be aligned for the inotify_event structures read into it
+	union
+	{
+		struct inotify_event	event;
+		char					bytes[64 * 1024];
+	} buffer;
+
+	std::map<String, FileChange> pending;
+	Clock::time_point first_change;
+	Clock::time_point last_change;
+
+	while (true)
+	{
+		// Sleep until there are changes, or until the pending batch is ready to deliver
+		long long interval = coalescingInterval();
+		int timeout = -1;
+		if (!pending.empty())
+		{
+			long long quiet_remaining = interval - millisecondsSince(last_change);
+			long long maximum_remaining = interval * MAXIMUM_COALESCING_INTERVALS - millisecondsSince(first_change);
+			timeout = (int)std::max(0LL, std::min(quiet_remaining, maximum_remaining));
+		}
+
+		struct pollfd descriptors[2];
+		descriptors[0].fd = _descriptor;
+		descriptors[0].events = POLLIN;
+		descriptors[0].revents = 0;
+		descriptors[1].fd = _wakeDescriptors[0];
+		descriptors[1].events = POLLIN;
+		descriptors[1].revents = 0;
+		int result = poll(descriptors, 2, timeout);
+		if (result < 0 && errno != EINTR)
+		{
+			return;
+		}
+
+		// Exit when stop() writes to the pipe
+		if (descriptors[1].revents & POLLIN)
+		{
+			return;
+		}
+
+		// Read every event that is available
+		while (descriptors[0].revents & POLLIN)
+		{
+			ssize_t length = read(_descriptor, buffer.bytes, sizeof(buffer.bytes));
+			if (length <= 0)
+			{
+				break;
+			}
+
+			if (pending.empty())
+			{
+				first_change = Clock::now();
+			}
+			last_change = Clock::now();
+
+			for (char* position = buffer.bytes; position < buffer.bytes + length; )
+			{
+				struct inotify_event* event = reinterpret_cast<struct inotify_event*>(position);
+				position += sizeof(struct inotify_event) + event->len;
+
+				if (event->mask & IN_Q_OVERFLOW)
+				{
+					coalesceChange(pending, String(), OVERFLOWED, false);
+					continue;
+				}
+
+				// Look up the watch, forgetting it once the kernel has dropped it
+				Watch watch;
+				{
+					boost::mutex::scoped_lock lock(_mutex);
+					WatchMap::iterator iter = _watches.find(event->wd);
+					if (iter == _watches.end())
+					{
+						continue;
+					}
+					watch = iter->second;
+
+					if (event->mask & IN_IGNORED)
+					{
+						_watches.erase(iter);
+						continue;
+					}
+				}
+
+				String path = watch.path;
+				if (event->len > 0)
+				{
+					path.append("/");
+					path.append(event->name);
+				}
+
+				bool is_directory = (event->mask & IN_ISDIR) != 0;
+				unsigned int changes = changesFromMask(event->mask);
+				if (changes != 0)
+				{
+					coalesceChange(pending, path, changes, is_directory);
+				}
+
+				// Watch directories as they appear inside recursive trees, reporting whatever they already hold
+				if (watch.recursive && is_directory && (event->mask & (IN_CREATE | IN_MOVED_TO)))
+				{
+					addWatches(path, watch.rootPath, true, &pending);
+				}
+			}
+		}
+
+		// Deliver the batch once things have been quiet for long enough
+		if (!pending.empty() &&
+			(millisecondsSince(last_change) >= interval ||
+			 millisecondsSince(first_change) >= interval * MAXIMUM_COALESCING_INTERVALS))
+		{
+			FileChangeList changes;
+			changes.reserve(pending.size());
+			for (std::map<String, FileChange>::const_iterator iter = pending.begin(); iter != pending.end(); ++iter)
+			{
+				changes.push_back(iter->second);
+			}
+			pending.clear();
+
+			deliverChanges(changes);
+		}
+	}
+#endif
+}
+
+}	// End of bump namespace
@@ -0,0 +1,59 @@
+//
+//  FileWatcher_win.cpp
+//  Bump
+//
+//  Created by Joseph Holub on 10/18/26.
+//  Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+// Bump headers
+#include <bump/FileWatcher.h>
+#include <bump/NotImplementedError.h>
+
+namespace bump {
+
+void FileWatcher::initialize()
+{
+	;
+}
+
+void FileWatcher::cleanup()
+{
+	;
+}
+
+bool FileWatcher::addPath(const String& path, bool recursive)
+{
+	String msg = "The bump::FileWatcher::addPath() method is not implemented on Windows";
+	throw NotImplementedError(msg, BUMP_LOCATION);
+}
+
+bool FileWatcher::removePath(const String& path)
+{
+	String msg = "The bump::FileWatcher::removePath() method is not implemented on Windows";
+	throw NotImplementedError(msg, BUMP_LOCATION);
+}
+
+bool FileWatcher::addWatches(const String& path, const String& rootPath, bool recursive, std::map<String, FileChange>* created)
+{
+	String msg = "The bump::FileWatcher::addPath() method is not implemented on Windows";
+	throw NotImplementedError(msg, BUMP_LOCATION);
+}
+
+bool FileWatcher::start()
+{
+	String msg = "The bump::FileWatcher::start() method is not implemented on Windows";
+	throw NotImplementedError(msg, BUMP_LOCATION);
+}
+
+void FileWatcher::stop()
+{
+	;
+}
+
+void FileWatcher::run()
+{
+	;
+}
+
+}	// End of bump namespace
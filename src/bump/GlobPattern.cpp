@@ -0,0 +1,345 @@
+//
+//  GlobPattern.cpp
+//  Bump
+//
+//  Created by Joseph Holub on 10/18/26.
+//  Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+// Bump headers
+#include <bump/GlobPattern.h>
+
+// C headers
+#include <string.h>
+
+namespace bump {
+
+//====================================================================================
+//                                 Matching Helpers
+//====================================================================================
+
+static const std::size_t NO_WILDCARD = (std::size_t)-1;
+
+static std::size_t findClassEnd(const StringView& text, std::size_t start)
+{
+	// A ']' right after the opening bracket or its negation is part of the set
+	std::size_t position = start + 1;
+	if (position < text.length() && (text[position] == '!' || text[position] == '^'))
+	{
+		++position;
+	}
+	if (position < text.length() && text[position] == ']')
+	{
+		++position;
+	}
+
+	while (position < text.length() && text[position] != ']')
+	{
+		++position;
+	}
+
+	return position < text.length() ? position : NO_WILDCARD;
+}
+
+static void splitPath(const StringView& path, std::vector<StringView>& names)
+{
+	std::size_t start = 0;
+	while (start < path.length())
+	{
+		std::size_t end = path.indexOf('/', start);
+		if (end == StringView::npos)
+		{
+			end = path.length();
+		}
+
+		if (end > start)
+		{
+			names.push_back(path.section(start, end - start));
+		}
+		start = end + 1;
+	}
+}
+
+//====================================================================================
+//                                   GlobPattern
+//====================================================================================
+
+GlobPattern::GlobPattern() :
+	_pattern(),
+	_isAbsolute(false),
+	_matchesDirectoriesOnly(false),
+	_components()
+{
+	;
+}
+
+GlobPattern::GlobPattern(const String& pattern) :
+	_pattern(pattern),
+	_isAbsolute(!pattern.empty() && pattern[0] == '/'),
+	_matchesDirectoriesOnly(pattern.length() > 1 && pattern[pattern.length() - 1] == '/'),
+	_components()
+{
+	std::vector<StringView> names;
+	splitPath(_pattern, names);
+
+	_components.reserve(names.size());
+	for (std::size_t i = 0; i < names.size(); ++i)
+	{
+		Component component = compileComponent(names[i]);
+
+		// Consecutive '**' components match exactly what a single one does
+		if (component.isRecursive && !_components.empty() && _components.back().isRecursive)
+		{
+			continue;
+		}
+		_components.push_back(component);
+	}
+}
+
+const String& GlobPattern::pattern() const
+{
+	return _pattern;
+}
+
+bool GlobPattern::isEmpty() const
+{
+	return _components.empty();
+}
+
+bool GlobPattern::isAbsolute() const
+{
+	return _isAbsolute;
+}
+
+bool GlobPattern::matchesDirectoriesOnly() const
+{
+	return _matchesDirectoriesOnly;
+}
+
+unsigned int GlobPattern::numberOfComponents() const
+{
+	return _components.size();
+}
+
+bool GlobPattern::isLiteral(unsigned int component) const
+{
+	return _components[component].isLiteral;
+}
+
+bool GlobPattern::isRecursive(unsigned int component) const
+{
+	return _components[component].isRecursive;
+}
+
+const String& GlobPattern::literal(unsigned int component) const
+{
+	return _components[component].literal;
+}
+
+bool GlobPattern::matches(unsigned int component, const StringView& name) const
+{
+	const Component& compiled = _components[component];
+	if (compiled.isLiteral)
+	{
+		return name.length() == (std::size_t)compiled.literal.length() && memcmp(name.data(), compiled.literal.data(), name.length()) == 0;
+	}
+	else if (compiled.isRecursive)
+	{
+		return true;
+	}
+
+	// Walk the tokens remembering the last '*' so a failed match can retry it one character longer
+	const char* text = name.data();
+	std::size_t length = name.length();
+	std::size_t token_count = compiled.tokens.size();
+	std::size_t token = 0;
+	std::size_t position = 0;
+	std::size_t star_token = NO_WILDCARD;
+	std::size_t star_position = 0;
+	while (true)
+	{
+		if (token < token_count)
+		{
+			const Token& current = compiled.tokens[token];
+			if (current.type == Token::ANY_STRING)
+			{
+				star_token = token;
+				star_position = position;
+				++token;
+				continue;
+			}
+			else if (current.type == Token::LITERAL)
+			{
+				std::size_t literal_length = current.text.length();
+				if (length - position >= literal_length && memcmp(text + position, current.text.data(), literal_length) == 0)
+				{
+					position += literal_length;
+					++token;
+					continue;
+				}
+			}
+			else if (position < length &&
+				(current.type == Token::ANY_CHARACTER || current.characters.test((unsigned char)text[position])))
+			{
+				++position;
+				++token;
+				continue;
+			}
+		}
+		else if (position == length)
+		{
+			return true;
+		}
+
+		// Nothing matched here, so let the last '*' swallow one more character and try again
+		if (star_token == NO_WILDCARD || star_position == length)
+		{
+			return false;
+		}
+		position = ++star_position;
+		token = star_token + 1;
+	}
+}
+
+bool GlobPattern::matches(const StringView& path) const
+{
+	bool is_absolute = !path.isEmpty() && path[0] == '/';
+	if (is_absolute != _isAbsolute)
+	{
+		return false;
+	}
+
+	std::vector<StringView> names;
+	splitPath(path, names);
+
+	return matchesFrom(0, names, 0);
+}
+
+GlobPattern::Component GlobPattern::compileComponent(const StringView& text)
+{
+	Component component;
+	component.isLiteral = false;
+	component.isRecursive = (text == "**");
+	if (component.isRecursive)
+	{
+		return component;
+	}
+
+	std::size_t position = 0;
+	while (position < text.length())
+	{
+		char character = text[position];
+		std::size_t class_end = character == '[' ? findClassEnd(text, position) : NO_WILDCARD;
+
+		Token token;
+		if (character == '*')
+		{
+			// Runs of '*' match exactly what a single one does
+			if (component.tokens.empty() || component.tokens.back().type != Token::ANY_STRING)
+			{
+				token.type = Token::ANY_STRING;
+				component.tokens.push_back(token);
+			}
+			++position;
+			continue;
+		}
+		else if (character == '?')
+		{
+			token.type = Token::ANY_CHARACTER;
+			component.tokens.push_back(token);
+			++position;
+			continue;
+		}
+		else if (class_end != NO_WILDCARD)
+		{
+			token.type = Token::CHARACTER_CLASS;
+			std::size_t member = position + 1;
+			bool is_negated = (text[member] == '!' || text[member] == '^');
+			if (is_negated)
+			{
+				++member;
+			}
+
+			// The first member is never the closing bracket, even when it is a ']'
+			do
+			{
+				unsigned char first = text[member];
+				unsigned char last = first;
+				if (member + 2 < class_end && text[member + 1] == '-')
+				{
+					last = text[member + 2];
+					member += 2;
+				}
+				for (unsigned int value = first; value <= last; ++value)
+				{
+					token.characters.set(value);
+				}
+				++member;
+			} while (member < class_end);
+
+			if (is_negated)
+			{
+				token.characters.flip();
+			}
+			token.characters.reset('/');
+			component.tokens.push_back(token);
+			position = class_end + 1;
+			continue;
+		}
+
+		// Everything else, including a bracket without a closing one, is literal text
+		if (character == '\\' && position + 1 < text.length())
+		{
+			++position;
+			character = text[position];
+		}
+		if (component.tokens.empty() || component.tokens.back().type != Token::LITERAL)
+		{
+			token.type = Token::LITERAL;
+			component.tokens.push_back(token);
+		}
+		component.tokens.back().text.push_back(character);
+		++position;
+	}
+
+	// A component without any wildcards is matched with a single comparison
+	component.isLiteral = (component.tokens.empty() ||
+		(component.tokens.size() == 1 && component.tokens[0].type == Token::LITERAL));
+	if (component.isLiteral)
+	{
+		component.literal = component.tokens.empty() ? String() : String(component.tokens[0].text);
+		component.tokens.clear();
+	}
+
+	return component;
+}
+
+bool GlobPattern::matchesFrom(unsigned int component, const std::vector<StringView>& names, unsigned int name) const
+{
+	while (component < _components.size())
+	{
+		if (_components[component].isRecursive)
+		{
+			// Try letting the '**' swallow every possible number of directories
+			for (unsigned int skipped = name; skipped <= names.size(); ++skipped)
+			{
+				if (matchesFrom(component + 1, names, skipped))
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+
+		if (name == names.size() || !matches(component, names[name]))
+		{
+			return false;
+		}
+		++component;
+		++name;
+	}
+
+	return name == names.size();
+}
+
+}	// End of bump namespace
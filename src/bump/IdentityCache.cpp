@@ -0,0 +1,142 @@
+//
+//  IdentityCache.cpp
+//  Bump
+//
+//  Created by Joseph Holub on 10/18/26.
+//  Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+// Bump headers
+#include <bump/IdentityCache.h>
+
+namespace bump {
+
+// Global singleton mutex
+static boost::mutex gIdentityCacheSingletonMutex;
+
+IdentityCache::IdentityCache() :
+	_maximumSize(1024),
+	_timeToLive(0.0),
+	_lookups(0)
+{
+	;
+}
+
+IdentityCache::~IdentityCache()
+{
+	;
+}
+
+IdentityCache* IdentityCache::instance()
+{
+	boost::mutex::scoped_lock lock(gIdentityCacheSingletonMutex);
+	static IdentityCache identity_cache;
+	return &identity_cache;
+}
+
+String IdentityCache::userName(unsigned int userId)
+{
+	return cachedName(_users, userId, true);
+}
+
+String IdentityCache::groupName(unsigned int groupId)
+{
+	return cachedName(_groups, groupId, false);
+}
+
+void IdentityCache::setMaximumSize(unsigned int maximumSize)
+{
+	boost::mutex::scoped_lock lock(_mutex);
+	_maximumSize = maximumSize;
+	evict(_users, _maximumSize);
+	evict(_groups, _maximumSize);
+}
+
+unsigned int IdentityCache::maximumSize()
+{
+	boost::mutex::scoped_lock lock(_mutex);
+	return _maximumSize;
+}
+
+void IdentityCache::setTimeToLive(double seconds)
+{
+	boost::mutex::scoped_lock lock(_mutex);
+	_timeToLive = seconds;
+}
+
+double IdentityCache::timeToLive()
+{
+	boost::mutex::scoped_lock lock(_mutex);
+	return _timeToLive;
+}
+
+unsigned int IdentityCache::size()
+{
+	boost::mutex::scoped_lock lock(_mutex);
+	return _users.size() + _groups.size();
+}
+
+void IdentityCache::clear()
+{
+	boost::mutex::scoped_lock lock(_mutex);
+	_users.clear();
+	_groups.clear();
+}
+
+String IdentityCache::cachedName(EntryMap& entries, unsigned int id, bool isUser)
+{
+	// Return the cached name if it has not expired
+	{
+		boost::mutex::scoped_lock lock(_mutex);
+		EntryMap::iterator iter = entries.find(id);
+		if (iter != entries.end())
+		{
+			boost::chrono::duration<double> age = Clock::now() - iter->second.loaded;
+			if (_timeToLive <= 0.0 || age.count() < _timeToLive)
+			{
+				iter->second.lastUsed = ++_lookups;
+				return iter->second.name;
+			}
+		}
+	}
+
+	// Look the name up without holding the lock since the system databases can be slow
+	String name;
+	bool found = isUser ? lookupUserName(id, name) : lookupGroupName(id, name);
+	if (!found)
+	{
+		name = String(id);
+	}
+
+	boost::mutex::scoped_lock lock(_mutex);
+	if (_maximumSize > 0)
+	{
+		Entry& entry = entries[id];
+		entry.name = name;
+		entry.loaded = Clock::now();
+		entry.lastUsed = ++_lookups;
+		evict(entries, _maximumSize);
+	}
+
+	return name;
+}
+
+void IdentityCache::evict(EntryMap& entries, unsigned int maximumSize)
+{
+	// Misses already paid for a system lookup, so a linear scan for the oldest name is cheap in comparison
+	while (entries.size() > maximumSize)
+	{
+		EntryMap::iterator oldest = entries.begin();
+		for (EntryMap::iterator iter = entries.begin(); iter != entries.end(); ++iter)
+		{
+			if (iter->second.lastUsed < oldest->second.lastUsed)
+			{
+				oldest = iter;
+			}
+		}
+
+		entries.erase(oldest);
+	}
+}
+
+}	// End of bump namespace
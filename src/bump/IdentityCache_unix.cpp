@@ -0,0 +1,74 @@
+//
+//  IdentityCache_unix.cpp
+//  Bump
+//
+//  Created by Joseph Holub on 10/18/26.
+//  Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+// Bump headers
+#include <bump/IdentityCache.h>
+
+// C++ headers
+#include <vector>
+
+// Unix headers
+#include <errno.h>
+#include <grp.h>
+#include <pwd.h>
+#include <unistd.h>
+
+namespace bump {
+
+// The buffer size to start with when the system does not suggest one
+static const long DEFAULT_BUFFER_SIZE = 16384;
+
+static long initialBufferSize(int name)
+{
+	long size = sysconf(name);
+	return size > 0 ? size : DEFAULT_BUFFER_SIZE;
+}
+
+bool IdentityCache::lookupUserName(unsigned int userId, String& name)
+{
+	// Grow the buffer until the entry fits since large directory service entries can exceed the suggested size
+	std::vector<char> buffer(initialBufferSize(_SC_GETPW_R_SIZE_MAX));
+	struct passwd entry;
+	struct passwd* result = NULL;
+	int error_code;
+	while ((error_code = getpwuid_r(userId, &entry, &buffer[0], buffer.size(), &result)) == ERANGE)
+	{
+		buffer.resize(buffer.size() * 2);
+	}
+
+	if (error_code != 0 || result == NULL)
+	{
+		return false;
+	}
+
+	name = result->pw_name;
+	return true;
+}
+
+bool IdentityCache::lookupGroupName(unsigned int groupId, String& name)
+{
+	// Grow the buffer until the entry fits since groups with many members can exceed the suggested size
+	std::vector<char> buffer(initialBufferSize(_SC_GETGR_R_SIZE_MAX));
+	struct group entry;
+	struct group* result = NULL;
+	int error_code;
+	while ((error_code = getgrgid_r(groupId, &entry, &buffer[0], buffer.size(), &result)) == ERANGE)
+	{
+		buffer.resize(buffer.size() * 2);
+	}
+
+	if (error_code != 0 || result == NULL)
+	{
+		return false;
+	}
+
+	name = result->gr_name;
+	return true;
+}
+
+}	// End of bump namespace
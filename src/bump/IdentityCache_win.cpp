@@ -0,0 +1,27 @@
+//
+//  IdentityCache_win.cpp
+//  Bump
+//
+//  Created by Joseph Holub on 10/18/26.
+//  Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+// Bump headers
+#include <bump/IdentityCache.h>
+#include <bump/NotImplementedError.h>
+
+namespace bump {
+
+bool IdentityCache::lookupUserName(unsigned int userId, String& name)
+{
+	String msg = "The bump::IdentityCache::userName() method is not implemented on Windows";
+	throw NotImplementedError(msg, BUMP_LOCATION);
+}
+
+bool IdentityCache::lookupGroupName(unsigned int groupId, String& name)
+{
+	String msg = "The bump::IdentityCache::groupName() method is not implemented on Windows";
+	throw NotImplementedError(msg, BUMP_LOCATION);
+}
+
+}	// End of bump namespace
@@ -0,0 +1,343 @@
+//
+//  LineIndex.cpp
+//  Bump
+//
+//  Created by Joseph Holub on 10/18/26.
+//  Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+// Bump headers
+#include <bump/AtomicFileWriter.h>
+#include <bump/LineIndex.h>
+
+// C headers
+#include <errno.h>
+#include <string.h>
+
+namespace bump {
+
+//====================================================================================
+//                                 Sidecar Helpers
+//====================================================================================
+
+// Identifies the sidecar format, and changes whenever the layout does
+static const char SIDECAR_MAGIC[8] = { 'B', 'U', 'M', 'P', 'L', 'I', 'X', '2' };
+
+// The number of bytes counted at a time while looking for the indexed lines
+static const std::size_t INDEX_BLOCK_SIZE = 65536;
+
+template <typename T>
+static void appendValue(std::string& data, const T& value)
+{
+	data.append((const char*)&value, sizeof(T));
+}
+
+template <typename T>
+static bool readValue(const StringView& data, std::size_t& position, T& value)
+{
+	if (data.length() - position < sizeof(T))
+	{
+		return false;
+	}
+
+	memcpy(&value, data.data() + position, sizeof(T));
+	position += sizeof(T);
+	return true;
+}
+
+//====================================================================================
+//                                    LineIndex
+//====================================================================================
+
+const unsigned int LineIndex::DEFAULT_INTERVAL = 1024;
+
+LineIndex::LineIndex() :
+	_path(),
+	_interval(DEFAULT_INTERVAL),
+	_numberOfLines(0),
+	_fileSize(0),
+	_modifiedDate(0),
+	_modifiedNanoseconds(0),
+	_device(0),
+	_inode(0),
+	_offsets()
+{
+	;
+}
+
+bool LineIndex::build(const String& path, unsigned int interval)
+{
+	MappedFile file;
+	if (!file.open(path))
+	{
+		return false;
+	}
+
+	file.advise(MappedFile::SEQUENTIAL_ACCESS);
+	return build(file, interval);
+}
+
+bool LineIndex::build(const MappedFile& file, unsigned int interval)
+{
+	if (!file.isOpen())
+	{
+		errno = EBADF;
+		return false;
+	}
+	else if (interval == 0)
+	{
+		errno = EINVAL;
+		return false;
+	}
+
+	FileState state;
+	if (!fileState(file.path(), state))
+	{
+		return false;
+	}
+
+	// The mapped size is what was actually indexed, so a file that grew since it was mapped is never current
+	clear();
+	indexContents(file.view(), interval);
+	_path = file.path();
+	_fileSize = file.size();
+	_modifiedDate = state.modifiedDate;
+	_modifiedNanoseconds = state.modifiedNanoseconds;
+	_device = state.device;
+	_inode = state.inode;
+
+	return true;
+}
+
+bool LineIndex::update(const String& path, const String& sidecarPath, unsigned int interval)
+{
+	if (_interval == interval && isCurrent(path))
+	{
+		return true;
+	}
+
+	if (!sidecarPath.empty())
+	{
+		LineIndex sidecar;
+		if (sidecar.load(sidecarPath) && sidecar._interval == interval && sidecar.isCurrent(path))
+		{
+			*this = sidecar;
+			return true;
+		}
+	}
+
+	if (!build(path, interval))
+	{
+		return false;
+	}
+
+	// The sidecar only saves the next update from indexing the file again
+	if (!sidecarPath.empty())
+	{
+		save(sidecarPath);
+	}
+
+	return true;
+}
+
+bool LineIndex::load(const String& sidecarPath)
+{
+	MappedFile file;
+	if (!file.open(sidecarPath))
+	{
+		return false;
+	}
+
+	// Read everything into a separate index so a bad sidecar leaves this one untouched
+	StringView data = file.view();
+	std::size_t position = sizeof(SIDECAR_MAGIC);
+	LineIndex index;
+	unsigned long long path_length = 0;
+	unsigned long long number_of_offsets = 0;
+	long long modified_date = 0;
+	bool is_valid = data.length() >= sizeof(SIDECAR_MAGIC) && memcmp(data.data(), SIDECAR_MAGIC, sizeof(SIDECAR_MAGIC)) == 0 &&
+		readValue(data, position, index._interval) &&
+		readValue(data, position, index._numberOfLines) &&
+		readValue(data, position, index._fileSize) &&
+		readValue(data, position, modified_date) &&
+		readValue(data, position, index._modifiedNanoseconds) &&
+		readValue(data, position, index._device) &&
+		readValue(data, position, index._inode) &&
+		readValue(data, position, path_length) &&
+		path_length <= data.length() - position;
+	if (is_valid)
+	{
+		index._path = data.section(position, path_length).toString();
+		index._modifiedDate = modified_date;
+		position += path_length;
+		is_valid = readValue(data, position, number_of_offsets) && index._interval > 0 && index._numberOfLines > 0 &&
+			number_of_offsets == (index._numberOfLines - 1) / index._interval + 1 &&
+			number_of_offsets == (data.length() - position) / sizeof(unsigned long long) &&
+			(data.length() - position) % sizeof(unsigned long long) == 0;
+	}
+	if (is_valid)
+	{
+		index._offsets.resize(number_of_offsets);
+		memcpy(&index._offsets[0], data.data() + position, number_of_offsets * sizeof(unsigned long long));
+		for (std::size_t i = 0; i < index._offsets.size() && is_valid; ++i)
+		{
+			is_valid = index._offsets[i] <= index._fileSize && (i == 0 || index._offsets[i - 1] < index._offsets[i]);
+		}
+	}
+
+	if (!is_valid)
+	{
+		errno = EINVAL;
+		return false;
+	}
+
+	*this = index;
+	return true;
+}
+
+bool LineIndex::save(const String& sidecarPath) const
+{
+	if (isEmpty())
+	{
+		errno = EINVAL;
+		return false;
+	}
+
+	std::string header(SIDECAR_MAGIC, sizeof(SIDECAR_MAGIC));
+	appendValue(header, _interval);
+	appendValue(header, _numberOfLines);
+	appendValue(header, _fileSize);
+	appendValue(header, (long long)_modifiedDate);
+	appendValue(header, _modifiedNanoseconds);
+	appendValue(header, _device);
+	appendValue(header, _inode);
+	appendValue(header, (unsigned long long)_path.length());
+	header.append(_path);
+	appendValue(header, (unsigned long long)_offsets.size());
+
+	// The sidecar is only a cache, so it is not worth flushing to disk
+	AtomicFileWriter writer;
+	if (!writer.open(sidecarPath, AtomicFileWriter::NO_SYNC))
+	{
+		return false;
+	}
+
+	const char* offsets = (const char*)&_offsets[0];
+	if (!writer.write(header) || !writer.write(StringView(offsets, _offsets.size() * sizeof(unsigned long long))))
+	{
+		writer.discard();
+		return false;
+	}
+
+	return writer.commit();
+}
+
+void LineIndex::clear()
+{
+	_path.clear();
+	_interval = DEFAULT_INTERVAL;
+	_numberOfLines = 0;
+	_fileSize = 0;
+	_modifiedDate = 0;
+	_modifiedNanoseconds = 0;
+	_device = 0;
+	_inode = 0;
+	_offsets.clear();
+}
+
+bool LineIndex::isEmpty() const
+{
+	return _offsets.empty();
+}
+
+bool LineIndex::isCurrent(const String& path) const
+{
+	FileState state;
+	return !isEmpty() && path == _path && fileState(path, state) &&
+		state.size == _fileSize && state.modifiedDate == _modifiedDate &&
+		state.modifiedNanoseconds == _modifiedNanoseconds && state.device == _device && state.inode == _inode;
+}
+
+const String& LineIndex::path() const
+{
+	return _path;
+}
+
+unsigned int LineIndex::interval() const
+{
+	return _interval;
+}
+
+unsigned long long LineIndex::numberOfLines() const
+{
+	return _numberOfLines;
+}
+
+unsigned long long LineIndex::fileSize() const
+{
+	return _fileSize;
+}
+
+std::time_t LineIndex::modifiedDate() const
+{
+	return _modifiedDate;
+}
+
+bool LineIndex::locate(unsigned long long line, unsigned long long& indexedLine, unsigned long long& offset) const
+{
+	if (line < 1 || line > _numberOfLines)
+	{
+		return false;
+	}
+
+	unsigned long long checkpoint = (line - 1) / _interval;
+	indexedLine = checkpoint * _interval + 1;
+	offset = _offsets[checkpoint];
+	return true;
+}
+
+String LineIndex::sidecarPath(const String& path)
+{
+	return path + ".lineindex";
+}
+
+void LineIndex::indexContents(const StringView& contents, unsigned int interval)
+{
+	_interval = interval;
+	_offsets.reserve(contents.length() / INDEX_BLOCK_SIZE + 1);
+	_offsets.push_back(0);
+
+	// Blocks without an indexed line are only counted, which is done a vector register at a
+	// time, so only the blocks holding one are searched newline by newline
+	unsigned long long line = 1;
+	unsigned long long next_indexed_line = 1 + (unsigned long long)interval;
+	std::size_t position = 0;
+	while (position < contents.length())
+	{
+		StringView block = contents.section(position, INDEX_BLOCK_SIZE);
+		std::size_t newlines = block.count('\n');
+		if (line + newlines < next_indexed_line)
+		{
+			line += newlines;
+		}
+		else
+		{
+			std::size_t line_start = 0;
+			std::size_t newline = 0;
+			while ((newline = block.indexOf('\n', line_start)) != StringView::npos)
+			{
+				line_start = newline + 1;
+				if (++line == next_indexed_line)
+				{
+					_offsets.push_back(position + line_start);
+					next_indexed_line += interval;
+				}
+			}
+		}
+		position += block.length();
+	}
+
+	_numberOfLines = line;
+}
+
+}	// End of bump namespace
@@ -0,0 +1,39 @@
+//
+//  LineIndex_unix.cpp
+//  Bump
+//
+//  Created by Joseph Holub on 10/18/26.
+//  Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+// Bump headers
+#include <bump/LineIndex.h>
+
+// Unix headers
+#include <sys/stat.h>
+#include <sys/types.h>
+
+namespace bump {
+
+bool LineIndex::fileState(const String& path, FileState& state)
+{
+	struct stat info;
+	if (::stat(path.c_str(), &info) != 0)
+	{
+		return false;
+	}
+
+	state.size = info.st_size;
+	state.modifiedDate = info.st_mtime;
+#ifdef __APPLE__
+	state.modifiedNanoseconds = info.st_mtimespec.tv_nsec;
+#else
+	state.modifiedNanoseconds = info.st_mtim.tv_nsec;
+#endif
+	state.device = info.st_dev;
+	state.inode = info.st_ino;
+
+	return true;
+}
+
+}	// End of bump namespace
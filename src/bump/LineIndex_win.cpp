@@ -0,0 +1,26 @@
+//
+//  LineIndex_win.cpp
+//  Bump
+//
+//  Created by Joseph Holub on 10/18/26.
+//  Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+// Bump headers
+#include <bump/FileInfo.h>
+#include <bump/LineIndex.h>
+
+namespace bump {
+
+bool LineIndex::fileState(const String& path, FileState& state)
+{
+	// Only the size and the modification time in seconds are available here
+	FileInfo info(path);
+	FileSystemStatus status;
+	state.modifiedNanoseconds = 0;
+	state.device = 0;
+	state.inode = 0;
+	return info.fileSize(state.size, status) && info.modifiedDate(state.modifiedDate, status);
+}
+
+}	// End of bump namespace
@@ -0,0 +1,226 @@
+//
+//  LineReader.cpp
+//  Bump
+//
+//  Created by Joseph Holub on 10/18/26.
+//  Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+// Boost headers
+#include <boost/thread/thread.hpp>
+
+// Bump headers
+#include <bump/DecompressingReader.h>
+#include <bump/FileWatcher.h>
+#include <bump/LineReader.h>
+#include <bump/Timer.h>
+
+// C headers
+#include <string.h>
+
+namespace bump {
+
+// How long the followed file is left alone before its changes are reported, and how often it is polled without a watcher
+static const unsigned int FOLLOW_COALESCING_INTERVAL = 10;
+static const unsigned int FOLLOW_POLL_INTERVAL = 100;
+
+static void ignoreChanges(const FileWatcher::FileChangeList& /*changes*/)
+{
+	// Only being woken up matters, the file is simply read again
+}
+
+LineReader::LineReader(unsigned int bufferSize) :
+	_path(),
+	_buffer(),
+	_bufferSize(bufferSize > 0 ? bufferSize : 1),
+	_lineStart(0),
+	_scanStart(0),
+	_dataEnd(0),
+	_bufferOffset(0),
+	_lineNumber(0),
+	_lineOffset(0),
+	_isEndOfFile(false),
+	_descriptor(-1),
+	_errorCode(0),
+	_decompressor(NULL),
+	_watcher(NULL),
+	_isWatcherFailed(false)
+{
+	;
+}
+
+LineReader::~LineReader()
+{
+	close();
+}
+
+bool LineReader::readLine(StringView& line)
+{
+	if (!isOpen() || _errorCode != 0)
+	{
+		return false;
+	}
+
+	return nextLine(line, false);
+}
+
+bool LineReader::followLine(StringView& line, unsigned int timeoutMilliseconds)
+{
+	if (!isOpen() || _errorCode != 0)
+	{
+		return false;
+	}
+
+	Timer timer;
+	timer.start();
+	while (true)
+	{
+		// Look past the end of the file again since more may have been written since
+		_isEndOfFile = false;
+		if (nextLine(line, true))
+		{
+			return true;
+		}
+		else if (_errorCode != 0)
+		{
+			return false;
+		}
+		else if (restartIfTruncated())
+		{
+			continue;
+		}
+
+		double elapsed = timer.millisecondsElapsed();
+		if (elapsed >= timeoutMilliseconds)
+		{
+			return false;
+		}
+		waitForChanges(timeoutMilliseconds - (unsigned int)elapsed);
+	}
+}
+
+bool LineReader::nextLine(StringView& line, bool holdPartialLine)
+{
+	while (true)
+	{
+		// Only the bytes that have not been searched yet are scanned for the newline
+		const char* data = _buffer.empty() ? NULL : &_buffer[0];
+		const char* newline = NULL;
+		if (_scanStart < _dataEnd)
+		{
+			newline = (const char*)memchr(data + _scanStart, '\n', _dataEnd - _scanStart);
+		}
+
+		if (newline != NULL || (_isEndOfFile && _lineStart < _dataEnd && !holdPartialLine))
+		{
+			std::size_t line_end = newline != NULL ? newline - data : _dataEnd;
+			std::size_t length = line_end - _lineStart;
+			if (newline != NULL && length > 0 && data[line_end - 1] == '\r')
+			{
+				--length;
+			}
+
+			line = StringView(data + _lineStart, length);
+			_lineOffset = _bufferOffset + _lineStart;
+			++_lineNumber;
+			_lineStart = newline != NULL ? line_end + 1 : _dataEnd;
+			_scanStart = _lineStart;
+			return true;
+		}
+		else if (_isEndOfFile)
+		{
+			return false;
+		}
+
+		// Slide the partial line to the front, and only grow the buffer when the line fills all of it
+		_scanStart = _dataEnd;
+		if (_lineStart > 0)
+		{
+			memmove(&_buffer[0], data + _lineStart, _dataEnd - _lineStart);
+			_bufferOffset += _lineStart;
+			_scanStart -= _lineStart;
+			_dataEnd -= _lineStart;
+			_lineStart = 0;
+		}
+		if (_buffer.empty())
+		{
+			_buffer.resize(_bufferSize);
+		}
+		else if (_dataEnd == _buffer.size())
+		{
+			_buffer.resize(_buffer.size() * 2);
+		}
+
+		long bytes_read = readChunk();
+		if (bytes_read < 0)
+		{
+			return false;
+		}
+		else if (bytes_read == 0)
+		{
+			_isEndOfFile = true;
+		}
+		_dataEnd += bytes_read;
+	}
+}
+
+void LineReader::waitForChanges(unsigned int timeoutMilliseconds)
+{
+	// Watch the file the first time it is waited on, and read it again right away in case it
+	// changed before the watcher started
+	if (_watcher == NULL && !_isWatcherFailed)
+	{
+		_watcher = new FileWatcher();
+		_watcher->setCoalescingInterval(FOLLOW_COALESCING_INTERVAL);
+		_watcher->setCallback(&ignoreChanges, FileWatcher::QUEUED_DELIVERY);
+		if (!_watcher->addPath(_path) || !_watcher->start())
+		{
+			delete _watcher;
+			_watcher = NULL;
+			_isWatcherFailed = true;
+		}
+		return;
+	}
+
+	if (_watcher != NULL)
+	{
+		_watcher->processChanges(timeoutMilliseconds);
+	}
+	else
+	{
+		unsigned int sleep_milliseconds = timeoutMilliseconds < FOLLOW_POLL_INTERVAL ? timeoutMilliseconds : FOLLOW_POLL_INTERVAL;
+		boost::this_thread::sleep(boost::posix_time::milliseconds(sleep_milliseconds));
+	}
+}
+
+bool LineReader::isOpen() const
+{
+	return _descriptor >= 0;
+}
+
+bool LineReader::isAtEnd() const
+{
+	return _isEndOfFile && _lineStart == _dataEnd;
+}
+
+const String& LineReader::path() const
+{
+	return _path;
+}
+
+unsigned long long LineReader::lineNumber() const
+{
+	return _lineNumber;
+}
+
+unsigned long long LineReader::lineOffset() const
+{
+	return _lineOffset;
+}
+
+int LineReader::errorCode() const
+{
+	return _errorCode;
+}
+
+}	// End of bump namespace
@@ -0,0 +1,153 @@
+//
+//  LineReader_unix.cpp
+//  Bump
+//
+//  Created by Joseph Holub on 10/18/26.
+//  Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+// Bump headers
+#include <bump/DecompressingReader.h>
+#include <bump/FileWatcher.h>
+#include <bump/LineReader.h>
+
+// Unix headers
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+namespace bump {
+
+bool LineReader::open(const String& path)
+{
+	close();
+	_path = path;
+
+	int descriptor = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+	if (descriptor < 0)
+	{
+		return false;
+	}
+
+	// Refuse directories up front rather than failing on the first read
+	struct stat info;
+	int error_code = 0;
+	if (fstat(descriptor, &info) != 0)
+	{
+		error_code = errno;
+	}
+	else if (S_ISDIR(info.st_mode))
+	{
+		error_code = EISDIR;
+	}
+
+	// Compressed files are decompressed on their own thread, recognized by the magic bytes at the start
+	char magic[4];
+	ssize_t magic_length = error_code == 0 ? pread(descriptor, magic, sizeof(magic), 0) : -1;
+	if (magic_length > 0 && DecompressingReader::detectFormatFromBytes(StringView(magic, magic_length)) != DecompressingReader::UNCOMPRESSED)
+	{
+		_decompressor = new DecompressingReader(_bufferSize);
+		if (!_decompressor->open(path))
+		{
+			error_code = errno;
+			delete _decompressor;
+			_decompressor = NULL;
+		}
+	}
+
+	if (error_code != 0)
+	{
+		::close(descriptor);
+		errno = error_code;
+		return false;
+	}
+
+#ifdef POSIX_FADV_SEQUENTIAL
+	// The file is read from front to back exactly once, so let the kernel read ahead aggressively
+	posix_fadvise(descriptor, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+
+	_descriptor = descriptor;
+	return true;
+}
+
+void LineReader::close()
+{
+	if (_descriptor >= 0)
+	{
+		::close(_descriptor);
+		_descriptor = -1;
+	}
+
+	delete _decompressor;
+	_decompressor = NULL;
+	delete _watcher;
+	_watcher = NULL;
+	_isWatcherFailed = false;
+
+	_lineStart = 0;
+	_scanStart = 0;
+	_dataEnd = 0;
+	_bufferOffset = 0;
+	_lineNumber = 0;
+	_lineOffset = 0;
+	_isEndOfFile = false;
+	_errorCode = 0;
+}
+
+bool LineReader::restartIfTruncated()
+{
+	// Anything shorter than what has already been read can only have been truncated, which
+	// cannot be told for compressed files since they shrink by design
+	struct stat info;
+	if (_decompressor != NULL || fstat(_descriptor, &info) != 0 || (unsigned long long)info.st_size >= _bufferOffset + _dataEnd)
+	{
+		return false;
+	}
+
+	if (lseek(_descriptor, 0, SEEK_SET) < 0)
+	{
+		_errorCode = errno;
+		return false;
+	}
+
+	_lineStart = 0;
+	_scanStart = 0;
+	_dataEnd = 0;
+	_bufferOffset = 0;
+	_lineNumber = 0;
+	_lineOffset = 0;
+	_isEndOfFile = false;
+	return true;
+}
+
+long LineReader::readChunk()
+{
+	if (_decompressor != NULL)
+	{
+		long bytes_decompressed = _decompressor->read(&_buffer[0] + _dataEnd, _buffer.size() - _dataEnd);
+		if (bytes_decompressed < 0)
+		{
+			_errorCode = errno;
+		}
+		return bytes_decompressed;
+	}
+
+	ssize_t bytes_read = -1;
+	do
+	{
+		bytes_read = read(_descriptor, &_buffer[0] + _dataEnd, _buffer.size() - _dataEnd);
+	} while (bytes_read < 0 && errno == EINTR);
+
+	if (bytes_read < 0)
+	{
+		_errorCode = errno;
+		return -1;
+	}
+
+	return bytes_read;
+}
+
+}	// End of bump namespace
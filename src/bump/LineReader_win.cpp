@@ -0,0 +1,38 @@
+//
+//  LineReader_win.cpp
+//  Bump
+//
+//  Created by Joseph Holub on 10/18/26.
+//  Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+// Bump headers
+#include <bump/LineReader.h>
+#include <bump/NotImplementedError.h>
+
+namespace bump {
+
+bool LineReader::open(const String& path)
+{
+	String msg = "The bump::LineReader::open() method is not implemented on Windows";
+	throw NotImplementedError(msg, BUMP_LOCATION);
+}
+
+void LineReader::close()
+{
+	;
+}
+
+bool LineReader::restartIfTruncated()
+{
+	String msg = "The bump::LineReader::restartIfTruncated() method is not implemented on Windows";
+	throw NotImplementedError(msg, BUMP_LOCATION);
+}
+
+long LineReader::readChunk()
+{
+	String msg = "The bump::LineReader::readChunk() method is not implemented on Windows";
+	throw NotImplementedError(msg, BUMP_LOCATION);
+}
+
+}	// End of bump namespace
@@ -0,0 +1,76 @@
+//
+//  MappedFile.cpp
+//  Bump
+//
+//  Created by Joseph Holub on 10/18/26.
+//  Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+// Bump headers
+#include <bump/MappedFile.h>
+
+namespace bump {
+
+MappedFile::MappedFile() :
+	_path(),
+	_mode(READ_ONLY),
+	_isOpen(false),
+	_isMapped(false),
+	_data(NULL),
+	_size(0),
+	_contents()
+{
+	;
+}
+
+MappedFile::~MappedFile()
+{
+	close();
+}
+
+bool MappedFile::isOpen() const
+{
+	return _isOpen;
+}
+
+bool MappedFile::isMapped() const
+{
+	return _isMapped;
+}
+
+const String& MappedFile::path() const
+{
+	return _path;
+}
+
+MappedFile::Mode MappedFile::mode() const
+{
+	return _mode;
+}
+
+const char* MappedFile::data() const
+{
+	return _data;
+}
+
+char* MappedFile::writableData()
+{
+	return _mode == READ_WRITE ? _data : NULL;
+}
+
+std::size_t MappedFile::size() const
+{
+	return _size;
+}
+
+StringView MappedFile::view() const
+{
+	return StringView(_data, _size);
+}
+
+bool MappedFile::advise(Advice advice) const
+{
+	return advise(advice, 0, _size);
+}
+
+}	// End of bump namespace
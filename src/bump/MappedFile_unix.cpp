@@ -0,0 +1,205 @@
+//
+//  MappedFile_unix.cpp
+//  Bump
+//
+//  Created by Joseph Holub on 10/18/26.
+//  Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+// Bump headers
+#include <bump/MappedFile.h>
+
+// C++ headers
+#include <limits>
+
+// Unix headers
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+namespace bump {
+
+static const std::size_t READ_CHUNK_SIZE = 65536;
+
+static bool readContents(int descriptor, std::vector<char>& contents)
+{
+	std::size_t length = 0;
+	while (true)
+	{
+		contents.resize(length + READ_CHUNK_SIZE);
+		ssize_t bytes_read = ::read(descriptor, &contents[length], READ_CHUNK_SIZE);
+		if (bytes_read < 0 && errno == EINTR)
+		{
+			continue;
+		}
+		else if (bytes_read < 0)
+		{
+			return false;
+		}
+		else if (bytes_read == 0)
+		{
+			break;
+		}
+
+		length += bytes_read;
+	}
+
+	contents.resize(length);
+	return true;
+}
+
+bool MappedFile::open(const String& path, Mode mode)
+{
+	close();
+
+	int descriptor = ::open(path.c_str(), (mode == READ_WRITE ? O_RDWR : O_RDONLY) | O_CLOEXEC);
+	if (descriptor < 0)
+	{
+		return false;
+	}
+
+	struct stat info;
+	if (fstat(descriptor, &info) != 0)
+	{
+		int error_code = errno;
+		::close(descriptor);
+		errno = error_code;
+		return false;
+	}
+	else if (S_ISDIR(info.st_mode))
+	{
+		::close(descriptor);
+		errno = EISDIR;
+		return false;
+	}
+	else if ((unsigned long long)info.st_size > std::numeric_limits<std::size_t>::max())
+	{
+		::close(descriptor);
+		errno = EFBIG;
+		return false;
+	}
+
+	if (S_ISREG(info.st_mode) && info.st_size > 0)
+	{
+		int protection = mode == READ_WRITE ? PROT_READ | PROT_WRITE : PROT_READ;
+		int flags = mode == READ_WRITE ? MAP_SHARED : MAP_PRIVATE;
+		void* data = mmap(NULL, info.st_size, protection, flags, descriptor, 0);
+
+		// The mapping keeps the file alive on its own
+		int error_code = errno;
+		::close(descriptor);
+		if (data == MAP_FAILED)
+		{
+			errno = error_code;
+			return false;
+		}
+
+		_data = static_cast<char*>(data);
+		_size = info.st_size;
+		_isMapped = true;
+	}
+	else if (mode == READ_ONLY)
+	{
+		// Pipes, devices and pseudo files that report no size are read instead
+		bool result = readContents(descriptor, _contents);
+		int error_code = errno;
+		::close(descriptor);
+		if (!result)
+		{
+			errno = error_code;
+			_contents.clear();
+			return false;
+		}
+
+		_data = _contents.empty() ? NULL : &_contents[0];
+		_size = _contents.size();
+	}
+	else
+	{
+		// Only regular files can be written back through a mapping, empty ones have nothing to map
+		::close(descriptor);
+		if (!S_ISREG(info.st_mode))
+		{
+			errno = ENODEV;
+			return false;
+		}
+	}
+
+	_path = path;
+	_mode = mode;
+	_isOpen = true;
+
+	return true;
+}
+
+void MappedFile::close()
+{
+	if (_isMapped)
+	{
+		munmap(_data, _size);
+	}
+
+	std::vector<char>().swap(_contents);
+	_data = NULL;
+	_size = 0;
+	_isMapped = false;
+	_isOpen = false;
+}
+
+bool MappedFile::advise(Advice advice, std::size_t offset, std::size_t length) const
+{
+	if (!_isMapped || offset >= _size || length == 0)
+	{
+		return true;
+	}
+
+	int value = MADV_NORMAL;
+	if (advice == SEQUENTIAL_ACCESS)
+	{
+		value = MADV_SEQUENTIAL;
+	}
+	else if (advice == RANDOM_ACCESS)
+	{
+		value = MADV_RANDOM;
+	}
+	else if (advice == WILL_NEED)
+	{
+		value = MADV_WILLNEED;
+	}
+	else if (advice == HUGE_PAGES)
+	{
+#ifdef MADV_HUGEPAGE
+		value = MADV_HUGEPAGE;
+#else
+		errno = ENOTSUP;
+		return false;
+#endif
+	}
+
+	// The advice has to start on a page boundary, so widen the range to the pages it touches
+	std::size_t page_size = sysconf(_SC_PAGESIZE);
+	std::size_t begin = offset - offset % page_size;
+	std::size_t end = length > _size - offset ? _size : offset + length;
+
+	return madvise(_data + begin, end - begin, value) == 0;
+}
+
+bool MappedFile::synchronize(bool wait)
+{
+	if (!_isOpen || _mode != READ_WRITE)
+	{
+		errno = EBADF;
+		return false;
+	}
+	else if (!_isMapped)
+	{
+		return true;
+	}
+
+	return msync(_data, _size, wait ? MS_SYNC : MS_ASYNC) == 0;
+}
+
+}	// End of bump namespace
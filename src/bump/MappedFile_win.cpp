@@ -0,0 +1,38 @@
+//
+//  MappedFile_win.cpp
+//  Bump
+//
+//  Created by Joseph Holub on 10/18/26.
+//  Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+// Bump headers
+#include <bump/MappedFile.h>
+#include <bump/NotImplementedError.h>
+
+namespace bump {
+
+bool MappedFile::open(const String& path, Mode mode)
+{
+	String msg = "The bump::MappedFile::open() method is not implemented on Windows";
+	throw NotImplementedError(msg, BUMP_LOCATION);
+}
+
+void MappedFile::close()
+{
+	;
+}
+
+bool MappedFile::advise(Advice advice, std::size_t offset, std::size_t length) const
+{
+	String msg = "The bump::MappedFile::advise() method is not implemented on Windows";
+	throw NotImplementedError(msg, BUMP_LOCATION);
+}
+
+bool MappedFile::synchronize(bool wait)
+{
+	String msg = "The bump::MappedFile::synchronize() method is not implemented on Windows";
+	throw NotImplementedError(msg, BUMP_LOCATION);
+}
+
+}	// End of bump namespace
@@ -0,0 +1,192 @@
+//
+//  MappedTextFile.cpp
+//  Bump
+//
+//  Created by Joseph Holub on 10/18/26.
+//  Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+// Bump headers
+#include <bump/MappedTextFile.h>
+
+namespace bump {
+
+MappedTextFile::MappedTextFile() :
+	_file(),
+	_index()
+{
+	;
+}
+
+bool MappedTextFile::open(const String& path)
+{
+	close();
+	return _file.open(path);
+}
+
+void MappedTextFile::close()
+{
+	_file.close();
+	_index.clear();
+}
+
+bool MappedTextFile::isOpen() const
+{
+	return _file.isOpen();
+}
+
+bool MappedTextFile::isMapped() const
+{
+	return _file.isMapped();
+}
+
+const String& MappedTextFile::path() const
+{
+	return _file.path();
+}
+
+StringView MappedTextFile::contents() const
+{
+	return _file.view();
+}
+
+unsigned long long MappedTextFile::numberOfLines() const
+{
+	if (!isOpen())
+	{
+		return 0;
+	}
+	else if (!_index.isEmpty())
+	{
+		return _index.numberOfLines();
+	}
+
+	// Every newline ends a line, and whatever follows the last one is counted as the final line
+	return contents().count('\n') + 1;
+}
+
+StringView MappedTextFile::firstLine() const
+{
+	StringViewList lines = header(1);
+	return lines.empty() ? StringView() : lines.front();
+}
+
+StringViewList MappedTextFile::fileContents() const
+{
+	return fileContents(1);
+}
+
+StringViewList MappedTextFile::fileContents(int beginningLine, int numLines) const
+{
+	StringViewList lines;
+	std::size_t offset = lineOffset(beginningLine);
+	if (offset != StringView::npos && (numLines > 0 || numLines == -1))
+	{
+		appendLines(offset, numLines, lines);
+	}
+
+	return lines;
+}
+
+StringViewList MappedTextFile::fileContents(int beginningLine) const
+{
+	StringViewList lines;
+	std::size_t offset = lineOffset(beginningLine);
+	if (offset != StringView::npos)
+	{
+		appendLines(offset, -1, lines);
+	}
+
+	return lines;
+}
+
+StringViewList MappedTextFile::header(int numLines) const
+{
+	return numLines < 1 ? StringViewList() : fileContents(1, numLines);
+}
+
+StringViewList MappedTextFile::footer(int numLines) const
+{
+	StringViewList lines;
+	if (!isOpen() || numLines < 1)
+	{
+		return lines;
+	}
+
+	// The footer starts right after the numLines-th newline from the end, or at the very start
+	StringView view = contents();
+	const char* data = view.data();
+	std::size_t footer_start = 0;
+	int newlines = 0;
+	for (std::size_t i = view.length(); i > 0; --i)
+	{
+		if (data[i - 1] == '\n' && ++newlines == numLines)
+		{
+			footer_start = i;
+			break;
+		}
+	}
+
+	appendLines(footer_start, -1, lines);
+	return lines;
+}
+
+bool MappedTextFile::buildIndex(unsigned int interval)
+{
+	return _index.build(_file, interval);
+}
+
+const LineIndex& MappedTextFile::index() const
+{
+	return _index;
+}
+
+std::size_t MappedTextFile::lineOffset(int line) const
+{
+	if (!isOpen() || line < 1)
+	{
+		return StringView::npos;
+	}
+
+	// Start from the closest indexed line when there is an index, otherwise from the first line
+	StringView view = contents();
+	unsigned long long current_line = 1;
+	unsigned long long offset = 0;
+	if (!_index.isEmpty() && !_index.locate(line, current_line, offset))
+	{
+		return StringView::npos;
+	}
+
+	std::size_t position = offset;
+	for (; current_line < (unsigned long long)line; ++current_line)
+	{
+		std::size_t newline = view.indexOf('\n', position);
+		if (newline == StringView::npos)
+		{
+			return StringView::npos;
+		}
+		position = newline + 1;
+	}
+
+	return position;
+}
+
+void MappedTextFile::appendLines(std::size_t offset, int numLines, StringViewList& lines) const
+{
+	StringView view = contents();
+	std::size_t line_start = offset;
+	for (int i = 0; numLines == -1 || i < numLines; ++i)
+	{
+		std::size_t newline = view.indexOf('\n', line_start);
+		if (newline == StringView::npos)
+		{
+			lines.push_back(view.section(line_start));
+			return;
+		}
+
+		lines.push_back(view.section(line_start, newline - line_start));
+		line_start = newline + 1;
+	}
+}
+
+}	// End of bump namespace
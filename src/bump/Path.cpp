@@ -0,0 +1,317 @@
+//
+//  Path.cpp
+//  Bump
+//
+//  Created by Joseph Holub on 10/18/26.
+//  Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+// Bump headers
+#include <bump/Path.h>
+
+namespace bump {
+
+static void appendNormalized(std::string& path, const StringView& component)
+{
+	if (component.isEmpty())
+	{
+		return;
+	}
+
+	// Separate the component from what is already there
+	if (!path.empty() && path[path.size() - 1] != '/')
+	{
+		path.push_back('/');
+	}
+
+	// Convert backslashes and collapse runs of slashes in the same pass
+	for (const char* iter = component.begin(); iter != component.end(); ++iter)
+	{
+		char character = (*iter == '\\') ? '/' : *iter;
+		if (character == '/' && !path.empty() && path[path.size() - 1] == '/')
+		{
+			continue;
+		}
+		path.push_back(character);
+	}
+}
+
+static std::size_t rootLength(const std::string& path)
+{
+	if (!path.empty() && path[0] == '/')
+	{
+		return 1;
+	}
+	else if (path.size() >= 3 && path[1] == ':' && path[2] == '/')
+	{
+		return 3;
+	}
+
+	return 0;
+}
+
+//====================================================================================
+//                                Component Iterator
+//====================================================================================
+
+Path::ComponentIterator::ComponentIterator() :
+	_path(NULL),
+	_position(0),
+	_componentLength(0)
+{
+	;
+}
+
+Path::ComponentIterator::ComponentIterator(const String* path, std::size_t position) :
+	_path(path),
+	_position(position),
+	_componentLength(0)
+{
+	findComponentLength();
+}
+
+void Path::ComponentIterator::findComponentLength()
+{
+	if (_position >= _path->size())
+	{
+		_position = _path->size();
+		_componentLength = 0;
+	}
+	else if (_position == 0 && (*_path)[0] == '/')
+	{
+		_componentLength = 1;
+	}
+	else
+	{
+		std::size_t separator = _path->find('/', _position);
+		_componentLength = (separator == std::string::npos ? _path->size() : separator) - _position;
+	}
+}
+
+StringView Path::ComponentIterator::operator*() const
+{
+	return StringView(_path->data() + _position, _componentLength);
+}
+
+Path::ComponentIterator& Path::ComponentIterator::operator++()
+{
+	// Skip the separator after the component unless the component was the root slash
+	std::size_t next = _position + _componentLength;
+	bool is_root = (_position == 0 && _componentLength == 1 && (*_path)[0] == '/');
+	if (!is_root && next < _path->size() && (*_path)[next] == '/')
+	{
+		++next;
+	}
+
+	_position = next;
+	findComponentLength();
+
+	return *this;
+}
+
+bool Path::ComponentIterator::operator == (const ComponentIterator& other) const
+{
+	return _path == other._path && _position == other._position;
+}
+
+bool Path::ComponentIterator::operator != (const ComponentIterator& other) const
+{
+	return !(*this == other);
+}
+
+//====================================================================================
+//                                       Path
+//====================================================================================
+
+Path::Path() :
+	_path()
+{
+	;
+}
+
+Path::Path(const char* path) :
+	_path()
+{
+	appendNormalized(_path, StringView(path));
+}
+
+Path::Path(const String& path) :
+	_path()
+{
+	appendNormalized(_path, StringView(path));
+}
+
+Path::Path(const StringView& path) :
+	_path()
+{
+	appendNormalized(_path, path);
+}
+
+Path Path::join(const StringView* components, unsigned int numberOfComponents)
+{
+	// Size the result for the worst case so the components are copied without reallocating
+	std::size_t length = 0;
+	for (unsigned int i = 0; i < numberOfComponents; ++i)
+	{
+		length += components[i].length() + 1;
+	}
+
+	Path joined;
+	joined._path.reserve(length);
+	for (unsigned int i = 0; i < numberOfComponents; ++i)
+	{
+		appendNormalized(joined._path, components[i]);
+	}
+
+	return joined;
+}
+
+const String& Path::toString() const
+{
+	return _path;
+}
+
+const char* Path::c_str() const
+{
+	return _path.c_str();
+}
+
+bool Path::isEmpty() const
+{
+	return _path.empty();
+}
+
+bool Path::isAbsolute() const
+{
+	return rootLength(_path) > 0;
+}
+
+bool Path::isRelative() const
+{
+	return rootLength(_path) == 0;
+}
+
+StringView Path::trimmed() const
+{
+	StringView path(_path);
+	if (path.length() > rootLength(_path) && path.endsWith("/"))
+	{
+		return path.left(path.length() - 1);
+	}
+
+	return path;
+}
+
+StringView Path::filename() const
+{
+	StringView path = trimmed();
+	if (path.length() <= rootLength(_path))
+	{
+		return StringView();
+	}
+
+	std::size_t separator = path.lastIndexOf('/');
+	return (separator == StringView::npos) ? path : path.section(separator + 1);
+}
+
+StringView Path::basename() const
+{
+	StringView filename = this->filename();
+	std::size_t dot = filename.indexOf('.', filename.startsWith(".") ? 1 : 0);
+	return (dot == StringView::npos) ? filename : filename.left(dot);
+}
+
+StringView Path::extension() const
+{
+	StringView filename = this->filename();
+	std::size_t dot = filename.lastIndexOf('.');
+	if (dot == StringView::npos || dot == 0)
+	{
+		return StringView();
+	}
+
+	return filename.section(dot + 1);
+}
+
+StringView Path::parent() const
+{
+	StringView path = trimmed();
+	std::size_t root_length = rootLength(_path);
+	if (path.length() <= root_length)
+	{
+		return StringView();
+	}
+
+	// Keep the root when the last component sits right below it
+	std::size_t separator = path.lastIndexOf('/');
+	if (separator == StringView::npos)
+	{
+		return StringView();
+	}
+	else if (separator + 1 <= root_length)
+	{
+		return path.left(root_length);
+	}
+
+	return path.left(separator);
+}
+
+unsigned int Path::numberOfComponents() const
+{
+	unsigned int count = 0;
+	for (ComponentIterator iter = begin(); iter != end(); ++iter)
+	{
+		++count;
+	}
+
+	return count;
+}
+
+Path::ComponentIterator Path::begin() const
+{
+	return ComponentIterator(&_path, 0);
+}
+
+Path::ComponentIterator Path::end() const
+{
+	return ComponentIterator(&_path, _path.size());
+}
+
+Path& Path::operator /= (const StringView& component)
+{
+	_path.reserve(_path.size() + component.length() + 1);
+	appendNormalized(_path, component);
+	return *this;
+}
+
+Path Path::operator / (const StringView& component) const
+{
+	Path joined;
+	joined._path.reserve(_path.size() + component.length() + 1);
+	joined._path.append(_path);
+	appendNormalized(joined._path, component);
+	return joined;
+}
+
+bool Path::operator == (const Path& other) const
+{
+	return _path == other._path;
+}
+
+bool Path::operator != (const Path& other) const
+{
+	return _path != other._path;
+}
+
+bool Path::operator < (const Path& other) const
+{
+	return _path < other._path;
+}
+
+std::ostream& operator << (std::ostream& os, const Path& path)
+{
+	os << path.toString();
+	return os;
+}
+
+}	// End of bump namespace
@@ -0,0 +1,149 @@
+//
+//  ReadAheadStream.cpp
+//  Bump
+//
+//  Created by Joseph Holub on 10/18/26.
+//  Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+// Boost headers
+#include <boost/bind.hpp>
+
+// Bump headers
+#include <bump/ReadAheadStream.h>
+
+// C headers
+#include <errno.h>
+#include <string.h>
+
+// Private headers
+#include "BufferQueue.h"
+
+namespace bump {
+
+ReadAheadStream::ReadAheadStream(unsigned int bufferSize, unsigned int numberOfBuffers) :
+	_bufferSize(bufferSize > 0 ? bufferSize : 1),
+	_numberOfBuffers(numberOfBuffers > 0 ? numberOfBuffers : 1),
+	_descriptor(-1),
+	_ownsDescriptor(false),
+	_startOffset(0),
+	_offset(0),
+	_queue(new BufferQueue(_bufferSize, _numberOfBuffers))
+{
+	;
+}
+
+ReadAheadStream::~ReadAheadStream()
+{
+	close();
+}
+
+void ReadAheadStream::close()
+{
+	// Wake the reading thread up if it is waiting for room in the queue and wait for it to exit
+	if (_thread.get() != NULL)
+	{
+		_queue->stop();
+		_thread->join();
+		_thread.reset();
+	}
+
+	if (_descriptor >= 0)
+	{
+		closeDescriptor();
+		_descriptor = -1;
+	}
+
+	_ownsDescriptor = false;
+	_startOffset = 0;
+	_offset = 0;
+	_queue->reset();
+}
+
+bool ReadAheadStream::isOpen() const
+{
+	return _descriptor >= 0;
+}
+
+unsigned long long ReadAheadStream::offset() const
+{
+	return _offset;
+}
+
+long ReadAheadStream::nextBuffer(StringView& buffer, std::size_t maximumLength)
+{
+	if (!isOpen())
+	{
+		errno = EBADF;
+		return -1;
+	}
+
+	long length = _queue->next(buffer, maximumLength);
+	if (length > 0)
+	{
+		_offset += length;
+	}
+
+	return length;
+}
+
+long ReadAheadStream::read(char* buffer, std::size_t size)
+{
+	StringView next;
+	long length = nextBuffer(next, size);
+	if (length > 0)
+	{
+		memcpy(buffer, next.data(), length);
+	}
+
+	return length;
+}
+
+void ReadAheadStream::start(unsigned long long offset)
+{
+	_startOffset = offset;
+	_offset = offset;
+	_thread.reset(new boost::thread(boost::bind(&ReadAheadStream::run, this)));
+}
+
+void ReadAheadStream::run()
+{
+	std::vector<char> buffer(_bufferSize);
+	unsigned long long offset = _startOffset;
+	int error_code = 0;
+	bool is_end_of_file = false;
+	while (!is_end_of_file && error_code == 0)
+	{
+		// The next buffer is read in by the kernel while this one is filled and handed over
+		adviseWillNeed(offset + buffer.size(), buffer.size());
+
+		// Only the last buffer of the file is handed over partly filled
+		std::size_t filled = 0;
+		while (filled < buffer.size())
+		{
+			long bytes_read = readAt(&buffer[filled], buffer.size() - filled, offset + filled);
+			if (bytes_read < 0)
+			{
+				error_code = errno != 0 ? errno : EIO;
+				break;
+			}
+			else if (bytes_read == 0)
+			{
+				is_end_of_file = true;
+				break;
+			}
+			filled += bytes_read;
+		}
+
+		// Whatever was read before a failure is still handed over
+		if (filled > 0 && !_queue->push(buffer, filled))
+		{
+			break;
+		}
+		offset += filled;
+	}
+
+	_queue->finish(error_code);
+}
+
+}	// End of bump namespace
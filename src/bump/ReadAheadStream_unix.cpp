@@ -0,0 +1,108 @@
+//
+//  ReadAheadStream_unix.cpp
+//  Bump
+//
+//  Created by Joseph Holub on 10/18/26.
+//  Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+// Bump headers
+#include <bump/ReadAheadStream.h>
+
+// Unix headers
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+namespace bump {
+
+bool ReadAheadStream::open(const String& path, unsigned long long offset)
+{
+	close();
+
+	int descriptor = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+	if (descriptor < 0)
+	{
+		return false;
+	}
+
+	// Refuse directories up front rather than failing on the first read
+	struct stat info;
+	int error_code = 0;
+	if (fstat(descriptor, &info) != 0)
+	{
+		error_code = errno;
+	}
+	else if (S_ISDIR(info.st_mode))
+	{
+		error_code = EISDIR;
+	}
+
+	if (error_code != 0)
+	{
+		::close(descriptor);
+		errno = error_code;
+		return false;
+	}
+
+#ifdef POSIX_FADV_SEQUENTIAL
+	// The file is read from front to back exactly once, so let the kernel read ahead aggressively
+	posix_fadvise(descriptor, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+
+	_descriptor = descriptor;
+	_ownsDescriptor = true;
+	start(offset);
+	return true;
+}
+
+bool ReadAheadStream::open(int descriptor, unsigned long long offset)
+{
+	close();
+
+	if (descriptor < 0 || fcntl(descriptor, F_GETFD) < 0)
+	{
+		errno = EBADF;
+		return false;
+	}
+
+#ifdef POSIX_FADV_SEQUENTIAL
+	posix_fadvise(descriptor, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+
+	_descriptor = descriptor;
+	_ownsDescriptor = false;
+	start(offset);
+	return true;
+}
+
+void ReadAheadStream::closeDescriptor()
+{
+	if (_ownsDescriptor)
+	{
+		::close(_descriptor);
+	}
+}
+
+long ReadAheadStream::readAt(char* buffer, std::size_t size, unsigned long long offset)
+{
+	// Reading at an offset leaves the position of a descriptor shared with the caller alone
+	ssize_t bytes_read = -1;
+	do
+	{
+		bytes_read = pread(_descriptor, buffer, size, (off_t)offset);
+	} while (bytes_read < 0 && errno == EINTR);
+
+	return bytes_read;
+}
+
+void ReadAheadStream::adviseWillNeed(unsigned long long offset, std::size_t length)
+{
+#ifdef POSIX_FADV_WILLNEED
+	posix_fadvise(_descriptor, (off_t)offset, (off_t)length, POSIX_FADV_WILLNEED);
+#endif
+}
+
+}	// End of bump namespace
@@ -0,0 +1,115 @@
+//
+//  ReadAheadStream_win.cpp
+//  Bump
+//
+//  Created by Joseph Holub on 10/18/26.
+//  Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+// Bump headers
+#include <bump/ReadAheadStream.h>
+
+// C headers
+#include <errno.h>
+#include <fcntl.h>
+#include <io.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+// Windows headers
+#include <windows.h>
+
+namespace bump {
+
+bool ReadAheadStream::open(const String& path, unsigned long long offset)
+{
+	close();
+
+	int descriptor = _open(path.c_str(), _O_RDONLY | _O_BINARY | _O_NOINHERIT | _O_SEQUENTIAL);
+	if (descriptor < 0)
+	{
+		return false;
+	}
+
+	// Refuse directories up front rather than failing on the first read
+	struct _stati64 info;
+	int error_code = 0;
+	if (_fstati64(descriptor, &info) != 0)
+	{
+		error_code = errno;
+	}
+	else if ((info.st_mode & _S_IFDIR) != 0)
+	{
+		error_code = EISDIR;
+	}
+
+	if (error_code != 0)
+	{
+		_close(descriptor);
+		errno = error_code;
+		return false;
+	}
+
+	_descriptor = descriptor;
+	_ownsDescriptor = true;
+	start(offset);
+	return true;
+}
+
+bool ReadAheadStream::open(int descriptor, unsigned long long offset)
+{
+	close();
+
+	if (descriptor < 0 || _get_osfhandle(descriptor) == (intptr_t)INVALID_HANDLE_VALUE)
+	{
+		errno = EBADF;
+		return false;
+	}
+
+	_descriptor = descriptor;
+	_ownsDescriptor = false;
+	start(offset);
+	return true;
+}
+
+void ReadAheadStream::closeDescriptor()
+{
+	if (_ownsDescriptor)
+	{
+		_close(_descriptor);
+	}
+}
+
+long ReadAheadStream::readAt(char* buffer, std::size_t size, unsigned long long offset)
+{
+	// Reading at an offset through an OVERLAPPED structure is the closest there is to pread,
+	// although it still moves the file pointer of a descriptor shared with the caller
+	HANDLE handle = (HANDLE)_get_osfhandle(_descriptor);
+	OVERLAPPED overlapped;
+	ZeroMemory(&overlapped, sizeof(overlapped));
+	overlapped.Offset = (DWORD)(offset & 0xffffffffULL);
+	overlapped.OffsetHigh = (DWORD)(offset >> 32);
+
+	DWORD length = size > 0x40000000 ? 0x40000000 : (DWORD)size;
+	DWORD bytes_read = 0;
+	if (!ReadFile(handle, buffer, length, &bytes_read, &overlapped))
+	{
+		if (GetLastError() == ERROR_HANDLE_EOF)
+		{
+			return 0;
+		}
+		errno = EIO;
+		return -1;
+	}
+
+	return (long)bytes_read;
+}
+
+void ReadAheadStream::adviseWillNeed(unsigned long long offset, std::size_t length)
+{
+	// The file was opened for sequential access, which is all the read ahead hint there is
+	(void)offset;
+	(void)length;
+}
+
+}	// End of bump namespace
@@ -0,0 +1,432 @@
+//
+//  StringView.cpp
+//  Bump
+//
+//  Created by Joseph Holub on 10/18/26.
+//  Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+// Bump headers
+#include <bump/OutOfRangeError.h>
+#include <bump/StringView.h>
+
+// C headers
+#include <ctype.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+// C++ headers
+#include <limits>
+
+// Vector headers
+#if defined(__AVX2__)
+	#include <immintrin.h>
+	#define BUMP_STRING_VIEW_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#include <emmintrin.h>
+	#define BUMP_STRING_VIEW_SSE2
+#endif
+
+namespace bump {
+
+const std::size_t StringView::npos = static_cast<std::size_t>(-1);
+
+static inline unsigned int lowestSetBit(unsigned int mask)
+{
+#if defined(__GNUC__)
+	return __builtin_ctz(mask);
+#else
+	unsigned int bit = 0;
+	for (; (mask & 1) == 0; mask >>= 1)
+	{
+		++bit;
+	}
+	return bit;
+#endif
+}
+
+StringView::StringView() :
+	_data(""),
+	_length(0)
+{
+	;
+}
+
+StringView::StringView(const char* cString) :
+	_data(cString != NULL ? cString : ""),
+	_length(cString != NULL ? strlen(cString) : 0)
+{
+	;
+}
+
+StringView::StringView(const char* data, std::size_t length) :
+	_data(data),
+	_length(length)
+{
+	;
+}
+
+StringView::StringView(const std::string& stdString) :
+	_data(stdString.data()),
+	_length(stdString.size())
+{
+	;
+}
+
+const char* StringView::data() const
+{
+	return _data;
+}
+
+std::size_t StringView::length() const
+{
+	return _length;
+}
+
+bool StringView::isEmpty() const
+{
+	return _length == 0;
+}
+
+const char* StringView::begin() const
+{
+	return _data;
+}
+
+const char* StringView::end() const
+{
+	return _data + _length;
+}
+
+char StringView::operator[](std::size_t position) const
+{
+	return _data[position];
+}
+
+char StringView::at(std::size_t position) const
+{
+	if (position >= _length)
+	{
+		throw OutOfRangeError("Position is outside string view bounds", BUMP_LOCATION);
+	}
+
+	return _data[position];
+}
+
+StringView StringView::left(std::size_t n) const
+{
+	return StringView(_data, n < _length ? n : _length);
+}
+
+StringView StringView::right(std::size_t n) const
+{
+	if (n >= _length)
+	{
+		return *this;
+	}
+
+	return StringView(_data + _length - n, n);
+}
+
+StringView StringView::section(std::size_t startPosition, std::size_t length) const
+{
+	if (startPosition >= _length)
+	{
+		return StringView(_data + _length, 0);
+	}
+
+	std::size_t remaining = _length - startPosition;
+	return StringView(_data + startPosition, length < remaining ? length : remaining);
+}
+
+std::size_t StringView::indexOf(char character, std::size_t startPosition) const
+{
+	if (startPosition >= _length)
+	{
+		return npos;
+	}
+
+	const void* found = memchr(_data + startPosition, character, _length - startPosition);
+	return found != NULL ? static_cast<const char*>(found) - _data : npos;
+}
+
+std::size_t StringView::indexOf(const StringView& subString, std::size_t startPosition) const
+{
+	if (startPosition > _length || subString._length > _length - startPosition)
+	{
+		return npos;
+	}
+	else if (subString._length == 0)
+	{
+		return startPosition;
+	}
+
+	// The last position the whole sub string still fits at
+	std::size_t last_start = _length - subString._length;
+	std::size_t position = startPosition;
+	while ((position = indexOf(subString._data[0], position)) != npos && position <= last_start)
+	{
+		if (memcmp(_data + position + 1, subString._data + 1, subString._length - 1) == 0)
+		{
+			return position;
+		}
+		++position;
+	}
+
+	return npos;
+}
+
+std::size_t StringView::lastIndexOf(char character) const
+{
+	for (std::size_t i = _length; i > 0; --i)
+	{
+		if (_data[i - 1] == character)
+		{
+			return i - 1;
+		}
+	}
+
+	return npos;
+}
+
+std::size_t StringView::count(char character) const
+{
+	const char* position = _data;
+	const char* end = _data + _length;
+	std::size_t count = 0;
+
+	// Every match subtracts -1 from its byte lane, and the lanes are summed before any can reach 256
+#if defined(BUMP_STRING_VIEW_AVX2)
+	const __m256i pattern = _mm256_set1_epi8(character);
+	while (end - position >= 32)
+	{
+		std::size_t blocks = (end - position) / 32;
+		if (blocks > 255)
+		{
+			blocks = 255;
+		}
+
+		__m256i lanes = _mm256_setzero_si256();
+		for (std::size_t i = 0; i < blocks; ++i, position += 32)
+		{
+			__m256i block = _mm256_loadu_si256((const __m256i*)position);
+			lanes = _mm256_sub_epi8(lanes, _mm256_cmpeq_epi8(block, pattern));
+		}
+
+		unsigned long long sums[4];
+		_mm256_storeu_si256((__m256i*)sums, _mm256_sad_epu8(lanes, _mm256_setzero_si256()));
+		count += sums[0] + sums[1] + sums[2] + sums[3];
+	}
+#elif defined(BUMP_STRING_VIEW_SSE2)
+	const __m128i pattern = _mm_set1_epi8(character);
+	while (end - position >= 16)
+	{
+		std::size_t blocks = (end - position) / 16;
+		if (blocks > 255)
+		{
+			blocks = 255;
+		}
+
+		__m128i lanes = _mm_setzero_si128();
+		for (std::size_t i = 0; i < blocks; ++i, position += 16)
+		{
+			__m128i block = _mm_loadu_si128((const __m128i*)position);
+			lanes = _mm_sub_epi8(lanes, _mm_cmpeq_epi8(block, pattern));
+		}
+
+		unsigned long long sums[2];
+		_mm_storeu_si128((__m128i*)sums, _mm_sad_epu8(lanes, _mm_setzero_si128()));
+		count += sums[0] + sums[1];
+	}
+#endif
+
+	// Whatever is left over, or everything without vector instructions, is counted a byte at a time
+	for (; position < end; ++position)
+	{
+		if (*position == character)
+		{
+			++count;
+		}
+	}
+
+	return count;
+}
+
+void StringView::split(char separator, std::vector<StringView>& parts) const
+{
+	parts.clear();
+	const char* part_start = _data;
+	const char* position = _data;
+	const char* end = _data + _length;
+
+	// Compare a block at a time and only visit the bytes that matched, lowest first
+#if defined(BUMP_STRING_VIEW_AVX2) || defined(BUMP_STRING_VIEW_SSE2)
+	const __m128i pattern = _mm_set1_epi8(separator);
+	for (; end - position >= 16; position += 16)
+	{
+		__m128i block = _mm_loadu_si128((const __m128i*)position);
+		unsigned int matches = _mm_movemask_epi8(_mm_cmpeq_epi8(block, pattern));
+		while (matches != 0)
+		{
+			const char* match = position + lowestSetBit(matches);
+			parts.push_back(StringView(part_start, match - part_start));
+			part_start = match + 1;
+			matches &= matches - 1;
+		}
+	}
+#endif
+
+	// Whatever is left over, or everything without vector instructions, is checked a byte at a time
+	for (; position < end; ++position)
+	{
+		if (*position == separator)
+		{
+			parts.push_back(StringView(part_start, position - part_start));
+			part_start = position + 1;
+		}
+	}
+	parts.push_back(StringView(part_start, end - part_start));
+}
+
+bool StringView::startsWith(const StringView& startString) const
+{
+	return startString._length <= _length && memcmp(_data, startString._data, startString._length) == 0;
+}
+
+bool StringView::endsWith(const StringView& endString) const
+{
+	return endString._length <= _length &&
+		memcmp(_data + _length - endString._length, endString._data, endString._length) == 0;
+}
+
+bool StringView::toLongLong(long long& value) const
+{
+	std::size_t position = 0;
+	bool is_negative = false;
+	if (_length > 0 && (_data[0] == '-' || _data[0] == '+'))
+	{
+		is_negative = (_data[0] == '-');
+		++position;
+	}
+	if (position == _length)
+	{
+		return false;
+	}
+
+	// Accumulate the magnitude, refusing any digit that would take it past the limit for the sign
+	unsigned long long limit = (unsigned long long)std::numeric_limits<long long>::max() + (is_negative ? 1 : 0);
+	unsigned long long magnitude = 0;
+	for (; position < _length; ++position)
+	{
+		unsigned int digit = (unsigned char)_data[position] - '0';
+		if (digit > 9 || magnitude > (limit - digit) / 10)
+		{
+			return false;
+		}
+		magnitude = magnitude * 10 + digit;
+	}
+
+	// The most negative value has no positive counterpart, so negate one less than it
+	value = (is_negative && magnitude > 0) ? -(long long)(magnitude - 1) - 1 : (long long)magnitude;
+	return true;
+}
+
+bool StringView::toDouble(double& value) const
+{
+	// Read the digits into an integer mantissa and a power of ten, giving up on anything unusual
+	std::size_t position = 0;
+	bool is_negative = false;
+	if (_length > 0 && (_data[0] == '-' || _data[0] == '+'))
+	{
+		is_negative = (_data[0] == '-');
+		++position;
+	}
+
+	unsigned long long mantissa = 0;
+	int exponent = 0;
+	unsigned int digits = 0;
+	bool is_simple = true;
+	for (; position < _length && (unsigned char)(_data[position] - '0') <= 9; ++position, ++digits)
+	{
+		mantissa = mantissa * 10 + (_data[position] - '0');
+	}
+	if (position < _length && _data[position] == '.')
+	{
+		for (++position; position < _length && (unsigned char)(_data[position] - '0') <= 9; ++position, ++digits)
+		{
+			mantissa = mantissa * 10 + (_data[position] - '0');
+			--exponent;
+		}
+	}
+	if (digits > 0 && position < _length && (_data[position] == 'e' || _data[position] == 'E'))
+	{
+		StringView exponent_text = section(position + 1);
+		long long written_exponent = 0;
+		is_simple = exponent_text.toLongLong(written_exponent) && written_exponent > -1000 && written_exponent < 1000;
+		exponent += (int)written_exponent;
+		position = _length;
+	}
+
+	// An exact mantissa times an exact power of ten is correctly rounded by a single operation
+	static const double POWERS_OF_TEN[] = {
+		1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+		1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+	};
+	if (is_simple && digits > 0 && digits <= 19 && position == _length &&
+		mantissa <= (1ULL << 53) && exponent >= -22 && exponent <= 22)
+	{
+		double result = (double)mantissa;
+		result = exponent < 0 ? result / POWERS_OF_TEN[-exponent] : result * POWERS_OF_TEN[exponent];
+		value = is_negative ? -result : result;
+		return true;
+	}
+
+	// Everything else is left to the C library, which needs a terminated copy without leading spaces
+	if (_length == 0 || isspace((unsigned char)_data[0]))
+	{
+		return false;
+	}
+
+	std::string text(_data, _length);
+	char* end = NULL;
+	errno = 0;
+	double result = strtod(text.c_str(), &end);
+	if (end != text.c_str() + text.length() || errno == ERANGE)
+	{
+		return false;
+	}
+
+	value = result;
+	return true;
+}
+
+String StringView::toString() const
+{
+	return String(std::string(_data, _length));
+}
+
+bool StringView::operator == (const StringView& other) const
+{
+	return _length == other._length && memcmp(_data, other._data, _length) == 0;
+}
+
+bool StringView::operator != (const StringView& other) const
+{
+	return !(*this == other);
+}
+
+bool StringView::operator < (const StringView& other) const
+{
+	std::size_t length = _length < other._length ? _length : other._length;
+	int comparison = memcmp(_data, other._data, length);
+	return comparison < 0 || (comparison == 0 && _length < other._length);
+}
+
+std::ostream& operator << (std::ostream& os, const StringView& view)
+{
+	os.write(view.data(), view.length());
+	return os;
+}
+
+}	// End of bump namespace
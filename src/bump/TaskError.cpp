@@ -0,0 +1,25 @@
+//
+//	TaskError.cpp
+//	Bump
+//
+//	Created by Joseph Holub on 10/18/26.
+//	Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+// Bump headers
+#include <bump/TaskError.h>
+
+namespace bump {
+
+TaskError::TaskError(const String& description, const String& location) throw() :
+	RuntimeError("bump::TaskError", description, location)
+{
+	;
+}
+
+TaskError::~TaskError() throw()
+{
+	;
+}
+
+}	// End of bump namespace
@@ -0,0 +1,169 @@
+//
+//  TextChunker.cpp
+//  Bump
+//
+//  Created by Joseph Holub on 10/18/26.
+//  Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+// Bump headers
+#include <bump/TaskError.h>
+#include <bump/TextChunker.h>
+
+namespace bump {
+
+//====================================================================================
+//                                  Task Helpers
+//====================================================================================
+
+/**
+ * Counts down the tasks of a single processing run so the caller only waits for its own tasks.
+ */
+struct TaskLatch
+{
+	boost::mutex				mutex;				/**< Guards the number of remaining tasks and the failure. */
+	boost::condition_variable	finished;			/**< Signalled when the last task finishes. */
+	std::size_t					remainingTasks;		/**< The number of tasks that have not finished yet. */
+	bool						failed;				/**< Whether any task threw. */
+	String						failure;			/**< The description of the first exception a task threw. */
+};
+
+/**
+ * Counts a task as finished when it goes out of scope, even when the task throws.
+ */
+class TaskCompletion
+{
+public:
+
+	TaskCompletion(TaskLatch& latch) :
+		_latch(latch)
+	{
+		;
+	}
+
+	~TaskCompletion()
+	{
+		boost::mutex::scoped_lock lock(_latch.mutex);
+		if (--_latch.remainingTasks == 0)
+		{
+			_latch.finished.notify_all();
+		}
+	}
+
+protected:
+
+	TaskLatch& _latch;		/**< The latch of the processing run the task belongs to. */
+};
+
+static void recordTaskFailure(TaskLatch& latch, const String& description)
+{
+	boost::mutex::scoped_lock lock(latch.mutex);
+	if (!latch.failed)
+	{
+		latch.failed = true;
+		latch.failure = description;
+	}
+}
+
+static void runCountedTask(const ThreadPool::Task& task, TaskLatch* latch)
+{
+	// The pool would only log the exception, so keep it for the waiting thread to rethrow
+	TaskCompletion completion(*latch);
+	try
+	{
+		task();
+	}
+	catch (const bump::Exception& e)
+	{
+		recordTaskFailure(*latch, e.description());
+	}
+	catch (const std::exception& e)
+	{
+		recordTaskFailure(*latch, e.what());
+	}
+	catch (...)
+	{
+		recordTaskFailure(*latch, "Unknown exception");
+	}
+}
+
+//====================================================================================
+//                                   TextChunker
+//====================================================================================
+
+const std::size_t TextChunker::DEFAULT_CHUNK_SIZE = 4194304;
+
+TextChunker::TextChunker(const StringView& contents, std::size_t chunkSize) :
+	_contents(contents),
+	_chunks()
+{
+	if (chunkSize == 0)
+	{
+		chunkSize = DEFAULT_CHUNK_SIZE;
+	}
+	_chunks.reserve(contents.length() / chunkSize + 1);
+
+	// Move every cut forward to just past the next newline so each chunk holds whole lines
+	std::size_t start = 0;
+	while (start < contents.length())
+	{
+		std::size_t end = contents.length();
+		if (contents.length() - start > chunkSize)
+		{
+			std::size_t newline = contents.indexOf('\n', start + chunkSize - 1);
+			end = newline == StringView::npos ? contents.length() : newline + 1;
+		}
+
+		TextChunk chunk;
+		chunk.index = _chunks.size();
+		chunk.offset = start;
+		chunk.contents = contents.section(start, end - start);
+		_chunks.push_back(chunk);
+		start = end;
+	}
+}
+
+const StringView& TextChunker::contents() const
+{
+	return _contents;
+}
+
+std::size_t TextChunker::numberOfChunks() const
+{
+	return _chunks.size();
+}
+
+const std::vector<TextChunk>& TextChunker::chunks() const
+{
+	return _chunks;
+}
+
+void TextChunker::runTasks(ThreadPool& pool, const std::vector<ThreadPool::Task>& tasks)
+{
+	if (tasks.empty())
+	{
+		return;
+	}
+
+	// The pool may be running other work, so wait on a latch rather than the whole pool
+	TaskLatch latch;
+	latch.remainingTasks = tasks.size();
+	latch.failed = false;
+	for (std::size_t i = 0; i < tasks.size(); ++i)
+	{
+		pool.submit(boost::bind(&runCountedTask, tasks[i], &latch));
+	}
+
+	boost::mutex::scoped_lock lock(latch.mutex);
+	while (latch.remainingTasks > 0)
+	{
+		latch.finished.wait(lock);
+	}
+
+	if (latch.failed)
+	{
+		throw TaskError(String("A chunk task threw an exception: ") + latch.failure, BUMP_LOCATION);
+	}
+}
+
+}	// End of bump namespace
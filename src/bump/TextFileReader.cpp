@@ -7,77 +7,356 @@
 //
 
 // Bump Headers
+#include <bump/DecompressingReader.h>
 #include <bump/FileSystem.h>
+#include <bump/LineIndex.h>
 #include <bump/Log.h>
+#include <bump/ReadAheadStream.h>
+#include <bump/TextChunker.h>
 #include <bump/TextFileReader.h>
 
+// C Headers
+#include <errno.h>
+
 // C++ Headers
+#include <deque>
 #include <fstream>
+#include <vector>
 
 namespace bump {
 
 namespace TextFileReader {
 
-StringList readFileLines(String fileName, int beginningLine, int numLines)
+// The number of bytes read at a time while scanning backwards for the footer
+static const std::streamoff FOOTER_BLOCK_SIZE = 65536;
+
+// The number of decompressed or read ahead bytes split into lines at a time
+static const std::size_t STREAM_BLOCK_SIZE = 262144;
+
+// The number of bytes read at a time when only a few lines are read
+static const std::size_t SEQUENTIAL_BLOCK_SIZE = 8192;
+
+// The fewest lines worth starting a read ahead thread for, reading fewer goes straight through the file
+static const int READ_AHEAD_MINIMUM_LINES = 4096;
+
+/**
+ * Reads a plain file from an offset on the calling thread, for reads too short to be
+ * worth starting a ReadAheadStream and filling its buffers.
+ */
+struct SequentialFileReader
 {
-	// Create StringList to store info
+	bool open(const String& fileName, std::streamoff offset)
+	{
+		file.open(fileName.toStdString().data(), std::ios::in | std::ios::binary);
+		if (!file.is_open())
+		{
+			return false;
+		}
+
+		file.seekg(offset, std::ios::beg);
+		return !file.fail();
+	}
+
+	long read(char* buffer, std::size_t size)
+	{
+		file.read(buffer, size);
+		if (file.bad())
+		{
+			errno = EIO;
+			return -1;
+		}
+
+		return (long)file.gcount();
+	}
+
+	std::ifstream		file;		/**< The file being read. */
+};
+
+static void splitLines(const StringView& contents, StringList& lines)
+{
+	// Every newline ends a line, and whatever follows the last one is the final line
+	std::size_t line_start = 0;
+	std::size_t newline = 0;
+	while ((newline = contents.indexOf('\n', line_start)) != StringView::npos)
+	{
+		lines.push_back(contents.section(line_start, newline - line_start).toString());
+		line_start = newline + 1;
+	}
+	lines.push_back(contents.section(line_start).toString());
+}
+
+static bool isCompressed(const String& fileName)
+{
+	return DecompressingReader::detectFormat(fileName) != DecompressingReader::UNCOMPRESSED;
+}
+
+static bool openCompressedFile(const String& fileName, DecompressingReader& reader)
+{
+	if (!reader.open(fileName))
+	{
+		bumpERROR_P("FileReader: Error decompressing ", fileName);
+		return false;
+	}
+
+	return true;
+}
+
+template <class Reader>
+static StringList readStreamLines(Reader& reader, const String& fileName, int beginningLine, int numLines,
+								  std::size_t blockSize = STREAM_BLOCK_SIZE)
+{
+	// Split the blocks the same way std::getline splits a file, only keeping the
+	// characters of the requested lines and stopping as soon as they are read
 	StringList file_contents;
+	unsigned long long first_line = beginningLine > 1 ? beginningLine : 1;
+	unsigned long long line_number = 1;
+	std::string line;
+	std::vector<char> block(blockSize);
+	long bytes_read = 0;
+	while ((bytes_read = reader.read(&block[0], block.size())) > 0)
+	{
+		StringView contents(&block[0], bytes_read);
+		std::size_t line_start = 0;
+		std::size_t newline = 0;
+		while ((newline = contents.indexOf('\n', line_start)) != StringView::npos)
+		{
+			if (line_number >= first_line)
+			{
+				line.append(contents.data() + line_start, newline - line_start);
+				file_contents.push_back(line);
+				if (numLines > 0 && file_contents.size() == (std::size_t)numLines)
+				{
+					return file_contents;
+				}
+			}
+			line.clear();
+			++line_number;
+			line_start = newline + 1;
+		}
+
+		if (line_number >= first_line)
+		{
+			line.append(contents.data() + line_start, contents.length() - line_start);
+		}
+	}
+
+	if (bytes_read < 0)
+	{
+		bumpERROR_P("FileReader: Error reading ", fileName);
+		return file_contents;
+	}
+	else if (line_number < first_line)
+	{
+		bumpERROR_P("FileReader: ", "The line requested is larger than the number of lines in the file");
+		return file_contents;
+	}
 
+	// Whatever follows the last newline is the final line
+	file_contents.push_back(line);
+	return file_contents;
+}
+
+static StringList readCompressedLines(const String& fileName, int beginningLine, int numLines)
+{
+	DecompressingReader reader;
+	if (numLines == 0 || !openCompressedFile(fileName, reader))
+	{
+		return StringList();
+	}
+
+	return readStreamLines(reader, fileName, beginningLine, numLines);
+}
+
+static StringList readCompressedFooter(const String& fileName, int numLines)
+{
+	StringList file_contents;
+	DecompressingReader reader;
+	if (!openCompressedFile(fileName, reader))
+	{
+		return file_contents;
+	}
+
+	// The last line is always the one being read, and once numLines lines are kept the
+	// oldest one is recycled to read the next line into
+	std::deque<std::string> lines(1);
+	std::vector<char> block(STREAM_BLOCK_SIZE);
+	long bytes_read = 0;
+	while ((bytes_read = reader.read(&block[0], block.size())) > 0)
+	{
+		StringView contents(&block[0], bytes_read);
+		std::size_t line_start = 0;
+		std::size_t newline = 0;
+		while ((newline = contents.indexOf('\n', line_start)) != StringView::npos)
+		{
+			lines.back().append(contents.data() + line_start, newline - line_start);
+			lines.push_back(std::string());
+			if (lines.size() > (std::size_t)numLines)
+			{
+				lines.back().swap(lines.front());
+				lines.pop_front();
+				lines.back().clear();
+			}
+			line_start = newline + 1;
+		}
+		lines.back().append(contents.data() + line_start, contents.length() - line_start);
+	}
+
+	if (bytes_read < 0)
+	{
+		bumpERROR_P("FileReader: Error decompressing ", fileName);
+		return file_contents;
+	}
+
+	file_contents.assign(lines.begin(), lines.end());
+	return file_contents;
+}
+
+static int countCompressedLines(const String& fileName)
+{
+	DecompressingReader reader;
+	if (!openCompressedFile(fileName, reader))
+	{
+		return -1;
+	}
+
+	unsigned long long newlines = 0;
+	std::vector<char> block(STREAM_BLOCK_SIZE);
+	long bytes_read = 0;
+	while ((bytes_read = reader.read(&block[0], block.size())) > 0)
+	{
+		newlines += StringView(&block[0], bytes_read).count('\n');
+	}
+
+	if (bytes_read < 0)
+	{
+		bumpERROR_P("FileReader: Error decompressing ", fileName);
+		return -1;
+	}
+
+	return newlines + 1;
+}
+
+/**
+ * The matches found in a single chunk, numbered from the start of the chunk.
+ */
+struct ChunkMatches
+{
+	ChunkMatches() : numberOfNewlines(0) {}
+
+	unsigned long long	numberOfNewlines;	/**< The number of newlines in the chunk. */
+	TextMatchList		matches;			/**< The matching lines of the chunk. */
+};
+
+static bool mapTextFile(const String& fileName, MappedFile& file)
+{
 	// Check to see if the file is valid before opening
 	bool is_valid = FileSystem::isFile(fileName);
 	if (!is_valid)
 	{
 		bumpERROR_P("FileSystem: ", "File to open is not a valid file");
-		return file_contents;
+		return false;
 	}
 	bumpINFO_P("FileReader: Reading File ", fileName);
 
-	// Open File
-	std::ifstream input_file;
-	input_file.open(fileName.toStdString().data(), std::ios::in);
-	if (!input_file.is_open())
+	// Map the file rather than reading it line by line, so no line is ever copied
+	if (!file.open(fileName))
 	{
 		bumpERROR_P("FileReader: Error opening ", fileName);
-		return file_contents;
+		return false;
 	}
+	file.advise(MappedFile::SEQUENTIAL_ACCESS);
 
-	std::string line;
-	input_file.seekg(0, std::ios::beg);
-	for (unsigned int i = 1; i < beginningLine; i++)
+	return true;
+}
+
+static void countChunkNewlines(const TextChunk& chunk, unsigned long long& newlines)
+{
+	newlines = chunk.contents.count('\n');
+}
+
+static void grepChunk(const TextChunk& chunk, const StringView& pattern, ChunkMatches& result)
+{
+	// Search the whole chunk for the pattern and only look for the bounds of the lines that
+	// match, counting the newlines skipped over in between to number them
+	const StringView& contents = chunk.contents;
+	std::size_t counted_up_to = 0;
+	std::size_t search_start = 0;
+	std::size_t match = 0;
+	while ((match = contents.indexOf(pattern, search_start)) != StringView::npos && match < contents.length())
 	{
-		std::getline(input_file, line);
-		if (input_file.eof())
+		std::size_t previous_newline = contents.left(match).lastIndexOf('\n');
+		std::size_t line_start = previous_newline == StringView::npos ? 0 : previous_newline + 1;
+		std::size_t newline = contents.indexOf('\n', match);
+		std::size_t line_end = newline == StringView::npos ? contents.length() : newline;
+		result.numberOfNewlines += contents.section(counted_up_to, line_start - counted_up_to).count('\n');
+		counted_up_to = line_start;
+
+		std::size_t length = line_end - line_start;
+		if (length > 0 && contents[line_end - 1] == '\r')
 		{
-			bumpERROR_P("FileReader: ", "The line requested is larger than the number of lines in the file");
-			return file_contents;
+			--length;
 		}
+
+		TextMatch text_match;
+		text_match.lineNumber = result.numberOfNewlines + 1;
+		text_match.offset = chunk.offset + line_start;
+		text_match.line = contents.section(line_start, length).toString();
+		result.matches.push_back(text_match);
+
+		// Each line is reported once, however many times it matches
+		search_start = line_end + 1;
 	}
 
-	if (numLines == -1)
+	result.numberOfNewlines += contents.section(counted_up_to).count('\n');
+}
+
+StringList readFileLines(String fileName, int beginningLine, int numLines, std::streamoff startOffset = 0, int startLine = 1)
+{
+	// Create StringList to store info
+	StringList file_contents;
+
+	// Check to see if the file is valid before opening
+	bool is_valid = FileSystem::isFile(fileName);
+	if (!is_valid)
 	{
-		while (!input_file.eof())
-		{
-			std::getline(input_file, line);
-			file_contents.push_back(line);
-		}
+		bumpERROR_P("FileSystem: ", "File to open is not a valid file");
+		return file_contents;
+	}
+	bumpINFO_P("FileReader: Reading File ", fileName);
+
+	// Compressed files can only be decompressed from the start, so any indexed offset is ignored
+	if (isCompressed(fileName))
+	{
+		return readCompressedLines(fileName, beginningLine, numLines);
 	}
-	else
+
+	// Only read the file ahead on a background thread when the rest of it or a large part is
+	// wanted, since a few lines such as a header are read before the thread would even start
+	int first_line = beginningLine - startLine + 1;
+	if (numLines < 0 || first_line + numLines > READ_AHEAD_MINIMUM_LINES)
 	{
-		// Read the specified lines from the file
-		for (unsigned int i = 0; i < numLines; i++)
+		ReadAheadStream stream(STREAM_BLOCK_SIZE);
+		if (!stream.open(fileName, startOffset))
 		{
-			if (input_file.eof())
-			{
-				bumpINFO_P("FileReader: ", "More lines were requested than were in the file");
-				return file_contents;
-			}
-			std::getline(input_file, line);
-			file_contents.push_back(line);
+			bumpERROR_P("FileReader: Error opening ", fileName);
+			return file_contents;
 		}
+
+		return readStreamLines(stream, fileName, first_line, numLines);
 	}
 
-	input_file.close();
-	return file_contents;
+	SequentialFileReader reader;
+	if (!reader.open(fileName, startOffset))
+	{
+		bumpERROR_P("FileReader: Error opening ", fileName);
+		return file_contents;
+	}
+	else if (numLines == 0)
+	{
+		return file_contents;
+	}
+
+	return readStreamLines(reader, fileName, first_line, numLines, SEQUENTIAL_BLOCK_SIZE);
 }
 
 StringList fileContents(const String& fileName)
@@ -110,6 +389,44 @@ StringList fileContents(const String& fileName, int beginningLine)
 	return readFileLines(fileName, beginningLine, number_of_lines);
 }
 
+StringList fileContents(const String& fileName, int beginningLine, int numLines, const LineIndex& index)
+{
+	if (beginningLine < 1)
+	{
+		bumpINFO_P("FileReader: ", "The beginningLine can not be less than 1");
+		StringList empty_string;
+		return empty_string;
+	}
+
+	// A stale index would seek into the middle of some other line, so read from the start instead
+	if (!index.isCurrent(fileName))
+	{
+		bumpWARNING_P("FileReader: The line index is out of date for ", fileName);
+		return readFileLines(fileName, beginningLine, numLines);
+	}
+
+	// Lines past the end of the file are left to be reported while skipping from the last indexed line
+	unsigned long long indexed_line = 0;
+	unsigned long long offset = 0;
+	unsigned long long line = beginningLine;
+	index.locate(line <= index.numberOfLines() ? line : index.numberOfLines(), indexed_line, offset);
+
+	return readFileLines(fileName, beginningLine, numLines, (std::streamoff)offset, (int)indexed_line);
+}
+
+StringList fileContents(const MappedFile& file)
+{
+	StringList file_contents;
+	if (!file.isOpen())
+	{
+		bumpERROR_P("FileReader: ", "The mapped file is not open");
+		return file_contents;
+	}
+
+	splitLines(file.view(), file_contents);
+	return file_contents;
+}
+
 String firstLine(const String& fileName)
 {
 	StringList file_contents = readFileLines(fileName, 0, 1);
@@ -137,53 +454,227 @@ StringList header(const String& fileName, int numLines)
 
 StringList footer(const String& fileName, int numLines)
 {
-	int file_num_lines = numberOfLines(fileName);
-	if (file_num_lines == -1)
-	{
-		StringList empty_string;
-		return empty_string;
-	}
-	int beginning_line = file_num_lines - numLines + 1;
-	if (beginning_line < 0)
+	StringList file_contents;
+	if (numLines < 1)
 	{
-		beginning_line = 0;
+		bumpINFO_P("FileReader: ", "The numLines can not be less than 1 for a footer");
+		return file_contents;
 	}
 
-	return readFileLines(fileName, beginning_line, numLines);
-}
-
-int numberOfLines(const String& fileName)
-{
 	// Check to see if the file is valid before opening
 	bool is_valid = FileSystem::isFile(fileName);
 	if (!is_valid)
 	{
 		bumpERROR_P("FileSystem: ", "File to open is not a valid file");
-		return -1;
+		return file_contents;
 	}
 	bumpINFO_P("FileReader: Reading File ", fileName);
 
+	// Compressed files cannot be read backwards, so they are decompressed once keeping only the last lines
+	if (isCompressed(fileName))
+	{
+		return readCompressedFooter(fileName, numLines);
+	}
+
 	// Open File
 	std::ifstream input_file;
-	input_file.open(fileName.toStdString().data(), std::ios::in);
+	input_file.open(fileName.toStdString().data(), std::ios::in | std::ios::binary);
 	if (!input_file.is_open())
 	{
 		bumpERROR_P("FileReader: Error opening ", fileName);
+		return file_contents;
+	}
+
+	// Scan backwards from the end a block at a time, since the footer starts right after
+	// the numLines-th newline from the end, so only the footer itself is ever read
+	input_file.seekg(0, std::ios::end);
+	std::streamoff file_size = input_file.tellg();
+	std::streamoff footer_start = 0;
+	std::streamoff position = file_size;
+	std::vector<char> block;
+	int newlines = 0;
+	while (position > footer_start && newlines < numLines)
+	{
+		std::streamoff block_size = position < FOOTER_BLOCK_SIZE ? position : FOOTER_BLOCK_SIZE;
+		position -= block_size;
+		block.resize(block_size);
+		input_file.seekg(position, std::ios::beg);
+		if (!input_file.read(&block[0], block_size))
+		{
+			bumpERROR_P("FileReader: Error reading ", fileName);
+			return file_contents;
+		}
+
+		for (std::streamoff i = block_size; i > 0; --i)
+		{
+			if (block[i - 1] == '\n' && ++newlines == numLines)
+			{
+				footer_start = position + i;
+				break;
+			}
+		}
+	}
+
+	// Read the footer and split it into lines
+	std::vector<char> footer_data(file_size - footer_start);
+	if (!footer_data.empty())
+	{
+		input_file.seekg(footer_start, std::ios::beg);
+		if (!input_file.read(&footer_data[0], footer_data.size()))
+		{
+			bumpERROR_P("FileReader: Error reading ", fileName);
+			return file_contents;
+		}
+	}
+
+	splitLines(footer_data.empty() ? StringView() : StringView(&footer_data[0], footer_data.size()), file_contents);
+	return file_contents;
+}
+
+int numberOfLines(const String& fileName)
+{
+	if (isCompressed(fileName))
+	{
+		return countCompressedLines(fileName);
+	}
+
+	MappedFile file;
+	if (!mapTextFile(fileName, file))
+	{
 		return -1;
 	}
 
-	std::string line;
-	input_file.seekg(0, std::ios::beg);
-	unsigned int num_lines = 0;
-	while (!input_file.eof())
+	// Every newline ends a line, and whatever follows the last one is counted as the final line
+	return file.view().count('\n') + 1;
+}
+
+int numberOfLines(const String& fileName, ThreadPool& pool)
+{
+	// Decompressing is the bottleneck for compressed files, and the counting already overlaps with it
+	if (isCompressed(fileName))
+	{
+		return countCompressedLines(fileName);
+	}
+
+	MappedFile file;
+	if (!mapTextFile(fileName, file))
+	{
+		return -1;
+	}
+
+	std::vector<unsigned long long> newlines;
+	TextChunker(file.view()).processChunks(pool, &countChunkNewlines, newlines);
+
+	unsigned long long number_of_lines = 1;
+	for (std::size_t i = 0; i < newlines.size(); ++i)
+	{
+		number_of_lines += newlines[i];
+	}
+
+	return number_of_lines;
+}
+
+static void grepLines(const StringView& lines, unsigned long long offset, const StringView& pattern,
+	unsigned long long& precedingLines, TextMatchList& matches)
+{
+	TextChunk chunk;
+	chunk.index = 0;
+	chunk.offset = offset;
+	chunk.contents = lines;
+	ChunkMatches result;
+	grepChunk(chunk, pattern, result);
+
+	for (std::size_t i = 0; i < result.matches.size(); ++i)
 	{
-		std::getline(input_file, line);
-		num_lines++;
+		matches.push_back(result.matches[i]);
+		matches.back().lineNumber += precedingLines;
 	}
+	precedingLines += result.numberOfNewlines;
+}
+
+static bool grepCompressedFile(const String& fileName, const StringView& pattern, TextMatchList& matches)
+{
+	DecompressingReader reader;
+	if (!openCompressedFile(fileName, reader))
+	{
+		return false;
+	}
+
+	// Search the whole lines of each block as it is decompressed, carrying the unfinished
+	// last line over to the next block, so only a block and a line are ever held in memory
+	std::string pending;
+	unsigned long long pending_offset = 0;
+	unsigned long long preceding_lines = 0;
+	std::vector<char> block(STREAM_BLOCK_SIZE);
+	long bytes_read = 0;
+	while ((bytes_read = reader.read(&block[0], block.size())) > 0)
+	{
+		std::size_t last_newline = StringView(&block[0], bytes_read).lastIndexOf('\n');
+		if (last_newline == StringView::npos)
+		{
+			pending.append(&block[0], bytes_read);
+			continue;
+		}
 
-	input_file.close();
+		std::size_t length = pending.length() + last_newline + 1;
+		pending.append(&block[0], bytes_read);
+		grepLines(StringView(pending).left(length), pending_offset, pattern, preceding_lines, matches);
+		pending.erase(0, length);
+		pending_offset += length;
+	}
+
+	if (bytes_read < 0)
+	{
+		bumpERROR_P("FileReader: Error decompressing ", fileName);
+		return false;
+	}
+
+	// Whatever follows the last newline is the final line
+	grepLines(StringView(pending), pending_offset, pattern, preceding_lines, matches);
+	return true;
+}
+
+TextMatchList grep(const String& fileName, const StringView& pattern, ThreadPool& pool)
+{
+	TextMatchList matches;
+	if (pattern.indexOf('\n') != StringView::npos)
+	{
+		bumpINFO_P("FileReader: ", "The search pattern can not span more than one line");
+		return matches;
+	}
+
+	// Decompressing is the bottleneck for compressed files, so they are searched a block at a time as they are decompressed
+	if (isCompressed(fileName))
+	{
+		if (!grepCompressedFile(fileName, pattern, matches))
+		{
+			matches.clear();
+		}
+		return matches;
+	}
+
+	MappedFile file;
+	if (!mapTextFile(fileName, file))
+	{
+		return matches;
+	}
+
+	std::vector<ChunkMatches> chunk_matches;
+	TextChunker(file.view()).processChunks(pool, boost::bind(&grepChunk, _1, pattern, _2), chunk_matches);
+
+	// Number the lines of each chunk after all the lines of the chunks before it
+	unsigned long long preceding_lines = 0;
+	for (std::size_t i = 0; i < chunk_matches.size(); ++i)
+	{
+		for (std::size_t j = 0; j < chunk_matches[i].matches.size(); ++j)
+		{
+			matches.push_back(chunk_matches[i].matches[j]);
+			matches.back().lineNumber += preceding_lines;
+		}
+		preceding_lines += chunk_matches[i].numberOfNewlines;
+	}
 
-	return num_lines;
+	return matches;
 }
 
 }	// End of TextFileReader namespace
@@ -0,0 +1,229 @@
+//
+//  ThreadPool.cpp
+//  Bump
+//
+//  Created by Joseph Holub on 10/18/26.
+//  Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+// Boost headers
+#include <boost/bind.hpp>
+
+// Bump headers
+#include <bump/Exception.h>
+#include <bump/Log.h>
+#include <bump/ThreadPool.h>
+
+namespace bump {
+
+/**
+ * Identifies the pool and worker that own the current thread.
+ */
+struct WorkerIdentity
+{
+	const ThreadPool*	pool;
+	unsigned int		index;
+};
+
+// Global thread local identity of the current worker thread
+static boost::thread_specific_ptr<WorkerIdentity> gCurrentWorker;
+
+ThreadPool::ThreadPool(unsigned int numberOfThreads) :
+	_queuedTasks(0),
+	_pendingTasks(0),
+	_nextWorker(0),
+	_stopping(false)
+{
+	if (numberOfThreads == 0)
+	{
+		numberOfThreads = idealThreadCount();
+	}
+
+	// Create all the queues before starting any threads since workers steal from each other
+	for (unsigned int i = 0; i < numberOfThreads; ++i)
+	{
+		_workers.push_back(new Worker());
+	}
+
+	for (unsigned int i = 0; i < numberOfThreads; ++i)
+	{
+		_threads.create_thread(boost::bind(&ThreadPool::run, this, i));
+	}
+}
+
+ThreadPool::~ThreadPool()
+{
+	waitForDone();
+
+	// Wake up all the workers and tell them to exit
+	{
+		boost::mutex::scoped_lock lock(_mutex);
+		_stopping = true;
+	}
+	_taskQueued.notify_all();
+	_threads.join_all();
+
+	for (unsigned int i = 0; i < _workers.size(); ++i)
+	{
+		delete _workers[i];
+	}
+}
+
+unsigned int ThreadPool::idealThreadCount()
+{
+	unsigned int count = boost::thread::hardware_concurrency();
+	return count == 0 ? 1 : count;
+}
+
+unsigned int ThreadPool::numberOfThreads() const
+{
+	return _workers.size();
+}
+
+void ThreadPool::submit(const Task& task)
+{
+	// Count the task as pending before it becomes visible so waitForDone() can never miss it
+	unsigned int index;
+	{
+		boost::mutex::scoped_lock lock(_mutex);
+		++_pendingTasks;
+
+		int current_index = currentWorkerIndex();
+		if (current_index >= 0)
+		{
+			index = current_index;
+		}
+		else
+		{
+			index = _nextWorker;
+			_nextWorker = (_nextWorker + 1) % _workers.size();
+		}
+	}
+
+	// Push the task onto the back of the chosen worker's queue
+	{
+		boost::mutex::scoped_lock lock(_workers[index]->mutex);
+		_workers[index]->tasks.push_back(task);
+	}
+
+	// Wake up a sleeping worker to run or steal the task
+	{
+		boost::mutex::scoped_lock lock(_mutex);
+		++_queuedTasks;
+	}
+	_taskQueued.notify_one();
+}
+
+void ThreadPool::waitForDone()
+{
+	boost::mutex::scoped_lock lock(_mutex);
+	while (_pendingTasks != 0)
+	{
+		_tasksFinished.wait(lock);
+	}
+}
+
+void ThreadPool::run(unsigned int index)
+{
+	WorkerIdentity* identity = new WorkerIdentity();
+	identity->pool = this;
+	identity->index = index;
+	gCurrentWorker.reset(identity);
+
+	while (true)
+	{
+		Task task;
+		if (takeTask(index, task))
+		{
+			// Never let a failing task take down the worker thread
+			try
+			{
+				task();
+			}
+			catch (const bump::Exception& e)
+			{
+				bumpERROR_P("ThreadPool: ", String("Task threw an exception: ") + e.description());
+			}
+			catch (const std::exception& e)
+			{
+				bumpERROR_P("ThreadPool: ", String("Task threw an exception: ") + e.what());
+			}
+			catch (...)
+			{
+				bumpERROR_P("ThreadPool: ", "Task threw an unknown exception");
+			}
+
+			boost::mutex::scoped_lock lock(_mutex);
+			--_pendingTasks;
+			if (_pendingTasks == 0)
+			{
+				_tasksFinished.notify_all();
+			}
+
+			continue;
+		}
+
+		// Sleep until there is something to run or steal
+		boost::mutex::scoped_lock lock(_mutex);
+		while (_queuedTasks <= 0 && !_stopping)
+		{
+			_taskQueued.wait(lock);
+		}
+
+		if (_stopping && _queuedTasks <= 0)
+		{
+			return;
+		}
+	}
+}
+
+bool ThreadPool::takeTask(unsigned int index, Task& task)
+{
+	bool found = false;
+
+	// Pop the newest task off our own queue first
+	{
+		Worker* worker = _workers[index];
+		boost::mutex::scoped_lock lock(worker->mutex);
+		if (!worker->tasks.empty())
+		{
+			task = worker->tasks.back();
+			worker->tasks.pop_back();
+			found = true;
+		}
+	}
+
+	// Otherwise steal the oldest task from one of the other workers
+	for (unsigned int i = 1; !found && i < _workers.size(); ++i)
+	{
+		Worker* victim = _workers[(index + i) % _workers.size()];
+		boost::mutex::scoped_lock lock(victim->mutex);
+		if (!victim->tasks.empty())
+		{
+			task = victim->tasks.front();
+			victim->tasks.pop_front();
+			found = true;
+		}
+	}
+
+	if (found)
+	{
+		boost::mutex::scoped_lock lock(_mutex);
+		--_queuedTasks;
+	}
+
+	return found;
+}
+
+int ThreadPool::currentWorkerIndex() const
+{
+	WorkerIdentity* identity = gCurrentWorker.get();
+	if (identity != NULL && identity->pool == this)
+	{
+		return identity->index;
+	}
+
+	return -1;
+}
+
+}	// End of bump namespace
@@ -114,6 +114,21 @@ namespace sha1
             result[3] += d;
             result[4] += e;
         }
+
+        // Hashes a complete 64 byte block.
+        void hashBlock(unsigned int* result, const unsigned char* block)
+        {
+            unsigned int w[80];
+            for (int roundPos = 0; roundPos < 16; ++roundPos)
+            {
+                // This line will swap endian on big endian and keep endian on little endian.
+                w[roundPos] = (unsigned int) block[(roundPos << 2) + 3]
+                        | (((unsigned int) block[(roundPos << 2) + 2]) << 8)
+                        | (((unsigned int) block[(roundPos << 2) + 1]) << 16)
+                        | (((unsigned int) block[roundPos << 2]) << 24);
+            }
+            innerHash(result, w);
+        }
     } // namespace
 
     void calc(const void* src, const int bytelength, unsigned char* hash)
@@ -172,6 +187,77 @@ namespace sha1
         }
     }
 
+    void init(Context& context)
+    {
+        context.result[0] = 0x67452301;
+        context.result[1] = 0xefcdab89;
+        context.result[2] = 0x98badcfe;
+        context.result[3] = 0x10325476;
+        context.result[4] = 0xc3d2e1f0;
+        context.blockLength = 0;
+        context.totalLength = 0;
+    }
+
+    void update(Context& context, const void* src, const int bytelength)
+    {
+        const unsigned char* sarray = (const unsigned char*) src;
+        context.totalLength += bytelength;
+        int currentByte = 0;
+
+        // Complete the block left over from the last piece first.
+        if (context.blockLength > 0)
+        {
+            while (context.blockLength < 64 && currentByte < bytelength)
+            {
+                context.block[context.blockLength++] = sarray[currentByte++];
+            }
+            if (context.blockLength < 64)
+            {
+                return;
+            }
+            hashBlock(context.result, context.block);
+            context.blockLength = 0;
+        }
+
+        // Hash the complete 64 byte blocks straight from the data and keep the rest for the next piece.
+        for (; currentByte + 64 <= bytelength; currentByte += 64)
+        {
+            hashBlock(context.result, sarray + currentByte);
+        }
+        while (currentByte < bytelength)
+        {
+            context.block[context.blockLength++] = sarray[currentByte++];
+        }
+    }
+
+    void finish(Context& context, unsigned char* hash)
+    {
+        unsigned int w[80];
+        clearWBuffert(w);
+        unsigned int lastBlockBytes = 0;
+        for (; lastBlockBytes < context.blockLength; ++lastBlockBytes)
+        {
+            w[lastBlockBytes >> 2] |= (unsigned int) context.block[lastBlockBytes] << ((3 - (lastBlockBytes & 3)) << 3);
+        }
+        w[lastBlockBytes >> 2] |= 0x80 << ((3 - (lastBlockBytes & 3)) << 3);
+        if (lastBlockBytes >= 56)
+        {
+            innerHash(context.result, w);
+            clearWBuffert(w);
+        }
+
+        // The length is stored in bits as a 64 bit number, so pieces can add up to more than an int can hold.
+        const unsigned long long bitlength = context.totalLength << 3;
+        w[14] = (unsigned int) (bitlength >> 32);
+        w[15] = (unsigned int) bitlength;
+        innerHash(context.result, w);
+
+        for (int hashByte = 20; --hashByte >= 0;)
+        {
+            hash[hashByte] = (context.result[hashByte >> 2] >> (((3 - hashByte) & 0x3) << 3)) & 0xff;
+        }
+    }
+
     void toHexString(const unsigned char* hash, char* hexstring)
     {
         const char hexDigits[] = { "0123456789abcdef" };
@@ -0,0 +1,167 @@
+//
+//	AtomicFileWriterTest.cpp
+//	Bump
+//
+//	Created by Joseph Holub on 10/18/26.
+//	Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+// Bump headers
+#include <bump/AtomicFileWriter.h>
+#include <bump/FileSystem.h>
+
+// C++ headers
+#include <fstream>
+#include <iterator>
+
+// bumpTest headers
+#include "../bumpTest/BaseTest.h"
+
+// Unix headers
+#include <errno.h>
+
+namespace bumpTest {
+
+/**
+ * This is our main atomic file writer testing class. The SetUp and TearDown methods are
+ * executed before the test runs and after it completes. This is where we can
+ * add any custom set up for each test without having to add this to "every"
+ * test individually.
+ */
+class AtomicFileWriterTest : public BaseTest
+{
+protected:
+
+	/** Run immediately before a test starts. Starts the timer. */
+	void SetUp()
+	{
+		// Call the parent setup method
+		BaseTest::SetUp();
+
+		// Create the following directory structure
+		// - unittest
+		//     |- output.txt
+		bump::FileSystem::createDirectory("unittest");
+		std::ofstream stream("unittest/output.txt");
+		stream << "old contents";
+		stream.close();
+	}
+
+	/** Invoked immediately after a test finishes. Stops the timer. */
+	void TearDown()
+	{
+		// Call the parent tear down method
+		BaseTest::TearDown();
+
+		// Remove the entire directory structure that was built
+		bump::FileSystem::removeDirectoryAndContents("unittest");
+	}
+
+	/** Returns the entire contents of the file. */
+	std::string readContents(const bump::String& path)
+	{
+		std::ifstream stream(path.c_str(), std::ios::binary);
+		return std::string((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+	}
+};
+
+TEST_F(AtomicFileWriterTest, testWriteAndCommit)
+{
+	// Use a tiny buffer so the writes are gathered, flushed and written straight through
+	bump::AtomicFileWriter writer(8);
+	EXPECT_FALSE(writer.isOpen());
+	ASSERT_TRUE(writer.open("unittest/new.txt"));
+	EXPECT_TRUE(writer.isOpen());
+	EXPECT_STREQ("unittest/new.txt", writer.path().c_str());
+	EXPECT_TRUE(writer.write("abc"));
+	EXPECT_TRUE(writer.write("defg"));
+	EXPECT_TRUE(writer.write("hij"));
+	EXPECT_TRUE(writer.write("a much longer piece than the buffer"));
+	EXPECT_TRUE(writer.write(""));
+	EXPECT_TRUE(writer.write(bump::String("!")));
+
+	// Nothing shows up at the destination until the writer is committed
+	EXPECT_FALSE(bump::FileSystem::exists("unittest/new.txt"));
+	EXPECT_EQ(2, bump::FileSystem::directoryList("unittest").size());
+
+	EXPECT_TRUE(writer.commit());
+	EXPECT_FALSE(writer.isOpen());
+	EXPECT_EQ(0, writer.errorCode());
+	EXPECT_EQ("abcdefghija much longer piece than the buffer!", readContents("unittest/new.txt"));
+	EXPECT_EQ(2, bump::FileSystem::directoryList("unittest").size());
+
+	// Replace the file without synchronizing
+	ASSERT_TRUE(writer.open("unittest/new.txt", bump::AtomicFileWriter::NO_SYNC));
+	EXPECT_TRUE(writer.write("replaced"));
+	EXPECT_TRUE(writer.commit());
+	EXPECT_EQ("replaced", readContents("unittest/new.txt"));
+}
+
+TEST_F(AtomicFileWriterTest, testDiscard)
+{
+	// An explicit discard leaves the destination alone
+	bump::AtomicFileWriter writer;
+	ASSERT_TRUE(writer.open("unittest/output.txt"));
+	EXPECT_TRUE(writer.write("new contents"));
+	writer.discard();
+	EXPECT_FALSE(writer.isOpen());
+	EXPECT_FALSE(writer.write("more"));
+	EXPECT_EQ("old contents", readContents("unittest/output.txt"));
+	EXPECT_EQ(1, bump::FileSystem::directoryList("unittest").size());
+
+	// So does destroying a writer that was never committed
+	{
+		bump::AtomicFileWriter scoped_writer;
+		ASSERT_TRUE(scoped_writer.open("unittest/output.txt"));
+		EXPECT_TRUE(scoped_writer.write("new contents"));
+	}
+	EXPECT_EQ("old contents", readContents("unittest/output.txt"));
+	EXPECT_EQ(1, bump::FileSystem::directoryList("unittest").size());
+}
+
+TEST_F(AtomicFileWriterTest, testPermissions)
+{
+	bump::FileSystem::Permissions permissions = bump::FileSystem::OWNER_READ | bump::FileSystem::OWNER_WRITE | bump::FileSystem::GROUP_READ;
+	ASSERT_TRUE(bump::FileSystem::setPermissions("unittest/output.txt", permissions));
+
+	// Replacing a file keeps its permissions
+	bump::AtomicFileWriter writer;
+	ASSERT_TRUE(writer.open("unittest/output.txt"));
+	EXPECT_TRUE(writer.write("new contents"));
+	EXPECT_TRUE(writer.commit());
+	EXPECT_TRUE(writer.destinationReplaced());
+	EXPECT_EQ("new contents", readContents("unittest/output.txt"));
+	EXPECT_EQ(permissions, bump::FileSystem::permissions("unittest/output.txt"));
+}
+
+TEST_F(AtomicFileWriterTest, testErrors)
+{
+	// A writer that was never opened
+	bump::AtomicFileWriter writer;
+	EXPECT_FALSE(writer.write("data"));
+	EXPECT_FALSE(writer.commit());
+	EXPECT_EQ(EBADF, writer.errorCode());
+	EXPECT_FALSE(writer.destinationReplaced());
+
+	// A directory that does not exist
+	EXPECT_FALSE(writer.open("unittest/does not exist/new.txt"));
+	EXPECT_EQ(ENOENT, writer.errorCode());
+	EXPECT_FALSE(writer.isOpen());
+
+	// A path without a filename
+	EXPECT_FALSE(writer.open("/"));
+	EXPECT_EQ(EISDIR, writer.errorCode());
+
+	// A directory in the way of the rename
+	EXPECT_TRUE(bump::FileSystem::createDirectory("unittest/directory"));
+	EXPECT_TRUE(bump::FileSystem::createFile("unittest/directory/file.txt"));
+	ASSERT_TRUE(writer.open("unittest/directory"));
+	EXPECT_TRUE(writer.write("data"));
+	EXPECT_FALSE(writer.commit());
+	EXPECT_NE(0, writer.errorCode());
+	EXPECT_FALSE(writer.destinationReplaced());
+	EXPECT_TRUE(bump::FileSystem::isFile("unittest/directory/file.txt"));
+	EXPECT_EQ(2, bump::FileSystem::directoryList("unittest").size());
+}
+
+}	// End of bumpTest namespace
@@ -9,10 +9,17 @@
 // Bump headers
 #include <bump/Environment.h>
 #include <bump/CryptographicHash.h>
+#include <bump/FileSystem.h>
+
+// C++ headers
+#include <fstream>
 
 // bumpTest headers
 #include "../bumpTest/BaseTest.h"
 
+// Unix headers
+#include <errno.h>
+
 namespace bumpTest {
 
 /**
@@ -107,6 +114,22 @@ TEST_F(CryptographicHashTest, testSetDataCharStar)
 	EXPECT_STREQ("", result.c_str());
 }
 
+TEST_F(CryptographicHashTest, testSetDataStringView)
+{
+	// Normal case
+	bump::CryptographicHash hash;
+	bump::String data = "This is a simple string that I'm going to hash, with some trailing text";
+	hash.setData(bump::StringView(data).left(46));
+	bump::String result = hash.result();
+	EXPECT_STREQ("364fd3e0c0c454cb0c0fb393ede75f7f66b28eb6", result.c_str());
+
+	// Empty case
+	hash = bump::CryptographicHash();
+	hash.setData(bump::StringView());
+	result = hash.result();
+	EXPECT_STREQ("", result.c_str());
+}
+
 TEST_F(CryptographicHashTest, testReset)
 {
 	// Normal case #1
@@ -184,4 +207,34 @@ TEST_F(CryptographicHashTest, testResult)
 	EXPECT_STREQ("bc1ed3c73cb98a7c3742a0f41e6e703f4472f679", result.c_str());
 }
 
+TEST_F(CryptographicHashTest, testFileResult)
+{
+	bump::FileSystem::createDirectory("unittest");
+	std::ofstream("unittest/simple.txt") << "This is a simple string that I'm going to hash";
+	std::ofstream("unittest/empty.txt");
+
+	// Normal case
+	bump::CryptographicHash hash;
+	EXPECT_STREQ("364fd3e0c0c454cb0c0fb393ede75f7f66b28eb6", hash.fileResult("unittest/simple.txt").c_str());
+
+	// Files spanning several read ahead buffers hash the same as all their data at once
+	std::string data;
+	for (unsigned int i = 0; i < 3 * 1024 * 1024 + 1000; ++i)
+	{
+		data.push_back((char)(i % 251));
+	}
+	std::ofstream stream("unittest/large.bin", std::ios::binary);
+	stream.write(data.data(), data.size());
+	stream.close();
+	hash.setData(data.data(), data.size());
+	EXPECT_STREQ(hash.result().c_str(), hash.fileResult("unittest/large.bin").c_str());
+
+	// Empty and missing files
+	EXPECT_STREQ("", hash.fileResult("unittest/empty.txt").c_str());
+	EXPECT_STREQ("", hash.fileResult("unittest/does not exist.txt").c_str());
+	EXPECT_EQ(ENOENT, errno);
+
+	bump::FileSystem::removeDirectoryAndContents("unittest");
+}
+
 }	// End of bumpTest namespace
@@ -0,0 +1,163 @@
+//
+//	DecompressingReaderTest.cpp
+//	Bump
+//
+//	Created by Joseph Holub on 10/18/26.
+//	Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+// Bump headers
+#include <bump/DecompressingReader.h>
+#include <bump/FileSystem.h>
+
+// C++ headers
+#include <fstream>
+
+// bumpTest headers
+#include "../bumpTest/BaseTest.h"
+
+// Unix headers
+#include <errno.h>
+
+namespace bumpTest {
+
+// "first\r\nsecond\n\nfourth\nfifth\n" and "sixth\nlast" compressed with gzip
+static const char FIRST_MEMBER[] =
+	"\x1f\x8b\x08\x00\x00\x00\x00\x00\x02\x03\x4b\xcb\x2c\x2a\x2e\xe1\xe5\x2a\x4e\x4d\xce\xcf"
+	"\x4b\xe1\xe2\x4a\xcb\x2f\x2d\x2a\xc9\xe0\x4a\xcb\x4c\x03\x92\x00\x90\xff\x1d\x11\x1c\x00\x00\x00";
+static const char SECOND_MEMBER[] =
+	"\x1f\x8b\x08\x00\x00\x00\x00\x00\x02\x03\x2b\xce\xac\x28\xc9\xe0\xca\x49\x2c\x2e\x01\x00"
+	"\x25\xfc\x2e\xac\x0a\x00\x00\x00";
+
+/**
+ * This is our main decompressing reader testing class. The SetUp and TearDown methods are
+ * executed before the test runs and after it completes. This is where we can
+ * add any custom set up for each test without having to add this to "every"
+ * test individually.
+ */
+class DecompressingReaderTest : public BaseTest
+{
+protected:
+
+	/** Run immediately before a test starts. Starts the timer. */
+	void SetUp()
+	{
+		// Call the parent setup method
+		BaseTest::SetUp();
+
+		// Create the following directory structure
+		// - unittest
+		//     |- appended.gz
+		//     |- plain.txt
+		bump::FileSystem::createDirectory("unittest");
+		std::ofstream stream("unittest/appended.gz", std::ios::binary);
+		stream.write(FIRST_MEMBER, sizeof(FIRST_MEMBER) - 1);
+		stream.write(SECOND_MEMBER, sizeof(SECOND_MEMBER) - 1);
+		stream.close();
+		writeFile("unittest/plain.txt", "\x1f not compressed");
+	}
+
+	/** Invoked immediately after a test finishes. Stops the timer. */
+	void TearDown()
+	{
+		// Call the parent tear down method
+		BaseTest::TearDown();
+
+		// Remove the entire directory structure that was built
+		bump::FileSystem::removeDirectoryAndContents("unittest");
+	}
+
+	/** Writes the contents to a file in the unittest directory. */
+	void writeFile(const bump::String& path, const std::string& contents)
+	{
+		std::ofstream stream(path.c_str(), std::ios::binary);
+		stream << contents;
+	}
+
+	/** Reads the rest of the decompressed contents a few bytes at a time, returning the result of the last read. */
+	long readAll(bump::DecompressingReader& reader, std::string& contents)
+	{
+		char buffer[5];
+		long bytes_read = 0;
+		while ((bytes_read = reader.read(buffer, sizeof(buffer))) > 0)
+		{
+			contents.append(buffer, bytes_read);
+		}
+
+		return bytes_read;
+	}
+};
+
+TEST_F(DecompressingReaderTest, testDetectFormat)
+{
+	EXPECT_EQ(bump::DecompressingReader::GZIP_FORMAT, bump::DecompressingReader::detectFormatFromBytes(bump::StringView("\x1f\x8b", 2)));
+	EXPECT_EQ(bump::DecompressingReader::ZSTD_FORMAT, bump::DecompressingReader::detectFormatFromBytes(bump::StringView("\x28\xb5\x2f\xfd\x00", 5)));
+	EXPECT_EQ(bump::DecompressingReader::UNCOMPRESSED, bump::DecompressingReader::detectFormatFromBytes(bump::StringView("\x28\xb5\x2f", 3)));
+	EXPECT_EQ(bump::DecompressingReader::UNCOMPRESSED, bump::DecompressingReader::detectFormatFromBytes(bump::StringView()));
+
+	EXPECT_EQ(bump::DecompressingReader::GZIP_FORMAT, bump::DecompressingReader::detectFormat("unittest/appended.gz"));
+	EXPECT_EQ(bump::DecompressingReader::UNCOMPRESSED, bump::DecompressingReader::detectFormat("unittest/plain.txt"));
+	EXPECT_EQ(bump::DecompressingReader::UNCOMPRESSED, bump::DecompressingReader::detectFormat("unittest/does not exist.gz"));
+	EXPECT_FALSE(bump::DecompressingReader::isFormatSupported(bump::DecompressingReader::UNCOMPRESSED));
+
+	// Only compressed files can be opened
+	bump::DecompressingReader reader;
+	EXPECT_FALSE(reader.open("unittest/plain.txt"));
+	EXPECT_EQ(EINVAL, errno);
+	EXPECT_FALSE(reader.open("unittest/does not exist.gz"));
+	EXPECT_EQ(ENOENT, errno);
+	EXPECT_FALSE(reader.isOpen());
+	char buffer[1];
+	EXPECT_EQ(-1, reader.read(buffer, sizeof(buffer)));
+
+	// Formats left out of the build are refused
+	writeFile("unittest/frame.zst", std::string("\x28\xb5\x2f\xfd\x00\x00", 6));
+	if (!bump::DecompressingReader::isFormatSupported(bump::DecompressingReader::ZSTD_FORMAT))
+	{
+		EXPECT_FALSE(reader.open("unittest/frame.zst"));
+		EXPECT_EQ(ENOTSUP, errno);
+	}
+}
+
+TEST_F(DecompressingReaderTest, testReadGzip)
+{
+	bump::DecompressingReader reader(7, 2);
+	if (!bump::DecompressingReader::isFormatSupported(bump::DecompressingReader::GZIP_FORMAT))
+	{
+		EXPECT_FALSE(reader.open("unittest/appended.gz"));
+		EXPECT_EQ(ENOTSUP, errno);
+		return;
+	}
+
+	// Small blocks and reads straddle each other, and the appended member continues the stream
+	ASSERT_TRUE(reader.open("unittest/appended.gz"));
+	EXPECT_TRUE(reader.isOpen());
+	EXPECT_EQ(bump::DecompressingReader::GZIP_FORMAT, reader.format());
+	std::string contents;
+	EXPECT_EQ(0, readAll(reader, contents));
+	EXPECT_STREQ("first\r\nsecond\n\nfourth\nfifth\nsixth\nlast", contents.c_str());
+	EXPECT_EQ(0, readAll(reader, contents));
+
+	// Closing while the decompressing thread waits for room in the queue stops it
+	ASSERT_TRUE(reader.open("unittest/appended.gz"));
+	char buffer[3];
+	EXPECT_EQ(3, reader.read(buffer, sizeof(buffer)));
+	reader.close();
+	EXPECT_FALSE(reader.isOpen());
+	EXPECT_EQ(bump::DecompressingReader::UNCOMPRESSED, reader.format());
+
+	// Truncated and corrupt data fail after whatever could be decompressed
+	writeFile("unittest/truncated.gz", std::string(FIRST_MEMBER, 30));
+	ASSERT_TRUE(reader.open("unittest/truncated.gz"));
+	contents.clear();
+	EXPECT_EQ(-1, readAll(reader, contents));
+	EXPECT_EQ(EILSEQ, errno);
+	EXPECT_EQ(0, std::string("first\r\nsecond\n\nfourth\nfifth\n").find(contents));
+
+	writeFile("unittest/corrupt.gz", std::string(FIRST_MEMBER, 10) + "\xff\xff\xff\xff");
+	ASSERT_TRUE(reader.open("unittest/corrupt.gz"));
+	EXPECT_EQ(-1, readAll(reader, contents));
+	EXPECT_EQ(EILSEQ, errno);
+}
+
+}	// End of bumpTest namespace
@@ -0,0 +1,180 @@
+//
+//	DelimitedReaderTest.cpp
+//	Bump
+//
+//	Created by Joseph Holub on 10/18/26.
+//	Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+// Bump headers
+#include <bump/DelimitedReader.h>
+#include <bump/FileSystem.h>
+
+// C++ headers
+#include <fstream>
+
+// bumpTest headers
+#include "../bumpTest/BaseTest.h"
+
+// Unix headers
+#include <errno.h>
+
+namespace bumpTest {
+
+/**
+ * This is our main delimited reader testing class. The SetUp and TearDown methods are
+ * executed before the test runs and after it completes. This is where we can
+ * add any custom set up for each test without having to add this to "every"
+ * test individually.
+ */
+class DelimitedReaderTest : public BaseTest
+{
+protected:
+
+	/** Run immediately before a test starts. Starts the timer. */
+	void SetUp()
+	{
+		// Call the parent setup method
+		BaseTest::SetUp();
+
+		// Create the following directory structure
+		// - unittest
+		bump::FileSystem::createDirectory("unittest");
+	}
+
+	/** Invoked immediately after a test finishes. Stops the timer. */
+	void TearDown()
+	{
+		// Call the parent tear down method
+		BaseTest::TearDown();
+
+		// Remove the entire directory structure that was built
+		bump::FileSystem::removeDirectoryAndContents("unittest");
+	}
+
+	/** Writes the contents to a file in the unittest directory. */
+	void writeFile(const bump::String& path, const std::string& contents)
+	{
+		std::ofstream stream(path.c_str(), std::ios::binary);
+		stream << contents;
+	}
+};
+
+TEST_F(DelimitedReaderTest, testPlainRecords)
+{
+	writeFile("unittest/prices.csv", "name,price,count\r\napple,1.25,3\n\nbanana,0.5,-12\npear,,x\n");
+
+	bump::DelimitedReader reader;
+	EXPECT_FALSE(reader.isOpen());
+	EXPECT_FALSE(reader.readRecord());
+	ASSERT_TRUE(reader.open("unittest/prices.csv"));
+	ASSERT_TRUE(reader.readHeader());
+	ASSERT_EQ(3, reader.columnNames().size());
+	EXPECT_STREQ("count", reader.columnNames()[2].c_str());
+	EXPECT_EQ(1, reader.columnIndex("price"));
+	EXPECT_EQ(-1, reader.columnIndex("weight"));
+	EXPECT_EQ(0, reader.recordNumber());
+
+	ASSERT_TRUE(reader.readRecord());
+	EXPECT_EQ(1, reader.recordNumber());
+	ASSERT_EQ(3, reader.numberOfFields());
+	EXPECT_TRUE(reader.field(0) == "apple");
+	double price = 0.0;
+	long long count = 0;
+	EXPECT_TRUE(reader.toDouble(1, price));
+	EXPECT_DOUBLE_EQ(1.25, price);
+	EXPECT_TRUE(reader.toLongLong(2, count));
+	EXPECT_EQ(3, count);
+
+	// Empty lines are skipped
+	ASSERT_TRUE(reader.readRecord());
+	EXPECT_EQ(2, reader.recordNumber());
+	EXPECT_EQ(4, reader.lineNumber());
+	EXPECT_TRUE(reader.toLongLong(2, count));
+	EXPECT_EQ(-12, count);
+
+	// Empty, malformed and missing fields are refused by the typed accessors
+	ASSERT_TRUE(reader.readRecord());
+	EXPECT_TRUE(reader.field(1).isEmpty());
+	EXPECT_FALSE(reader.toDouble(1, price));
+	EXPECT_FALSE(reader.toLongLong(2, count));
+	EXPECT_FALSE(reader.toLongLong(3, count));
+	EXPECT_FALSE(reader.toLongLong(-1, count));
+	EXPECT_TRUE(reader.field(3).isEmpty());
+
+	EXPECT_FALSE(reader.readRecord());
+	EXPECT_EQ(0, reader.errorCode());
+
+	// Missing files are refused
+	EXPECT_FALSE(reader.open("unittest/does not exist.csv"));
+	EXPECT_EQ(ENOENT, errno);
+	EXPECT_TRUE(reader.columnNames().empty());
+}
+
+TEST_F(DelimitedReaderTest, testQuotedRecords)
+{
+	writeFile("unittest/quoted.csv",
+		"\"a,b\",\"say \"\"hi\"\"\",plain\n"
+		"\"two\nlines\",x\"y\"z,\"\"\n"
+		"last,\"unterminated\nquote");
+
+	bump::DelimitedReader reader;
+	ASSERT_TRUE(reader.open("unittest/quoted.csv"));
+
+	// Delimiters and doubled quotes inside quotes are part of the field
+	ASSERT_TRUE(reader.readRecord());
+	ASSERT_EQ(3, reader.numberOfFields());
+	EXPECT_TRUE(reader.field(0) == "a,b");
+	EXPECT_TRUE(reader.field(1) == "say \"hi\"");
+	EXPECT_TRUE(reader.field(2) == "plain");
+
+	// Quoted newlines continue the record, and quotes are only special at the start of a field
+	ASSERT_TRUE(reader.readRecord());
+	ASSERT_EQ(3, reader.numberOfFields());
+	EXPECT_TRUE(reader.field(0) == "two\nlines");
+	EXPECT_TRUE(reader.field(1) == "x\"y\"z");
+	EXPECT_TRUE(reader.field(2).isEmpty());
+	EXPECT_EQ(3, reader.lineNumber());
+
+	// An unterminated quote ends with the file
+	ASSERT_TRUE(reader.readRecord());
+	ASSERT_EQ(2, reader.numberOfFields());
+	EXPECT_TRUE(reader.field(1) == "unterminated\nquote");
+	EXPECT_FALSE(reader.readRecord());
+	EXPECT_EQ(3, reader.recordNumber());
+}
+
+TEST_F(DelimitedReaderTest, testFormats)
+{
+	writeFile("unittest/escaped.tsv", "a\\tb\t\"quoted\"\tc\\\\d\nline\\\ncontinued\t\n\n");
+
+	// Tabs with a backslash escape and no quoting
+	bump::DelimitedFormat format('\t');
+	format.quote = '\0';
+	format.escape = '\\';
+	format.skipEmptyLines = false;
+	bump::DelimitedReader reader(format, 4);
+	EXPECT_EQ('\t', reader.format().delimiter);
+	ASSERT_TRUE(reader.open("unittest/escaped.tsv"));
+
+	ASSERT_TRUE(reader.readRecord());
+	ASSERT_EQ(3, reader.numberOfFields());
+	EXPECT_TRUE(reader.field(0) == "atb");
+	EXPECT_TRUE(reader.field(1) == "\"quoted\"");
+	EXPECT_TRUE(reader.field(2) == "c\\d");
+
+	// An escaped newline continues the record
+	ASSERT_TRUE(reader.readRecord());
+	ASSERT_EQ(2, reader.numberOfFields());
+	EXPECT_TRUE(reader.field(0) == "line\ncontinued");
+	EXPECT_TRUE(reader.field(1).isEmpty());
+
+	// Empty lines are kept as a record with one empty field
+	ASSERT_TRUE(reader.readRecord());
+	ASSERT_EQ(1, reader.numberOfFields());
+	EXPECT_TRUE(reader.field(0).isEmpty());
+	EXPECT_FALSE(reader.readRecord());
+	EXPECT_EQ(3, reader.recordNumber());
+}
+
+}	// End of bumpTest namespace
@@ -0,0 +1,180 @@
+//
+//	DirectoryTest.cpp
+//	Bump
+//
+//	Created by Joseph Holub on 10/18/26.
+//	Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+// Bump headers
+#include <bump/Directory.h>
+#include <bump/FileSystem.h>
+
+// C++ headers
+#include <algorithm>
+#include <fstream>
+
+// bumpTest headers
+#include "../bumpTest/BaseTest.h"
+
+namespace bumpTest {
+
+/**
+ * This is our main directory testing class. The SetUp and TearDown methods are
+ * executed before the test runs and after it completes. This is where we can
+ * add any custom set up for each test without having to add this to "every"
+ * test individually.
+ */
+class DirectoryTest : public BaseTest
+{
+protected:
+
+	/** Run immediately before a test starts. Starts the timer. */
+	void SetUp()
+	{
+		// Call the parent setup method
+		BaseTest::SetUp();
+
+		// Create the following directory structure
+		// - unittest
+		//     |- files
+		//     |   |- output.txt
+		//     |- link -> files
+		bump::FileSystem::createDirectory("unittest");
+		bump::FileSystem::createDirectory("unittest/files");
+		std::ofstream stream("unittest/files/output.txt");
+		stream << "some output";
+		stream.close();
+		bump::FileSystem::createDirectorySymbolicLink("files", "unittest/link");
+	}
+
+	/** Invoked immediately after a test finishes. Stops the timer. */
+	void TearDown()
+	{
+		// Call the parent tear down method
+		BaseTest::TearDown();
+
+		// Remove the entire directory structure that was built
+		bump::FileSystem::removeDirectoryAndContents("unittest");
+	}
+};
+
+TEST_F(DirectoryTest, testOpen)
+{
+	// Test opening a directory by path
+	bump::Directory directory;
+	EXPECT_FALSE(directory.isOpen());
+	EXPECT_EQ(-1, directory.descriptor());
+	EXPECT_TRUE(directory.open("unittest"));
+	EXPECT_TRUE(directory.isOpen());
+	EXPECT_STREQ("unittest", directory.path().c_str());
+
+	// Test opening a child relative to its parent
+	bump::Directory files;
+	EXPECT_TRUE(files.open(directory, "files"));
+	EXPECT_STREQ("unittest/files", files.path().c_str());
+
+	// Test that symbolic links, files and missing names are refused
+	bump::Directory invalid;
+	EXPECT_FALSE(invalid.open(directory, "link"));
+	EXPECT_FALSE(invalid.open(files, "output.txt"));
+	EXPECT_FALSE(invalid.open("unittest/does not exist"));
+	EXPECT_FALSE(invalid.open(invalid, "files"));
+	EXPECT_FALSE(invalid.isOpen());
+
+	// Test closing the handle
+	directory.close();
+	EXPECT_FALSE(directory.isOpen());
+	EXPECT_TRUE(files.isOpen());
+}
+
+TEST_F(DirectoryTest, testCreateAndRemove)
+{
+	bump::Directory directory;
+	ASSERT_TRUE(directory.open("unittest"));
+
+	// Test creating and removing files
+	EXPECT_TRUE(directory.createFile("new_file.txt"));
+	EXPECT_TRUE(bump::FileSystem::isFile("unittest/new_file.txt"));
+	EXPECT_FALSE(directory.createFile("new_file.txt"));
+	EXPECT_TRUE(directory.removeFile("new_file.txt"));
+	EXPECT_FALSE(bump::FileSystem::exists("unittest/new_file.txt"));
+	EXPECT_FALSE(directory.removeFile("new_file.txt"));
+
+	// Test creating and removing directories
+	EXPECT_TRUE(directory.createDirectory("new_directory"));
+	EXPECT_TRUE(bump::FileSystem::isDirectory("unittest/new_directory"));
+	EXPECT_FALSE(directory.createDirectory("new_directory"));
+	EXPECT_FALSE(directory.removeFile("new_directory"));
+	EXPECT_TRUE(directory.removeDirectory("new_directory"));
+	EXPECT_FALSE(bump::FileSystem::exists("unittest/new_directory"));
+
+	// Test that a directory with contents is not removed and a symbolic link is removed on its own
+	EXPECT_FALSE(directory.removeDirectory("files"));
+	EXPECT_TRUE(directory.removeFile("link"));
+	EXPECT_TRUE(bump::FileSystem::isFile("unittest/files/output.txt"));
+}
+
+TEST_F(DirectoryTest, testRename)
+{
+	bump::Directory directory;
+	bump::Directory files;
+	ASSERT_TRUE(directory.open("unittest"));
+	ASSERT_TRUE(files.open(directory, "files"));
+
+	// Test renaming inside a directory
+	EXPECT_TRUE(files.rename("output.txt", "renamed.txt"));
+	EXPECT_TRUE(bump::FileSystem::isFile("unittest/files/renamed.txt"));
+	EXPECT_FALSE(files.rename("output.txt", "renamed.txt"));
+
+	// Test moving into another directory
+	EXPECT_TRUE(files.rename("renamed.txt", directory, "moved.txt"));
+	EXPECT_TRUE(bump::FileSystem::isFile("unittest/moved.txt"));
+
+	// Test that the handle keeps pointing at the directory after it is renamed
+	EXPECT_TRUE(directory.rename("files", "renamed_files"));
+	EXPECT_TRUE(files.createFile("created.txt"));
+	EXPECT_TRUE(bump::FileSystem::isFile("unittest/renamed_files/created.txt"));
+}
+
+TEST_F(DirectoryTest, testStatAndList)
+{
+	bump::Directory directory;
+	bump::Directory files;
+	ASSERT_TRUE(directory.open("unittest"));
+	ASSERT_TRUE(files.open(directory, "files"));
+
+	// Test the status of a file, a directory and a symbolic link
+	bump::Directory::Status status;
+	EXPECT_TRUE(files.stat("output.txt", status));
+	EXPECT_EQ(bump::FileSystem::FILE_ENTRY, status.type);
+	EXPECT_EQ(11, status.size);
+	EXPECT_TRUE(status.modifiedDate > 0);
+	EXPECT_TRUE(directory.stat("files", status));
+	EXPECT_EQ(bump::FileSystem::DIRECTORY_ENTRY, status.type);
+	EXPECT_TRUE(directory.stat("link", status));
+	EXPECT_EQ(bump::FileSystem::SYMBOLIC_LINK_ENTRY, status.type);
+	EXPECT_TRUE(directory.stat("link", status, true));
+	EXPECT_EQ(bump::FileSystem::DIRECTORY_ENTRY, status.type);
+	EXPECT_FALSE(directory.stat("does not exist", status));
+
+	// Test listing the contents with their types
+	bump::Directory::EntryList entries;
+	EXPECT_TRUE(directory.list(entries));
+	ASSERT_EQ(2, entries.size());
+	if (entries[0].name > entries[1].name)
+	{
+		std::swap(entries[0], entries[1]);
+	}
+	EXPECT_STREQ("files", entries[0].name.c_str());
+	EXPECT_EQ(bump::FileSystem::DIRECTORY_ENTRY, entries[0].type);
+	EXPECT_STREQ("link", entries[1].name.c_str());
+	EXPECT_EQ(bump::FileSystem::SYMBOLIC_LINK_ENTRY, entries[1].type);
+
+	// Test that listing twice gives the same entries
+	bump::Directory::EntryList again;
+	EXPECT_TRUE(directory.list(again));
+	EXPECT_EQ(2, again.size());
+}
+
+}	// End of bumpTest namespace
@@ -14,6 +14,10 @@
 // bumpTest headers
 #include "FileInfoTest.h"
 
+// Unix headers
+#include <errno.h>
+#include <sys/stat.h>
+
 namespace bumpTest {
 
 TEST_F(FileInfoTest, testFileSize)
@@ -663,4 +667,66 @@ TEST_F(FileInfoTest, testGroupId)
 	EXPECT_THROW(bump::FileInfo("unittest/not/valid").groupId(), bump::FileSystemError);
 }
 
+TEST_F(FileInfoTest, testStatusQueries)
+{
+	bump::FileSystemStatus status = bump::FILE_SYSTEM_FAILURE;
+
+	// Test file sizes through a symbolic link, on a directory and on a missing file
+	unsigned long long size = 0;
+	EXPECT_TRUE(bump::FileInfo("unittest/symlink_files/info.xml").fileSize(size, status));
+	EXPECT_EQ(bump::FILE_SYSTEM_SUCCESS, status);
+	EXPECT_EQ(121, size);
+	EXPECT_FALSE(bump::FileInfo("unittest/files").fileSize(size, status));
+	EXPECT_EQ(bump::PATH_NOT_FILE, status);
+	EXPECT_EQ(EISDIR, errno);
+	EXPECT_FALSE(bump::FileInfo("unittest/does/not/exist/output.txt").fileSize(size, status));
+	EXPECT_EQ(bump::PATH_NOT_FOUND, status);
+	EXPECT_EQ(ENOENT, errno);
+	EXPECT_FALSE(bump::FileInfo("unittest/files/output.txt/child").fileSize(size, status));
+	EXPECT_EQ(bump::PATH_NOT_DIRECTORY, status);
+	EXPECT_EQ(121, size);
+
+	// Test emptiness
+	bool empty = false;
+	EXPECT_TRUE(bump::FileInfo("unittest/empty_symlink").isEmpty(empty, status));
+	EXPECT_TRUE(empty);
+	EXPECT_TRUE(bump::FileInfo("unittest/files/info.xml").isEmpty(empty, status));
+	EXPECT_FALSE(empty);
+	EXPECT_FALSE(bump::FileInfo("unittest/not/valid").isEmpty(empty, status));
+	EXPECT_EQ(bump::PATH_NOT_FOUND, status);
+
+	// Test canonical paths and modified dates
+	bump::String path;
+	EXPECT_TRUE(bump::FileInfo("unittest/symlink_directory/../files").canonicalPath(path, status));
+	EXPECT_STREQ(bump::FileInfo("unittest/files").canonicalPath().c_str(), path.c_str());
+	EXPECT_FALSE(bump::FileInfo("unittest/not/valid").canonicalPath(path, status));
+	EXPECT_EQ(bump::PATH_NOT_FOUND, status);
+	std::time_t date = 0;
+	EXPECT_TRUE(bump::FileInfo("unittest/files/info.xml").modifiedDate(date, status));
+	EXPECT_EQ(bump::FileInfo("unittest/files/info.xml").modifiedDate(), date);
+	EXPECT_FALSE(bump::FileInfo("unittest/not/valid").modifiedDate(date, status));
+	EXPECT_EQ(bump::PATH_NOT_FOUND, status);
+
+	// Test owners and groups
+	bump::String name;
+	unsigned int id = 0;
+	struct stat info;
+	ASSERT_EQ(0, stat("unittest/files/output.txt", &info));
+	EXPECT_TRUE(bump::FileInfo("unittest/files/output.txt").owner(name, status));
+	EXPECT_STREQ(bump::Environment::currentUsername().c_str(), name.c_str());
+	EXPECT_TRUE(bump::FileInfo("unittest/files/output.txt").ownerId(id, status));
+	EXPECT_EQ(info.st_uid, id);
+	EXPECT_TRUE(bump::FileInfo("unittest/files/output.txt").group(name, status));
+	EXPECT_FALSE(name.isEmpty());
+	EXPECT_TRUE(bump::FileInfo("unittest/files/output.txt").groupId(id, status));
+	EXPECT_EQ(info.st_gid, id);
+	EXPECT_FALSE(bump::FileInfo("unittest/not/valid").owner(name, status));
+	EXPECT_EQ(bump::PATH_NOT_FOUND, status);
+	EXPECT_FALSE(bump::FileInfo("unittest/not/valid").ownerId(id, status));
+	EXPECT_FALSE(bump::FileInfo("unittest/not/valid").group(name, status));
+	EXPECT_FALSE(bump::FileInfo("unittest/not/valid").groupId(id, status));
+	EXPECT_EQ(bump::PATH_NOT_FOUND, status);
+	EXPECT_EQ(ENOENT, errno);
+}
+
 }	// End of bumpTest namespace
@@ -771,6 +771,55 @@ TEST_F(FileSystemTest, testDirectoryList)
 	EXPECT_STREQ("unittest/symlink_directory/paper.doc", symlink_dir_list.at(1).c_str());
 }
 
+TEST_F(FileSystemTest, testDirectoryListPattern)
+{
+	// Filter the unittest/files directory by extension and by name
+	bump::StringList text_list = bump::FileSystem::directoryList("unittest/files", bump::GlobPattern("*.txt"));
+	EXPECT_EQ(2, text_list.size());
+	EXPECT_STREQ("unittest/files/.hidden_file.txt", text_list.at(0).c_str());
+	EXPECT_STREQ("unittest/files/output.txt", text_list.at(1).c_str());
+	bump::StringList archive_list = bump::FileSystem::directoryList("unittest/files", bump::GlobPattern("[a-m]*.tar.?z"));
+	EXPECT_EQ(1, archive_list.size());
+	EXPECT_STREQ("unittest/files/archive.tar.gz", archive_list.at(0).c_str());
+
+	// Patterns that cannot match a single name match nothing
+	EXPECT_TRUE(bump::FileSystem::directoryList("unittest/files", bump::GlobPattern("*.doc")).empty());
+	EXPECT_TRUE(bump::FileSystem::directoryList("unittest", bump::GlobPattern("files/*")).empty());
+
+	// The same errors are thrown as for unfiltered lists
+	EXPECT_THROW(bump::FileSystem::directoryList("unittest/does_not_exist", bump::GlobPattern("*")), bump::FileSystemError);
+	EXPECT_THROW(bump::FileSystem::directoryList("unittest/files/output.txt", bump::GlobPattern("*")), bump::FileSystemError);
+}
+
+TEST_F(FileSystemTest, testDirectoryListStatus)
+{
+	// List directories without exceptions
+	bump::StringList paths;
+	bump::FileSystemStatus status = bump::FILE_SYSTEM_FAILURE;
+	EXPECT_TRUE(bump::FileSystem::directoryList("unittest/symlink_directory", paths, status));
+	EXPECT_EQ(bump::FILE_SYSTEM_SUCCESS, status);
+	ASSERT_EQ(2, paths.size());
+	EXPECT_STREQ("unittest/symlink_directory/help.pdf", paths.at(0).c_str());
+	EXPECT_STREQ("unittest/symlink_directory/paper.doc", paths.at(1).c_str());
+	EXPECT_TRUE(bump::FileSystem::directoryList("unittest/files", bump::GlobPattern("*.gz"), paths, status));
+	ASSERT_EQ(1, paths.size());
+	EXPECT_STREQ("unittest/files/archive.tar.gz", paths.at(0).c_str());
+	bump::FileInfoList infos;
+	EXPECT_TRUE(bump::FileSystem::directoryInfoList("unittest/files", infos, status));
+	ASSERT_EQ(3, infos.size());
+	EXPECT_STREQ("unittest/files/.hidden_file.txt", infos.at(0).path().c_str());
+
+	// Failures report a status and leave the results alone
+	EXPECT_FALSE(bump::FileSystem::directoryList("unittest/does_not_exist", paths, status));
+	EXPECT_EQ(bump::PATH_NOT_FOUND, status);
+	EXPECT_FALSE(bump::FileSystem::directoryList("unittest/files/output.txt", bump::GlobPattern("*"), paths, status));
+	EXPECT_EQ(bump::PATH_NOT_DIRECTORY, status);
+	EXPECT_FALSE(bump::FileSystem::directoryInfoList("unittest/files/output.txt", infos, status));
+	EXPECT_EQ(bump::PATH_NOT_DIRECTORY, status);
+	EXPECT_EQ(1, paths.size());
+	EXPECT_EQ(3, infos.size());
+}
+
 TEST_F(FileSystemTest, testDirectoryInfoList)
 {
 	// Create a couple empty directories
@@ -1382,6 +1431,16 @@ TEST_F(FileSystemTest, testModifiedDate)
 	EXPECT_TRUE(bump::FileSystem::setModifiedDate(path, time));
 	modified_date = modified_date = bump::FileSystem::modifiedDate(path);
 	EXPECT_EQ(time, modified_date);
+
+	// Query without exceptions
+	bump::FileSystemStatus status = bump::FILE_SYSTEM_FAILURE;
+	modified_date = 0;
+	EXPECT_TRUE(bump::FileSystem::modifiedDate(path, modified_date, status));
+	EXPECT_EQ(bump::FILE_SYSTEM_SUCCESS, status);
+	EXPECT_EQ(time, modified_date);
+	EXPECT_FALSE(bump::FileSystem::modifiedDate("unittest/does_not_exist", modified_date, status));
+	EXPECT_EQ(bump::PATH_NOT_FOUND, status);
+	EXPECT_EQ(time, modified_date);
 }
 
 }	// End of bumpTest namespace
@@ -6,15 +6,198 @@
 //	Copyright (c) 2012 Christian Noon. All rights reserved.
 //
 
+// Boost headers
+#include <boost/bind.hpp>
+#include <boost/thread.hpp>
+
 // Bump headers
+#include <bump/CryptographicHash.h>
 #include <bump/FileSystem.h>
 #include <bump/FileSystemError.h>
+#include <bump/InvalidArgumentError.h>
 
 // bumpTest headers
 #include "FileSystemTest.h"
 
+// C++ headers
+#include <fstream>
+
+// Unix headers
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 namespace bumpTest {
 
+/**
+ * Collects all the entries and errors reported by a walk.
+ */
+class WalkCollector
+{
+public:
+
+	void addEntries(const bump::FileSystem::WalkEntryList& entries)
+	{
+		++batches;
+		this->entries.insert(this->entries.end(), entries.begin(), entries.end());
+	}
+
+	void throwError(const bump::FileSystem::WalkEntryList& entries)
+	{
+		addEntries(entries);
+		throw bump::InvalidArgumentError("The visitor failed", BUMP_LOCATION);
+	}
+
+	void addError(const bump::String& path, int errorCode)
+	{
+		errorPaths.push_back(path);
+		errorCodes.push_back(errorCode);
+	}
+
+	unsigned int count(bump::FileSystem::EntryType type)
+	{
+		unsigned int count = 0;
+		for (unsigned int i = 0; i < entries.size(); ++i)
+		{
+			if (entries[i].type == type)
+			{
+				++count;
+			}
+		}
+		return count;
+	}
+
+	bool contains(const bump::String& path)
+	{
+		for (unsigned int i = 0; i < entries.size(); ++i)
+		{
+			if (entries[i].path == path)
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	unsigned int batches;
+	bump::FileSystem::WalkEntryList entries;
+	bump::StringList errorPaths;
+	std::vector<int> errorCodes;
+
+	WalkCollector() : batches(0) {}
+};
+
+/**
+ * Collects the progress and errors reported by a directory copy.
+ */
+class CopyCollector
+{
+public:
+
+	void updateProgress(const bump::FileSystem::CopyProgress& progress)
+	{
+		++updates;
+		latest = progress;
+	}
+
+	void addError(const bump::String& path, int errorCode)
+	{
+		errorPaths.push_back(path);
+		errorCodes.push_back(errorCode);
+	}
+
+	unsigned int updates;
+	bump::FileSystem::CopyProgress latest;
+	bump::StringList errorPaths;
+	std::vector<int> errorCodes;
+
+	CopyCollector() : updates(0) {}
+};
+
+/**
+ * Collects the progress and errors reported by a directory removal, which may come from a background thread.
+ */
+class RemoveCollector
+{
+public:
+
+	void updateProgress(const bump::FileSystem::RemoveProgress& progress)
+	{
+		boost::mutex::scoped_lock lock(mutex);
+		++updates;
+		latest = progress;
+	}
+
+	void addError(const bump::String& path, int errorCode)
+	{
+		boost::mutex::scoped_lock lock(mutex);
+		errorPaths.push_back(path);
+		errorCodes.push_back(errorCode);
+	}
+
+	void finish(bool removed)
+	{
+		boost::mutex::scoped_lock lock(mutex);
+		++completions;
+		this->removed = removed;
+	}
+
+	unsigned long long directoriesRemoved()
+	{
+		boost::mutex::scoped_lock lock(mutex);
+		return latest.directoriesRemoved;
+	}
+
+	unsigned int finished()
+	{
+		boost::mutex::scoped_lock lock(mutex);
+		return completions;
+	}
+
+	boost::mutex mutex;
+	unsigned int updates;
+	unsigned int completions;
+	bool removed;
+	bump::FileSystem::RemoveProgress latest;
+	bump::StringList errorPaths;
+	std::vector<int> errorCodes;
+
+	RemoveCollector() : updates(0), completions(0), removed(false) {}
+};
+
+/**
+ * Records the progress of a single file copy and cancels it after a number of updates.
+ */
+class FileCopyCollector
+{
+public:
+
+	bool updateProgress(unsigned long long bytesCopied, unsigned long long totalBytes)
+	{
+		++updates;
+		this->bytesCopied = bytesCopied;
+		this->totalBytes = totalBytes;
+		return updates < cancelAfter;
+	}
+
+	unsigned int updates;
+	unsigned int cancelAfter;
+	unsigned long long bytesCopied;
+	unsigned long long totalBytes;
+
+	FileCopyCollector(unsigned int cancelAfter = 1000) : updates(0), cancelAfter(cancelAfter), bytesCopied(0), totalBytes(0) {}
+};
+
+/**
+ * Returns the entire contents of the file.
+ */
+static std::string readContents(const bump::String& path)
+{
+	std::ifstream stream(path.c_str(), std::ios::binary);
+	return std::string((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+}
+
 TEST_F(FileSystemTest, testSetPermissions)
 {
 	// Set permissions on a valid file
@@ -93,6 +276,13 @@ TEST_F(FileSystemTest, testPermissions)
 
 	// Get the permissions on an invalid file
 	EXPECT_THROW(bump::FileSystem::permissions("unittest/files/not_valid.txt"), bump::FileSystemError);
+	bump::FileSystemStatus status = bump::FILE_SYSTEM_FAILURE;
+	EXPECT_TRUE(bump::FileSystem::permissions("unittest/files", permissions, status));
+	EXPECT_EQ(bump::FILE_SYSTEM_SUCCESS, status);
+	EXPECT_TRUE((permissions & bump::FileSystem::OTHERS_EXE) != 0);
+	EXPECT_FALSE(bump::FileSystem::permissions("unittest/files/not_valid.txt", permissions, status));
+	EXPECT_EQ(bump::PATH_NOT_FOUND, status);
+	EXPECT_EQ(ENOENT, errno);
 
 	// Set permissions on an invalid directory
 	EXPECT_THROW(bump::FileSystem::permissions("unittest/not valid"), bump::FileSystemError);
@@ -359,4 +549,761 @@ TEST_F(FileSystemTest, testSetIsExecutableByOthers)
 	EXPECT_FALSE(bump::FileSystem::setIsExecutableByOthers(path, true));
 }
 
+TEST_F(FileSystemTest, testWalk)
+{
+	// Walk the entire tree without following symbolic links
+	WalkCollector collector;
+	EXPECT_TRUE(bump::FileSystem::walk(_unittestDirectory, boost::bind(&WalkCollector::addEntries, &collector, _1)));
+	EXPECT_EQ(12, collector.entries.size());
+	EXPECT_EQ(5, collector.count(bump::FileSystem::FILE_ENTRY));
+	EXPECT_EQ(3, collector.count(bump::FileSystem::DIRECTORY_ENTRY));
+	EXPECT_EQ(4, collector.count(bump::FileSystem::SYMBOLIC_LINK_ENTRY));
+	EXPECT_TRUE(collector.contains("unittest/files/output.txt"));
+	EXPECT_TRUE(collector.contains("unittest/regular_directory/help.pdf"));
+	EXPECT_TRUE(collector.contains("unittest/symlink_directory"));
+	EXPECT_FALSE(collector.contains("unittest/symlink_directory/help.pdf"));
+
+	// Check the depths
+	for (unsigned int i = 0; i < collector.entries.size(); ++i)
+	{
+		unsigned int expected_depth = collector.entries[i].path.count("/");
+		EXPECT_EQ(expected_depth, collector.entries[i].depth);
+	}
+
+	// Walk with a trailing slash and a single thread
+	WalkCollector single_collector;
+	bump::FileSystem::WalkOptions options;
+	options.numberOfThreads = 1;
+	EXPECT_TRUE(bump::FileSystem::walk("unittest/", boost::bind(&WalkCollector::addEntries, &single_collector, _1), options));
+	EXPECT_EQ(12, single_collector.entries.size());
+	EXPECT_TRUE(single_collector.contains("unittest/files"));
+}
+
+TEST_F(FileSystemTest, testWalkFilters)
+{
+	// Only report files
+	WalkCollector file_collector;
+	bump::FileSystem::WalkOptions options;
+	options.entryTypes = bump::FileSystem::FILE_ENTRY;
+	EXPECT_TRUE(bump::FileSystem::walk(_unittestDirectory, boost::bind(&WalkCollector::addEntries, &file_collector, _1), options));
+	EXPECT_EQ(5, file_collector.entries.size());
+
+	// Only report text files
+	WalkCollector pattern_collector;
+	options = bump::FileSystem::WalkOptions();
+	options.pattern = "*.txt";
+	EXPECT_TRUE(bump::FileSystem::walk(_unittestDirectory, boost::bind(&WalkCollector::addEntries, &pattern_collector, _1), options));
+	EXPECT_EQ(4, pattern_collector.entries.size());
+	EXPECT_TRUE(pattern_collector.contains("unittest/files/.hidden_file.txt"));
+	EXPECT_TRUE(pattern_collector.contains("unittest/symlink_files/output.txt"));
+
+	// Only report the direct children
+	WalkCollector depth_collector;
+	options = bump::FileSystem::WalkOptions();
+	options.maximumDepth = 1;
+	EXPECT_TRUE(bump::FileSystem::walk(_unittestDirectory, boost::bind(&WalkCollector::addEntries, &depth_collector, _1), options));
+	EXPECT_EQ(4, depth_collector.entries.size());
+	options.maximumDepth = 0;
+	WalkCollector zero_depth_collector;
+	EXPECT_TRUE(bump::FileSystem::walk(_unittestDirectory, boost::bind(&WalkCollector::addEntries, &zero_depth_collector, _1), options));
+	EXPECT_TRUE(zero_depth_collector.entries.empty());
+
+	// Deliver the entries in small batches
+	WalkCollector batch_collector;
+	options = bump::FileSystem::WalkOptions();
+	options.batchSize = 1;
+	EXPECT_TRUE(bump::FileSystem::walk(_unittestDirectory, boost::bind(&WalkCollector::addEntries, &batch_collector, _1), options));
+	EXPECT_EQ(12, batch_collector.entries.size());
+	EXPECT_EQ(12, batch_collector.batches);
+}
+
+TEST_F(FileSystemTest, testWalkSymbolicLinkPolicy)
+{
+	// Skip the symbolic links entirely
+	WalkCollector skip_collector;
+	bump::FileSystem::WalkOptions options;
+	options.symbolicLinkPolicy = bump::FileSystem::SKIP_SYMBOLIC_LINKS;
+	EXPECT_TRUE(bump::FileSystem::walk(_unittestDirectory, boost::bind(&WalkCollector::addEntries, &skip_collector, _1), options));
+	EXPECT_EQ(8, skip_collector.entries.size());
+	EXPECT_EQ(0, skip_collector.count(bump::FileSystem::SYMBOLIC_LINK_ENTRY));
+
+	// Follow the symbolic links, the linked directory should only be descended into once
+	WalkCollector follow_collector;
+	options.symbolicLinkPolicy = bump::FileSystem::FOLLOW_SYMBOLIC_LINKS;
+	EXPECT_TRUE(bump::FileSystem::walk(_unittestDirectory, boost::bind(&WalkCollector::addEntries, &follow_collector, _1), options));
+	EXPECT_EQ(12, follow_collector.entries.size());
+	EXPECT_EQ(8, follow_collector.count(bump::FileSystem::FILE_ENTRY));
+	EXPECT_EQ(4, follow_collector.count(bump::FileSystem::DIRECTORY_ENTRY));
+	EXPECT_EQ(0, follow_collector.count(bump::FileSystem::SYMBOLIC_LINK_ENTRY));
+
+	// Follow a symbolic link pointing back up the tree without looping forever
+	EXPECT_TRUE(bump::FileSystem::createDirectorySymbolicLink("..", "unittest/regular_directory/parent"));
+	WalkCollector cycle_collector;
+	EXPECT_TRUE(bump::FileSystem::walk(_unittestDirectory, boost::bind(&WalkCollector::addEntries, &cycle_collector, _1), options));
+	EXPECT_EQ(13, cycle_collector.entries.size());
+}
+
+TEST_F(FileSystemTest, testWalkErrors)
+{
+	// Walk a directory that does not exist
+	WalkCollector collector;
+	bump::FileSystem::WalkOptions options;
+	options.errorCallback = boost::bind(&WalkCollector::addError, &collector, _1, _2);
+	EXPECT_FALSE(bump::FileSystem::walk("unittest/does not exist", boost::bind(&WalkCollector::addEntries, &collector, _1), options));
+	ASSERT_EQ(1, collector.errorCodes.size());
+	EXPECT_EQ(ENOENT, collector.errorCodes[0]);
+	EXPECT_STREQ("unittest/does not exist", collector.errorPaths[0].c_str());
+
+	// Walk a file
+	EXPECT_FALSE(bump::FileSystem::walk("unittest/files/output.txt", boost::bind(&WalkCollector::addEntries, &collector, _1), options));
+	ASSERT_EQ(2, collector.errorCodes.size());
+	EXPECT_EQ(ENOTDIR, collector.errorCodes[1]);
+	EXPECT_TRUE(collector.entries.empty());
+
+	// Fail the walk when the visitor throws, but keep delivering the remaining batches
+	WalkCollector throwing_collector;
+	bump::FileSystem::WalkOptions throwing_options;
+	throwing_options.batchSize = 1;
+	throwing_options.errorCallback = boost::bind(&WalkCollector::addError, &throwing_collector, _1, _2);
+	EXPECT_FALSE(bump::FileSystem::walk(_unittestDirectory, boost::bind(&WalkCollector::throwError, &throwing_collector, _1), throwing_options));
+	EXPECT_TRUE(throwing_collector.errorCodes.empty());
+	EXPECT_EQ(12, throwing_collector.entries.size());
+	EXPECT_EQ(12, throwing_collector.batches);
+}
+
+TEST_F(FileSystemTest, testGlob)
+{
+	bump::FileSystem::createDirectory("unittest/regular_directory/nested");
+	bump::FileSystem::createFile("unittest/regular_directory/nested/notes.txt");
+
+	// Match a single directory
+	bump::StringList matches = bump::FileSystem::glob("unittest/files/*.txt");
+	ASSERT_EQ(2, matches.size());
+	EXPECT_STREQ("unittest/files/.hidden_file.txt", matches.at(0).c_str());
+	EXPECT_STREQ("unittest/files/output.txt", matches.at(1).c_str());
+
+	// Match wildcards in several components, following symbolic links to directories
+	matches = bump::FileSystem::glob("unittest/*_directory/[h-p]*.*");
+	ASSERT_EQ(4, matches.size());
+	EXPECT_STREQ("unittest/regular_directory/help.pdf", matches.at(0).c_str());
+	EXPECT_STREQ("unittest/regular_directory/paper.doc", matches.at(1).c_str());
+	EXPECT_STREQ("unittest/symlink_directory/help.pdf", matches.at(2).c_str());
+	EXPECT_STREQ("unittest/symlink_directory/paper.doc", matches.at(3).c_str());
+
+	// Match any number of directories without following symbolic links
+	matches = bump::FileSystem::glob("unittest/**/*.txt");
+	ASSERT_EQ(5, matches.size());
+	EXPECT_STREQ("unittest/files/.hidden_file.txt", matches.at(0).c_str());
+	EXPECT_STREQ("unittest/files/output.txt", matches.at(1).c_str());
+	EXPECT_STREQ("unittest/regular_directory/nested/notes.txt", matches.at(2).c_str());
+	EXPECT_STREQ("unittest/symlink_files/.hidden_file.txt", matches.at(3).c_str());
+	EXPECT_STREQ("unittest/symlink_files/output.txt", matches.at(4).c_str());
+	matches = bump::FileSystem::glob("unittest/regular_directory/**");
+	ASSERT_EQ(5, matches.size());
+	EXPECT_STREQ("unittest/regular_directory", matches.at(0).c_str());
+	EXPECT_STREQ("unittest/regular_directory/nested/notes.txt", matches.at(3).c_str());
+
+	// Match directories only
+	matches = bump::FileSystem::glob("unittest/*/");
+	ASSERT_EQ(4, matches.size());
+	EXPECT_STREQ("unittest/files", matches.at(0).c_str());
+	EXPECT_STREQ("unittest/regular_directory", matches.at(1).c_str());
+	EXPECT_STREQ("unittest/symlink_directory", matches.at(2).c_str());
+	EXPECT_STREQ("unittest/symlink_files", matches.at(3).c_str());
+	EXPECT_TRUE(bump::FileSystem::glob("unittest/files/*/").empty());
+
+	// Literal components are only checked for existence
+	matches = bump::FileSystem::glob("unittest/files/output.txt");
+	ASSERT_EQ(1, matches.size());
+	EXPECT_STREQ("unittest/files/output.txt", matches.at(0).c_str());
+	EXPECT_TRUE(bump::FileSystem::glob("unittest/files/missing.txt").empty());
+	EXPECT_TRUE(bump::FileSystem::glob("unittest/does_not_exist/*").empty());
+	EXPECT_TRUE(bump::FileSystem::glob("unittest/files/output.txt/*").empty());
+	EXPECT_TRUE(bump::FileSystem::glob("").empty());
+
+	// Absolute patterns keep their root
+	matches = bump::FileSystem::glob(bump::FileSystem::join(bump::FileSystem::currentPath(), "unittest/files/*.gz"));
+	ASSERT_EQ(1, matches.size());
+	EXPECT_STREQ(bump::FileSystem::join(bump::FileSystem::currentPath(), "unittest/files/archive.tar.gz").c_str(), matches.at(0).c_str());
+}
+
+TEST_F(FileSystemTest, testDiskUsage)
+{
+	// Build a small tree with known sizes, a hard link and a symbolic link
+	bump::FileSystem::createDirectory("unittest/usage");
+	bump::FileSystem::createDirectory("unittest/usage/nested");
+	bump::FileSystem::createDirectory("unittest/usage/nested/deeper");
+	std::ofstream stream("unittest/usage/small.txt");
+	stream << "12345";
+	stream.close();
+	stream.open("unittest/usage/nested/medium.txt");
+	stream << std::string(100, 'm');
+	stream.close();
+	stream.open("unittest/usage/nested/deeper/large.txt");
+	stream << std::string(1000, 'l');
+	stream.close();
+	ASSERT_EQ(0, link("unittest/usage/nested/deeper/large.txt", "unittest/usage/large_link.txt"));
+	ASSERT_EQ(0, symlink("small.txt", "unittest/usage/small_link.txt"));
+
+	// Hard linked files are only counted once
+	bump::FileSystem::DiskUsage usage = bump::FileSystem::diskUsage("unittest/usage");
+	EXPECT_EQ(1105, usage.logicalBytes);
+	EXPECT_EQ(3, usage.files);
+	EXPECT_EQ(3, usage.directories);
+	EXPECT_EQ(1, usage.symbolicLinks);
+	EXPECT_EQ(0, usage.others);
+	EXPECT_EQ(1, usage.hardLinks);
+	EXPECT_EQ(0, usage.errors);
+	EXPECT_LT(0, usage.allocatedBytes);
+
+	// The largest files come first
+	ASSERT_EQ(3, usage.largestEntries.size());
+	EXPECT_EQ(1000, usage.largestEntries[0].size);
+	EXPECT_TRUE(usage.largestEntries[0].path == "unittest/usage/nested/deeper/large.txt" ||
+		usage.largestEntries[0].path == "unittest/usage/large_link.txt");
+	EXPECT_STREQ("unittest/usage/nested/medium.txt", usage.largestEntries[1].path.c_str());
+	EXPECT_EQ(100, usage.largestEntries[1].size);
+	EXPECT_STREQ("unittest/usage/small.txt", usage.largestEntries[2].path.c_str());
+
+	// Limit the largest entries and the threads
+	bump::FileSystem::DiskUsageOptions options;
+	options.numberOfThreads = 1;
+	options.numberOfLargestEntries = 1;
+	options.stayOnFileSystem = true;
+	usage = bump::FileSystem::diskUsage("unittest/usage", options);
+	EXPECT_EQ(1105, usage.logicalBytes);
+	ASSERT_EQ(1, usage.largestEntries.size());
+	EXPECT_EQ(1000, usage.largestEntries[0].size);
+	options.numberOfLargestEntries = 0;
+	EXPECT_TRUE(bump::FileSystem::diskUsage("unittest/usage", options).largestEntries.empty());
+
+	// A file on its own
+	usage = bump::FileSystem::diskUsage("unittest/usage/nested/medium.txt");
+	EXPECT_EQ(100, usage.logicalBytes);
+	EXPECT_EQ(1, usage.files);
+	EXPECT_EQ(0, usage.directories);
+	ASSERT_EQ(1, usage.largestEntries.size());
+	EXPECT_STREQ("unittest/usage/nested/medium.txt", usage.largestEntries[0].path.c_str());
+
+	// Invalid paths
+	EXPECT_THROW(bump::FileSystem::diskUsage("unittest/does not exist"), bump::FileSystemError);
+}
+
+TEST_F(FileSystemTest, testCopyDirectoryAndContents)
+{
+	// Give the source tree some contents, permissions and dates worth preserving
+	std::ofstream stream("unittest/regular_directory/paper.doc");
+	stream << "The quick brown fox";
+	stream.close();
+	bump::FileSystem::Permissions file_permissions = bump::FileSystem::OWNER_READ | bump::FileSystem::OWNER_WRITE | bump::FileSystem::GROUP_READ;
+	bump::FileSystem::Permissions directory_permissions = bump::FileSystem::OWNER_ALL | bump::FileSystem::GROUP_READ | bump::FileSystem::GROUP_EXE;
+	EXPECT_TRUE(bump::FileSystem::setPermissions("unittest/regular_directory/paper.doc", file_permissions));
+	EXPECT_TRUE(bump::FileSystem::setModifiedDate("unittest/regular_directory/help.pdf", 1000000000));
+	EXPECT_TRUE(bump::FileSystem::createDirectory("unittest/regular_directory/nested"));
+	EXPECT_TRUE(bump::FileSystem::createFile("unittest/regular_directory/nested/notes.txt"));
+	EXPECT_TRUE(bump::FileSystem::setModifiedDate("unittest/regular_directory/nested", 1200000000));
+	EXPECT_TRUE(bump::FileSystem::setPermissions(_regularDirectory, directory_permissions));
+
+	// Copy the tree into a destination whose parent does not exist yet
+	CopyCollector collector;
+	bump::FileSystem::CopyOptions options;
+	options.progressCallback = boost::bind(&CopyCollector::updateProgress, &collector, _1);
+	options.errorCallback = boost::bind(&CopyCollector::addError, &collector, _1, _2);
+	EXPECT_TRUE(bump::FileSystem::copyDirectoryAndContents(_regularDirectory, "unittest/copies/regular", options));
+	EXPECT_TRUE(collector.errorCodes.empty());
+	EXPECT_EQ(4, collector.updates);
+	EXPECT_EQ(3, collector.latest.filesCopied);
+	EXPECT_EQ(1, collector.latest.directoriesCopied);
+	EXPECT_EQ(19, collector.latest.bytesCopied);
+	EXPECT_EQ(0, collector.latest.errors);
+
+	// Check the contents, permissions and dates of the copies
+	std::ifstream copied_stream("unittest/copies/regular/paper.doc");
+	std::string line;
+	std::getline(copied_stream, line);
+	EXPECT_STREQ("The quick brown fox", line.c_str());
+	EXPECT_TRUE(bump::FileSystem::isFile("unittest/copies/regular/nested/notes.txt"));
+	EXPECT_EQ(file_permissions, bump::FileSystem::permissions("unittest/copies/regular/paper.doc"));
+	EXPECT_EQ(directory_permissions, bump::FileSystem::permissions("unittest/copies/regular"));
+	EXPECT_EQ(1000000000, bump::FileSystem::modifiedDate("unittest/copies/regular/help.pdf"));
+	EXPECT_EQ(1200000000, bump::FileSystem::modifiedDate("unittest/copies/regular/nested"));
+
+	// Symbolic links should be recreated rather than followed
+	CopyCollector link_collector;
+	options.progressCallback = boost::bind(&CopyCollector::updateProgress, &link_collector, _1);
+	EXPECT_TRUE(bump::FileSystem::copyDirectoryAndContents(_symlinkFilesDirectory, "unittest/copies/links", options));
+	EXPECT_EQ(3, link_collector.latest.symbolicLinksCopied);
+	EXPECT_EQ(0, link_collector.latest.filesCopied);
+	EXPECT_TRUE(bump::FileSystem::isSymbolicLink("unittest/copies/links/output.txt"));
+
+	// Copy without preserving anything using a single thread
+	options = bump::FileSystem::CopyOptions();
+	options.numberOfThreads = 1;
+	options.preservePermissions = false;
+	options.preserveModifiedDates = false;
+	EXPECT_TRUE(bump::FileSystem::copyDirectoryAndContents(_regularDirectory, "unittest/copies/plain", options));
+	EXPECT_TRUE(bump::FileSystem::isFile("unittest/copies/plain/nested/notes.txt"));
+	EXPECT_NE(1000000000, bump::FileSystem::modifiedDate("unittest/copies/plain/help.pdf"));
+}
+
+TEST_F(FileSystemTest, testCopyDirectoryAndContentsErrors)
+{
+	CopyCollector collector;
+	bump::FileSystem::CopyOptions options;
+	options.progressCallback = boost::bind(&CopyCollector::updateProgress, &collector, _1);
+	options.errorCallback = boost::bind(&CopyCollector::addError, &collector, _1, _2);
+
+	// Copy a directory that does not exist
+	EXPECT_FALSE(bump::FileSystem::copyDirectoryAndContents("unittest/does not exist", "unittest/copies/missing", options));
+	ASSERT_EQ(1, collector.errorCodes.size());
+	EXPECT_EQ(ENOENT, collector.errorCodes[0]);
+	EXPECT_FALSE(bump::FileSystem::exists("unittest/copies/missing"));
+
+	// Copy a file
+	EXPECT_FALSE(bump::FileSystem::copyDirectoryAndContents("unittest/files/output.txt", "unittest/copies/file", options));
+	ASSERT_EQ(2, collector.errorCodes.size());
+	EXPECT_EQ(ENOTDIR, collector.errorCodes[1]);
+
+	// Copy over an existing destination
+	EXPECT_FALSE(bump::FileSystem::copyDirectoryAndContents(_filesDirectory, _regularDirectory, options));
+	ASSERT_EQ(3, collector.errorCodes.size());
+	EXPECT_EQ(EEXIST, collector.errorCodes[2]);
+
+	// A named pipe cannot be copied, but the rest of the directory still should be
+	ASSERT_EQ(0, mkfifo("unittest/files/pipe", 0600));
+	EXPECT_FALSE(bump::FileSystem::copyDirectoryAndContents(_filesDirectory, "unittest/copies/files", options));
+	ASSERT_EQ(4, collector.errorCodes.size());
+	EXPECT_EQ(ENOTSUP, collector.errorCodes[3]);
+	EXPECT_STREQ("unittest/files/pipe", collector.errorPaths[3].c_str());
+	EXPECT_EQ(3, collector.latest.filesCopied);
+	EXPECT_EQ(1, collector.latest.errors);
+	EXPECT_TRUE(bump::FileSystem::isFile("unittest/copies/files/.hidden_file.txt"));
+	EXPECT_FALSE(bump::FileSystem::exists("unittest/copies/files/pipe"));
+}
+
+TEST_F(FileSystemTest, testRemoveDirectoryAndContentsWithOptions)
+{
+	// Build a tree with enough files in one directory to split it across the pool
+	// - unittest/cache
+	//     |- file_0 ... file_599
+	//     |- nested
+	//     |   |- deeper
+	//     |   |   |- notes.txt
+	//     |   |- link -> deeper
+	EXPECT_TRUE(bump::FileSystem::createFullDirectoryPath("unittest/cache/nested/deeper"));
+	for (unsigned int i = 0; i < 600; ++i)
+	{
+		EXPECT_TRUE(bump::FileSystem::createFile(bump::String("unittest/cache/file_%1").arg(i)));
+	}
+	EXPECT_TRUE(bump::FileSystem::createFile("unittest/cache/nested/deeper/notes.txt"));
+	EXPECT_TRUE(bump::FileSystem::createDirectorySymbolicLink("deeper", "unittest/cache/nested/link"));
+
+	RemoveCollector collector;
+	bump::FileSystem::RemoveOptions options;
+	options.progressCallback = boost::bind(&RemoveCollector::updateProgress, &collector, _1);
+	options.errorCallback = boost::bind(&RemoveCollector::addError, &collector, _1, _2);
+	EXPECT_TRUE(bump::FileSystem::removeDirectoryAndContents("unittest/cache", options));
+	EXPECT_FALSE(bump::FileSystem::exists("unittest/cache"));
+	EXPECT_TRUE(collector.errorCodes.empty());
+	EXPECT_EQ(601, collector.latest.filesRemoved);
+	EXPECT_EQ(3, collector.latest.directoriesRemoved);
+	EXPECT_EQ(1, collector.latest.symbolicLinksRemoved);
+	EXPECT_EQ(0, collector.latest.errors);
+	EXPECT_STREQ("unittest/cache", collector.latest.path.c_str());
+
+	// The symbolic link target must survive when a linked directory is removed
+	EXPECT_TRUE(bump::FileSystem::removeDirectoryAndContents(_symlinkDirectory, options));
+	EXPECT_FALSE(bump::FileSystem::exists(_symlinkDirectory));
+	EXPECT_TRUE(bump::FileSystem::isFile("unittest/regular_directory/paper.doc"));
+
+	// Remove with a single thread
+	options.numberOfThreads = 1;
+	EXPECT_TRUE(bump::FileSystem::removeDirectoryAndContents(_regularDirectory, options));
+	EXPECT_FALSE(bump::FileSystem::exists(_regularDirectory));
+}
+
+TEST_F(FileSystemTest, testRemoveDirectoryAndContentsInBackground)
+{
+	EXPECT_TRUE(bump::FileSystem::createFullDirectoryPath("unittest/cache/nested"));
+	EXPECT_TRUE(bump::FileSystem::createFile("unittest/cache/nested/notes.txt"));
+
+	// The path should be free as soon as the call returns
+	RemoveCollector collector;
+	bump::FileSystem::RemoveOptions options;
+	options.removeInBackground = true;
+	options.progressCallback = boost::bind(&RemoveCollector::updateProgress, &collector, _1);
+	options.completionCallback = boost::bind(&RemoveCollector::finish, &collector, _1);
+	EXPECT_TRUE(bump::FileSystem::removeDirectoryAndContents("unittest/cache", options));
+	EXPECT_FALSE(bump::FileSystem::exists("unittest/cache"));
+	EXPECT_TRUE(bump::FileSystem::createDirectory("unittest/cache"));
+
+	// Wait for the completion callback to report the renamed tree is gone
+	for (unsigned int i = 0; i < 500 && collector.finished() == 0; ++i)
+	{
+		boost::this_thread::sleep(boost::posix_time::milliseconds(10));
+	}
+	EXPECT_EQ(1, collector.finished());
+	EXPECT_TRUE(collector.removed);
+	EXPECT_EQ(2, collector.directoriesRemoved());
+
+	bump::StringList contents = bump::FileSystem::directoryList(_unittestDirectory);
+	for (unsigned int i = 0; i < contents.size(); ++i)
+	{
+		EXPECT_FALSE(contents[i].contains(".removing-"));
+	}
+
+	// A path that cannot be renamed aside fails right away without calling back
+	EXPECT_FALSE(bump::FileSystem::removeDirectoryAndContents("unittest/does not exist", options));
+	EXPECT_EQ(1, collector.finished());
+}
+
+TEST_F(FileSystemTest, testCopyFileWithOptions)
+{
+	// Create a 3 MB file with contents that change along the way
+	std::string data;
+	for (unsigned int i = 0; i < 3 * 1024 * 1024; ++i)
+	{
+		data.push_back((char)(i % 251));
+	}
+	std::ofstream stream("unittest/files/large.bin", std::ios::binary);
+	stream.write(data.data(), data.size());
+	stream.close();
+
+	// Copy it in 1 MB chunks without cloning so the progress can be followed
+	FileCopyCollector collector;
+	bump::FileSystem::FileCopyOptions options;
+	options.cloneFile = false;
+	options.chunkSize = 1024 * 1024;
+	options.bufferSize = 64 * 1024;
+	options.progressCallback = boost::bind(&FileCopyCollector::updateProgress, &collector, _1, _2);
+	bump::FileSystem::FileCopyResult result = bump::FileSystem::copyFile("unittest/files/large.bin", "unittest/large.bin", options);
+	EXPECT_TRUE(result.succeeded);
+	EXPECT_FALSE(result.cancelled);
+	EXPECT_EQ(0, result.errorCode);
+	EXPECT_NE(bump::FileSystem::NO_COPY, result.method);
+	EXPECT_NE(bump::FileSystem::CLONE_COPY, result.method);
+	EXPECT_EQ(data.size(), result.bytesCopied);
+	EXPECT_GT(result.bytesPerSecond, 0.0);
+	EXPECT_EQ(3, collector.updates);
+	EXPECT_EQ(data.size(), collector.bytesCopied);
+	EXPECT_EQ(data.size(), collector.totalBytes);
+	EXPECT_TRUE(readContents("unittest/large.bin") == data);
+
+	// Cancel the copy after the first chunk, which should remove the partial copy
+	FileCopyCollector cancel_collector(1);
+	options.progressCallback = boost::bind(&FileCopyCollector::updateProgress, &cancel_collector, _1, _2);
+	result = bump::FileSystem::copyFile("unittest/files/large.bin", "unittest/cancelled.bin", options);
+	EXPECT_FALSE(result.succeeded);
+	EXPECT_TRUE(result.cancelled);
+	EXPECT_EQ(ECANCELED, result.errorCode);
+	EXPECT_EQ(1, cancel_collector.updates);
+	EXPECT_FALSE(bump::FileSystem::exists("unittest/cancelled.bin"));
+
+	// Invalid sources and destinations
+	options = bump::FileSystem::FileCopyOptions();
+	EXPECT_EQ(EEXIST, bump::FileSystem::copyFile("unittest/files/large.bin", "unittest/large.bin", options).errorCode);
+	EXPECT_EQ(ENOENT, bump::FileSystem::copyFile("unittest/files/missing.bin", "unittest/missing.bin", options).errorCode);
+	EXPECT_EQ(EISDIR, bump::FileSystem::copyFile(_filesDirectory, "unittest/directory.bin", options).errorCode);
+	EXPECT_FALSE(bump::FileSystem::exists("unittest/directory.bin"));
+}
+
+TEST_F(FileSystemTest, testCopyFileThroughUserSpace)
+{
+	// Pseudo files report a size of zero, so their data is always read through user space
+	if (!bump::FileSystem::exists("/proc/version"))
+	{
+		return;
+	}
+	std::string data = readContents("/proc/version");
+	ASSERT_FALSE(data.empty());
+
+	// Both reading ahead on a background thread and reading on the calling thread
+	bump::FileSystem::FileCopyOptions options;
+	bump::FileSystem::FileCopyResult result = bump::FileSystem::copyFile("/proc/version", "unittest/read_ahead.txt", options);
+	EXPECT_TRUE(result.succeeded);
+	EXPECT_EQ(bump::FileSystem::READ_WRITE_COPY, result.method);
+	EXPECT_EQ(data.size(), result.bytesCopied);
+	EXPECT_TRUE(readContents("unittest/read_ahead.txt") == data);
+
+	options.readAheadBuffers = 0;
+	result = bump::FileSystem::copyFile("/proc/version", "unittest/read_write.txt", options);
+	EXPECT_TRUE(result.succeeded);
+	EXPECT_EQ(bump::FileSystem::READ_WRITE_COPY, result.method);
+	EXPECT_TRUE(readContents("unittest/read_write.txt") == data);
+}
+
+TEST_F(FileSystemTest, testCopyFileSparse)
+{
+	// Create an 8 MB file with a single block of data in the middle
+	const off_t size = 8 * 1024 * 1024;
+	const off_t data_offset = 4 * 1024 * 1024;
+	std::string data(4096, 'x');
+	int descriptor = open("unittest/files/sparse.bin", O_WRONLY | O_CREAT | O_EXCL, 0644);
+	ASSERT_GE(descriptor, 0);
+	ASSERT_EQ(0, ftruncate(descriptor, size));
+	ASSERT_EQ((ssize_t)data.size(), pwrite(descriptor, data.data(), data.size(), data_offset));
+	close(descriptor);
+
+	bump::FileSystem::FileCopyOptions options;
+	options.cloneFile = false;
+	bump::FileSystem::FileCopyResult result = bump::FileSystem::copyFile("unittest/files/sparse.bin", "unittest/sparse.bin", options);
+	EXPECT_TRUE(result.succeeded);
+
+	// The copy should have the same size and contents
+	std::string contents = readContents("unittest/sparse.bin");
+	ASSERT_EQ((size_t)size, contents.size());
+	EXPECT_TRUE(contents.substr(data_offset, data.size()) == data);
+	EXPECT_EQ(std::string(data_offset, '\0'), contents.substr(0, data_offset));
+
+	// Only the data should have been copied when the file system supports holes
+	struct stat info;
+	ASSERT_EQ(0, stat("unittest/files/sparse.bin", &info));
+	if ((off_t)info.st_blocks * 512 < size)
+	{
+		EXPECT_LT(result.bytesCopied, (unsigned long long)size);
+	}
+}
+
+TEST_F(FileSystemTest, testWriteFileAtomically)
+{
+	// Replace an existing file and create a new one
+	EXPECT_TRUE(bump::FileSystem::writeFileAtomically("unittest/files/output.txt", "The quick brown fox"));
+	EXPECT_EQ("The quick brown fox", readContents("unittest/files/output.txt"));
+	EXPECT_TRUE(bump::FileSystem::writeFileAtomically("unittest/files/new.txt", bump::String("jumps"), false));
+	EXPECT_EQ("jumps", readContents("unittest/files/new.txt"));
+	EXPECT_TRUE(bump::FileSystem::writeFileAtomically("unittest/files/empty.txt", ""));
+	EXPECT_TRUE(bump::FileInfo("unittest/files/empty.txt").isFile());
+	EXPECT_EQ(5, bump::FileSystem::directoryList(_filesDirectory).size());
+
+	// A directory that does not exist
+	EXPECT_FALSE(bump::FileSystem::writeFileAtomically("unittest/does not exist/new.txt", "data"));
+}
+
+TEST_F(FileSystemTest, testWriteFilesAtomically)
+{
+	// Write files spread over two directories, one of which cannot be written
+	bump::StringList paths;
+	bump::StringList contents;
+	for (unsigned int i = 0; i < 10; ++i)
+	{
+		paths.push_back(bump::String("unittest/%1/file_%2.txt").arg(i % 2 == 0 ? "files" : "regular_directory").arg(i));
+		contents.push_back(bump::String("contents %1").arg(i));
+	}
+	paths.push_back("unittest/does not exist/file.txt");
+	contents.push_back("lost");
+
+	EXPECT_FALSE(bump::FileSystem::writeFilesAtomically(paths, contents));
+	for (unsigned int i = 0; i < 10; ++i)
+	{
+		EXPECT_EQ(contents[i], readContents(paths[i]));
+	}
+
+	// Every file written successfully
+	paths.pop_back();
+	contents.pop_back();
+	contents[0] = "rewritten";
+	EXPECT_TRUE(bump::FileSystem::writeFilesAtomically(paths, contents, false));
+	EXPECT_EQ("rewritten", readContents(paths[0]));
+
+	// The lists must line up
+	contents.pop_back();
+	EXPECT_THROW(bump::FileSystem::writeFilesAtomically(paths, contents), bump::InvalidArgumentError);
+}
+
+TEST_F(FileSystemTest, testStatBatch)
+{
+	std::ofstream stream("unittest/files/output.txt");
+	stream << "Hello";
+	stream.close();
+	EXPECT_TRUE(bump::FileSystem::setModifiedDate("unittest/files/output.txt", 1000000000));
+
+	bump::StringList paths;
+	paths.push_back("unittest/files/output.txt");
+	paths.push_back(_regularDirectory);
+	paths.push_back(_symlinkDirectory);
+	paths.push_back("unittest/does not exist");
+
+	// Follow the symbolic links
+	bump::FileSystem::StatBatchResult result = bump::FileSystem::statBatch(paths);
+	ASSERT_EQ(4, result.size());
+	EXPECT_TRUE(result.exists(0));
+	EXPECT_EQ(bump::FileSystem::FILE_ENTRY, result.types[0]);
+	EXPECT_EQ(5, result.sizes[0]);
+	EXPECT_EQ(1000000000, result.modifiedDates[0]);
+	EXPECT_EQ(bump::FileInfo("unittest/files/output.txt").ownerId(), result.ownerIds[0]);
+	EXPECT_EQ(bump::FileInfo("unittest/files/output.txt").groupId(), result.groupIds[0]);
+	EXPECT_TRUE(S_ISREG(result.modes[0]));
+	EXPECT_EQ(bump::FileSystem::DIRECTORY_ENTRY, result.types[1]);
+	EXPECT_EQ(bump::FileSystem::DIRECTORY_ENTRY, result.types[2]);
+	EXPECT_FALSE(result.exists(3));
+	EXPECT_EQ(ENOENT, result.errorCodes[3]);
+	EXPECT_EQ(bump::FileSystem::OTHER_ENTRY, result.types[3]);
+	EXPECT_EQ(0, result.sizes[3]);
+
+	// Report the symbolic links themselves
+	result = bump::FileSystem::statBatch(paths, false);
+	EXPECT_EQ(bump::FileSystem::SYMBOLIC_LINK_ENTRY, result.types[2]);
+
+	// A large batch is split across a thread pool but should give the same answers
+	bump::StringList many_paths;
+	for (unsigned int i = 0; i < 1000; ++i)
+	{
+		many_paths.push_back(paths[i % paths.size()]);
+	}
+	result = bump::FileSystem::statBatch(many_paths);
+	ASSERT_EQ(1000, result.size());
+	for (unsigned int i = 0; i < result.size(); ++i)
+	{
+		EXPECT_EQ(i % 4 != 3, result.exists(i));
+	}
+	EXPECT_EQ(5, result.sizes[996]);
+	EXPECT_EQ(bump::FileSystem::DIRECTORY_ENTRY, result.types[998]);
+
+	// An empty batch
+	EXPECT_EQ(0, bump::FileSystem::statBatch(bump::StringList()).size());
+}
+
+
+TEST_F(FileSystemTest, testSnapshot)
+{
+	// Snapshot the tree without hashing anything
+	bump::FileSystem::Snapshot before = bump::FileSystem::snapshot(_unittestDirectory);
+	EXPECT_STREQ("unittest", before.rootPath.c_str());
+	EXPECT_FALSE(before.hashesContents);
+	ASSERT_EQ(12, before.entries.size());
+	for (unsigned int i = 1; i < before.entries.size(); ++i)
+	{
+		EXPECT_LT(before.entries[i - 1].path, before.entries[i].path);
+		EXPECT_TRUE(before.entries[i].hash.empty());
+	}
+	ASSERT_TRUE(before.find("files/output.txt") != NULL);
+	EXPECT_EQ(bump::FileSystem::FILE_ENTRY, before.find("files/output.txt")->type);
+	EXPECT_EQ(0, before.find("files/output.txt")->size);
+	ASSERT_TRUE(before.find("symlink_directory") != NULL);
+	EXPECT_EQ(bump::FileSystem::SYMBOLIC_LINK_ENTRY, before.find("symlink_directory")->type);
+	EXPECT_EQ(bump::FileSystem::DIRECTORY_ENTRY, before.find("regular_directory")->type);
+	EXPECT_TRUE(before.find("symlink_directory/paper.doc") == NULL);
+	EXPECT_TRUE(before.find("does not exist") == NULL);
+
+	// Nothing changed
+	EXPECT_TRUE(bump::FileSystem::diff(before, bump::FileSystem::snapshot("unittest/")).isEmpty());
+
+	// Add, remove and modify some files
+	std::ofstream stream("unittest/files/output.txt");
+	stream << "Hello";
+	stream.close();
+	EXPECT_TRUE(bump::FileSystem::createFile("unittest/regular_directory/new.txt"));
+	EXPECT_TRUE(bump::FileSystem::removeFile("unittest/regular_directory/help.pdf"));
+	bump::FileSystem::Snapshot after = bump::FileSystem::snapshot(_unittestDirectory, before, true);
+	EXPECT_TRUE(after.hashesContents);
+	bump::FileSystem::SnapshotDiff changes = bump::FileSystem::diff(before, after);
+	ASSERT_EQ(1, changes.added.size());
+	EXPECT_STREQ("regular_directory/new.txt", changes.added[0].c_str());
+	ASSERT_EQ(1, changes.removed.size());
+	EXPECT_STREQ("regular_directory/help.pdf", changes.removed[0].c_str());
+	ASSERT_EQ(1, changes.modified.size());
+	EXPECT_STREQ("files/output.txt", changes.modified[0].c_str());
+
+	// Neither overload hashes unless asked to
+	EXPECT_FALSE(bump::FileSystem::snapshot(_unittestDirectory, before).hashesContents);
+
+	// Check the hashes
+	bump::CryptographicHash hash;
+	hash.setData("Hello");
+	EXPECT_STREQ(hash.result().c_str(), after.find("files/output.txt")->hash.c_str());
+	EXPECT_STREQ("da39a3ee5e6b4b0d3255bfef95601890afd80709", after.find("files/archive.tar.gz")->hash.c_str());
+	EXPECT_TRUE(after.find("regular_directory")->hash.empty());
+	EXPECT_TRUE(after.find("symlink_files/output.txt")->hash.empty());
+}
+
+TEST_F(FileSystemTest, testSnapshotReusesHashes)
+{
+	std::ofstream stream("unittest/files/output.txt");
+	stream << "Hello";
+	stream.close();
+	EXPECT_TRUE(bump::FileSystem::setModifiedDate("unittest/files/output.txt", 1000000000));
+	bump::FileSystem::Snapshot first = bump::FileSystem::snapshot(_unittestDirectory, true);
+	bump::String first_hash = first.find("files/output.txt")->hash;
+	EXPECT_EQ(40, first_hash.length());
+
+	// Rewrite the contents without changing the size or the modified date
+	stream.open("unittest/files/output.txt");
+	stream << "World";
+	stream.close();
+	EXPECT_TRUE(bump::FileSystem::setModifiedDate("unittest/files/output.txt", 1000000000));
+
+	// The stale hash is reused since the file looks unchanged, a fresh snapshot hashes it again
+	bump::FileSystem::Snapshot second = bump::FileSystem::snapshot(_unittestDirectory, first, true);
+	EXPECT_STREQ(first_hash.c_str(), second.find("files/output.txt")->hash.c_str());
+	EXPECT_TRUE(bump::FileSystem::diff(first, second).isEmpty());
+	bump::FileSystem::Snapshot fresh = bump::FileSystem::snapshot(_unittestDirectory, true);
+	EXPECT_STRNE(first_hash.c_str(), fresh.find("files/output.txt")->hash.c_str());
+	EXPECT_EQ(1, bump::FileSystem::diff(first, fresh).modified.size());
+
+	// Touching a file without changing its contents is only a modification when either side is not hashed
+	bump::FileSystem::Snapshot unhashed = bump::FileSystem::snapshot(_unittestDirectory);
+	EXPECT_TRUE(bump::FileSystem::setModifiedDate("unittest/files/output.txt", 1000000100));
+	bump::FileSystem::Snapshot touched = bump::FileSystem::snapshot(_unittestDirectory, fresh, true);
+	EXPECT_TRUE(bump::FileSystem::diff(fresh, touched).isEmpty());
+	EXPECT_EQ(1, bump::FileSystem::diff(unhashed, touched).modified.size());
+
+	// Invalid paths
+	EXPECT_THROW(bump::FileSystem::snapshot("unittest/does not exist"), bump::FileSystemError);
+	EXPECT_THROW(bump::FileSystem::snapshot("unittest/files/output.txt"), bump::FileSystemError);
+
+	// A subdirectory that cannot be listed fails the snapshot rather than looking removed
+	if (geteuid() != 0)
+	{
+		ASSERT_EQ(0, chmod("unittest/regular_directory", 0));
+		EXPECT_THROW(bump::FileSystem::snapshot(_unittestDirectory), bump::FileSystemError);
+		ASSERT_EQ(0, chmod("unittest/regular_directory", 0755));
+	}
+}
+
+TEST_F(FileSystemTest, testWriteAndReadSnapshot)
+{
+	std::ofstream stream("unittest/files/output.txt");
+	stream << "Hello";
+	stream.close();
+	bump::FileSystem::Snapshot snapshot = bump::FileSystem::snapshot(_unittestDirectory, true);
+
+	// Write the index outside the tree and read it back
+	EXPECT_TRUE(bump::FileSystem::writeSnapshot(snapshot, "unittest_index.snapshot"));
+	bump::FileSystem::Snapshot loaded = bump::FileSystem::readSnapshot("unittest_index.snapshot");
+	EXPECT_STREQ(snapshot.rootPath.c_str(), loaded.rootPath.c_str());
+	EXPECT_TRUE(loaded.hashesContents);
+	ASSERT_EQ(snapshot.entries.size(), loaded.entries.size());
+	for (unsigned int i = 0; i < snapshot.entries.size(); ++i)
+	{
+		const bump::FileSystem::SnapshotEntry& expected = snapshot.entries[i];
+		const bump::FileSystem::SnapshotEntry& actual = loaded.entries[i];
+		EXPECT_STREQ(expected.path.c_str(), actual.path.c_str());
+		EXPECT_EQ(expected.type, actual.type);
+		EXPECT_EQ(expected.size, actual.size);
+		EXPECT_EQ(expected.modifiedDate, actual.modifiedDate);
+		EXPECT_EQ(expected.modifiedNanoseconds, actual.modifiedNanoseconds);
+		EXPECT_EQ(expected.mode, actual.mode);
+		EXPECT_STREQ(expected.hash.c_str(), actual.hash.c_str());
+	}
+	EXPECT_TRUE(bump::FileSystem::diff(snapshot, loaded).isEmpty());
+
+	// Truncated and foreign files are rejected
+	std::ifstream input("unittest_index.snapshot", std::ios::binary);
+	std::string contents((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+	input.close();
+	std::ofstream output("unittest_index.snapshot", std::ios::binary | std::ios::trunc);
+	output.write(contents.data(), contents.size() - 3);
+	output.close();
+	EXPECT_THROW(bump::FileSystem::readSnapshot("unittest_index.snapshot"), bump::FileSystemError);
+	EXPECT_THROW(bump::FileSystem::readSnapshot("unittest/files/output.txt"), bump::FileSystemError);
+	EXPECT_THROW(bump::FileSystem::readSnapshot("unittest/does not exist"), bump::FileSystemError);
+	EXPECT_TRUE(bump::FileSystem::removeFile("unittest_index.snapshot"));
+
+	// An empty snapshot
+	EXPECT_TRUE(bump::FileSystem::writeSnapshot(bump::FileSystem::Snapshot(), "unittest_index.snapshot"));
+	EXPECT_EQ(0, bump::FileSystem::readSnapshot("unittest_index.snapshot").entries.size());
+	EXPECT_TRUE(bump::FileSystem::removeFile("unittest_index.snapshot"));
+	EXPECT_FALSE(bump::FileSystem::writeSnapshot(snapshot, "unittest/does not exist/index.snapshot"));
+}
+
 }	// End of bumpTest namespace
@@ -0,0 +1,250 @@
+//
+//	FileWatcherTest.cpp
+//	Bump
+//
+//	Created by Joseph Holub on 10/18/26.
+//	Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+// Boost headers
+#include <boost/bind.hpp>
+#include <boost/thread.hpp>
+
+// Bump headers
+#include <bump/FileSystem.h>
+#include <bump/FileWatcher.h>
+#include <bump/NotificationCenter.h>
+
+// C++ headers
+#include <fstream>
+
+// bumpTest headers
+#include "../bumpTest/BaseTest.h"
+
+namespace bumpTest {
+
+/**
+ * Collects all the batches of changes delivered by a file watcher.
+ */
+class ChangeCollector
+{
+public:
+
+	ChangeCollector() : _batches(0) {}
+
+	void addChanges(const bump::FileWatcher::FileChangeList& changes)
+	{
+		boost::mutex::scoped_lock lock(_mutex);
+		++_batches;
+		for (unsigned int i = 0; i < changes.size(); ++i)
+		{
+			_changes[changes[i].path] |= changes[i].changes;
+		}
+		_changed.notify_all();
+	}
+
+	bool waitForChange(const bump::String& path, unsigned int changes)
+	{
+		boost::mutex::scoped_lock lock(_mutex);
+		boost::system_time timeout = boost::get_system_time() + boost::posix_time::seconds(5);
+		while ((_changes[path] & changes) != changes)
+		{
+			if (!_changed.timed_wait(lock, timeout))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	unsigned int batches()
+	{
+		boost::mutex::scoped_lock lock(_mutex);
+		return _batches;
+	}
+
+	unsigned int numberOfPaths()
+	{
+		boost::mutex::scoped_lock lock(_mutex);
+		unsigned int count = 0;
+		for (std::map<bump::String, unsigned int>::iterator iter = _changes.begin(); iter != _changes.end(); ++iter)
+		{
+			count += (iter->second != 0) ? 1 : 0;
+		}
+		return count;
+	}
+
+protected:
+
+	boost::mutex _mutex;
+	boost::condition_variable _changed;
+	unsigned int _batches;
+	std::map<bump::String, unsigned int> _changes;
+};
+
+/**
+ * This is our main file watcher testing class. The SetUp and TearDown methods are
+ * executed before the test runs and after it completes. This is where we can
+ * add any custom set up for each test without having to add this to "every"
+ * test individually.
+ */
+class FileWatcherTest : public BaseTest
+{
+protected:
+
+	/** Run immediately before a test starts. Starts the timer. */
+	void SetUp()
+	{
+		// Call the parent setup method
+		BaseTest::SetUp();
+
+		// Create the following directory structure to watch
+		// - unittest
+		//     |- files
+		//     |   |- output.txt
+		bump::FileSystem::createDirectory("unittest");
+		bump::FileSystem::createDirectory("unittest/files");
+		bump::FileSystem::createFile("unittest/files/output.txt");
+	}
+
+	/** Invoked immediately after a test finishes. Stops the timer. */
+	void TearDown()
+	{
+		// Call the parent tear down method
+		BaseTest::TearDown();
+
+		// Remove the entire directory structure that was built
+		bump::FileSystem::removeDirectoryAndContents("unittest");
+	}
+
+	/** Appends a line to the file. */
+	void appendLine(const bump::String& path)
+	{
+		std::ofstream stream(path.c_str(), std::ios::app);
+		stream << "line" << std::endl;
+	}
+};
+
+TEST_F(FileWatcherTest, testCallbackDelivery)
+{
+	ChangeCollector collector;
+	bump::FileWatcher watcher;
+	watcher.setCoalescingInterval(20);
+	watcher.setCallback(boost::bind(&ChangeCollector::addChanges, &collector, _1));
+	EXPECT_EQ(20, watcher.coalescingInterval());
+	EXPECT_TRUE(watcher.addPath("unittest/", true));
+	EXPECT_EQ(2, watcher.watchedPaths().size());
+	EXPECT_FALSE(watcher.isRunning());
+	EXPECT_TRUE(watcher.start());
+	EXPECT_TRUE(watcher.isRunning());
+
+	// Create, modify and remove files
+	bump::FileSystem::createFile("unittest/new.txt");
+	EXPECT_TRUE(collector.waitForChange("unittest/new.txt", bump::FileWatcher::CREATED));
+	appendLine("unittest/files/output.txt");
+	EXPECT_TRUE(collector.waitForChange("unittest/files/output.txt", bump::FileWatcher::MODIFIED));
+	bump::FileSystem::removeFile("unittest/new.txt");
+	EXPECT_TRUE(collector.waitForChange("unittest/new.txt", bump::FileWatcher::REMOVED));
+	bump::FileSystem::renameFile("unittest/files/output.txt", "unittest/files/renamed.txt");
+	EXPECT_TRUE(collector.waitForChange("unittest/files/output.txt", bump::FileWatcher::MOVED_FROM));
+	EXPECT_TRUE(collector.waitForChange("unittest/files/renamed.txt", bump::FileWatcher::MOVED_TO));
+
+	// Directories created inside a recursive watch are watched as well
+	bump::FileSystem::createDirectory("unittest/nested");
+	bump::FileSystem::createFile("unittest/nested/deep.txt");
+	EXPECT_TRUE(collector.waitForChange("unittest/nested", bump::FileWatcher::CREATED));
+	EXPECT_TRUE(collector.waitForChange("unittest/nested/deep.txt", bump::FileWatcher::CREATED));
+	EXPECT_EQ(3, watcher.watchedPaths().size());
+
+	// A tree moved into a recursive watch has its existing contents reported as created
+	bump::FileSystem::createDirectory("unittest_moved");
+	bump::FileSystem::createDirectory("unittest_moved/inner");
+	bump::FileSystem::createFile("unittest_moved/inner/existing.txt");
+	bump::FileSystem::renameDirectory("unittest_moved", "unittest/moved");
+	EXPECT_TRUE(collector.waitForChange("unittest/moved", bump::FileWatcher::MOVED_TO));
+	EXPECT_TRUE(collector.waitForChange("unittest/moved/inner", bump::FileWatcher::CREATED));
+	EXPECT_TRUE(collector.waitForChange("unittest/moved/inner/existing.txt", bump::FileWatcher::CREATED));
+	EXPECT_EQ(5, watcher.watchedPaths().size());
+
+	// Removing the path stops all the watches below it
+	EXPECT_TRUE(watcher.removePath("unittest"));
+	EXPECT_FALSE(watcher.removePath("unittest"));
+	EXPECT_TRUE(watcher.watchedPaths().empty());
+	watcher.stop();
+	EXPECT_FALSE(watcher.isRunning());
+}
+
+TEST_F(FileWatcherTest, testCoalescing)
+{
+	ChangeCollector collector;
+	bump::FileWatcher watcher;
+	watcher.setCoalescingInterval(200);
+	watcher.setCallback(boost::bind(&ChangeCollector::addChanges, &collector, _1));
+	EXPECT_TRUE(watcher.addPath("unittest/files/output.txt"));
+	EXPECT_TRUE(watcher.start());
+
+	// A burst of writes to the same file should be merged into a single change
+	for (unsigned int i = 0; i < 20; ++i)
+	{
+		appendLine("unittest/files/output.txt");
+	}
+	EXPECT_TRUE(collector.waitForChange("unittest/files/output.txt", bump::FileWatcher::MODIFIED));
+	EXPECT_EQ(1, collector.batches());
+	EXPECT_EQ(1, collector.numberOfPaths());
+}
+
+TEST_F(FileWatcherTest, testQueuedDelivery)
+{
+	ChangeCollector collector;
+	bump::FileWatcher watcher;
+	watcher.setCoalescingInterval(10);
+	watcher.setCallback(boost::bind(&ChangeCollector::addChanges, &collector, _1), bump::FileWatcher::QUEUED_DELIVERY);
+	EXPECT_TRUE(watcher.addPath("unittest/files"));
+	EXPECT_TRUE(watcher.start());
+
+	// Nothing is delivered until the changes are processed
+	EXPECT_EQ(0, watcher.processChanges());
+	bump::FileSystem::createFile("unittest/files/queued.txt");
+	EXPECT_EQ(1, watcher.processChanges(5000));
+	EXPECT_EQ(1, collector.batches());
+	EXPECT_TRUE(collector.waitForChange("unittest/files/queued.txt", bump::FileWatcher::CREATED));
+
+	// The watcher can be restarted
+	watcher.stop();
+	EXPECT_TRUE(watcher.start());
+	bump::FileSystem::removeFile("unittest/files/queued.txt");
+	EXPECT_EQ(1, watcher.processChanges(5000));
+	EXPECT_TRUE(collector.waitForChange("unittest/files/queued.txt", bump::FileWatcher::REMOVED));
+}
+
+TEST_F(FileWatcherTest, testNotificationDelivery)
+{
+	ChangeCollector collector;
+	bump::Observer* observer = new bump::ObjectObserver<ChangeCollector, bump::FileWatcher::FileChangeList>(
+		&collector, &ChangeCollector::addChanges, "FilesChanged");
+	ADD_OBSERVER(observer);
+
+	bump::FileWatcher watcher;
+	watcher.setCoalescingInterval(10);
+	watcher.setNotificationName("FilesChanged");
+	EXPECT_STREQ("FilesChanged", watcher.notificationName().c_str());
+	EXPECT_TRUE(watcher.addPath("unittest/files"));
+	EXPECT_TRUE(watcher.start());
+
+	bump::FileSystem::createFile("unittest/files/posted.txt");
+	EXPECT_TRUE(collector.waitForChange("unittest/files/posted.txt", bump::FileWatcher::CREATED));
+
+	watcher.stop();
+	REMOVE_OBSERVER(&collector);
+}
+
+TEST_F(FileWatcherTest, testInvalidPaths)
+{
+	bump::FileWatcher watcher;
+	EXPECT_FALSE(watcher.addPath("unittest/does not exist"));
+	EXPECT_FALSE(watcher.removePath("unittest/files"));
+	EXPECT_TRUE(watcher.watchedPaths().empty());
+}
+
+}	// End of bumpTest namespace
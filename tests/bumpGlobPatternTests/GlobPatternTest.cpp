@@ -0,0 +1,129 @@
+//
+//	GlobPatternTest.cpp
+//	Bump
+//
+//	Created by Joseph Holub on 10/18/26.
+//	Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+// Bump headers
+#include <bump/GlobPattern.h>
+
+// bumpTest headers
+#include "../bumpTest/BaseTest.h"
+
+namespace bumpTest {
+
+/**
+ * This is our main glob pattern testing class. The SetUp and TearDown methods are
+ * executed before the test runs and after it completes. This is where we can
+ * add any custom set up for each test without having to add this to "every"
+ * test individually.
+ */
+class GlobPatternTest : public BaseTest
+{
+	// No custom setup needed
+};
+
+TEST_F(GlobPatternTest, testCompile)
+{
+	// Test an empty pattern
+	bump::GlobPattern empty;
+	EXPECT_TRUE(empty.isEmpty());
+	EXPECT_EQ(0, empty.numberOfComponents());
+	EXPECT_TRUE(empty.matches(""));
+	EXPECT_FALSE(empty.matches("file.txt"));
+
+	// Test splitting the pattern into components
+	bump::GlobPattern pattern("/usr//lib/**/**/lib[a-z]*.so/");
+	EXPECT_STREQ("/usr//lib/**/**/lib[a-z]*.so/", pattern.pattern().c_str());
+	EXPECT_TRUE(pattern.isAbsolute());
+	EXPECT_TRUE(pattern.matchesDirectoriesOnly());
+	ASSERT_EQ(4, pattern.numberOfComponents());
+	EXPECT_TRUE(pattern.isLiteral(0));
+	EXPECT_STREQ("usr", pattern.literal(0).c_str());
+	EXPECT_TRUE(pattern.isLiteral(1));
+	EXPECT_TRUE(pattern.isRecursive(2));
+	EXPECT_FALSE(pattern.isLiteral(2));
+	EXPECT_FALSE(pattern.isLiteral(3));
+	EXPECT_FALSE(pattern.isRecursive(3));
+
+	// Test that escaped wildcards are literal
+	bump::GlobPattern escaped("notes\\[1\\]\\*.txt");
+	EXPECT_FALSE(escaped.isAbsolute());
+	EXPECT_FALSE(escaped.matchesDirectoriesOnly());
+	ASSERT_EQ(1, escaped.numberOfComponents());
+	EXPECT_TRUE(escaped.isLiteral(0));
+	EXPECT_STREQ("notes[1]*.txt", escaped.literal(0).c_str());
+}
+
+TEST_F(GlobPatternTest, testMatchWildcards)
+{
+	// Test '*'
+	bump::GlobPattern star("*.txt");
+	EXPECT_TRUE(star.matches(0, "file.txt"));
+	EXPECT_TRUE(star.matches(0, ".txt"));
+	EXPECT_TRUE(star.matches(0, "a.txt.txt"));
+	EXPECT_FALSE(star.matches(0, "file.txt.gz"));
+	EXPECT_FALSE(star.matches(0, "file.tx"));
+	EXPECT_TRUE(bump::GlobPattern("*").matches(0, ".hidden"));
+	EXPECT_TRUE(bump::GlobPattern("a*b*c").matches(0, "aXbYbZc"));
+	EXPECT_FALSE(bump::GlobPattern("a*b*c").matches(0, "aXbYbZ"));
+	EXPECT_TRUE(bump::GlobPattern("a**c").matches(0, "abc"));
+
+	// Test '?'
+	bump::GlobPattern question("file?.log");
+	EXPECT_TRUE(question.matches(0, "file1.log"));
+	EXPECT_FALSE(question.matches(0, "file.log"));
+	EXPECT_FALSE(question.matches(0, "file12.log"));
+
+	// Test character classes, ranges and negation
+	bump::GlobPattern range("[a-c]?[0-9x]");
+	EXPECT_TRUE(range.matches(0, "bz9"));
+	EXPECT_TRUE(range.matches(0, "a-x"));
+	EXPECT_FALSE(range.matches(0, "dz9"));
+	EXPECT_FALSE(range.matches(0, "bzy"));
+	EXPECT_TRUE(bump::GlobPattern("[!.]*").matches(0, "visible"));
+	EXPECT_FALSE(bump::GlobPattern("[!.]*").matches(0, ".hidden"));
+	EXPECT_FALSE(bump::GlobPattern("[^a-z]").matches(0, "q"));
+	EXPECT_TRUE(bump::GlobPattern("[]]").matches(0, "]"));
+	EXPECT_TRUE(bump::GlobPattern("[!]]").matches(0, "a"));
+	EXPECT_FALSE(bump::GlobPattern("[!]]").matches(0, "]"));
+
+	// Test that unterminated classes and escapes are literal
+	EXPECT_TRUE(bump::GlobPattern("[abc").matches(0, "[abc"));
+	EXPECT_FALSE(bump::GlobPattern("[abc").matches(0, "a"));
+	EXPECT_TRUE(bump::GlobPattern("\\*?").matches(0, "*a"));
+	EXPECT_FALSE(bump::GlobPattern("\\*?").matches(0, "ba"));
+}
+
+TEST_F(GlobPatternTest, testMatchPaths)
+{
+	// Test that wildcards never cross a separator
+	bump::GlobPattern single("src/*.cpp");
+	EXPECT_TRUE(single.matches("src/String.cpp"));
+	EXPECT_TRUE(single.matches("src//String.cpp"));
+	EXPECT_FALSE(single.matches("src/bump/String.cpp"));
+	EXPECT_FALSE(single.matches("/src/String.cpp"));
+	EXPECT_FALSE(single.matches("src"));
+
+	// Test that '**' matches any number of directories
+	bump::GlobPattern recursive("src/**/*.cpp");
+	EXPECT_TRUE(recursive.matches("src/String.cpp"));
+	EXPECT_TRUE(recursive.matches("src/bump/String.cpp"));
+	EXPECT_TRUE(recursive.matches("src/a/b/c/String.cpp"));
+	EXPECT_FALSE(recursive.matches("include/bump/String.h"));
+	EXPECT_FALSE(recursive.matches("src/a/b/c/String.h"));
+
+	bump::GlobPattern trailing("/tmp/**");
+	EXPECT_TRUE(trailing.matches("/tmp"));
+	EXPECT_TRUE(trailing.matches("/tmp/a/b"));
+	EXPECT_FALSE(trailing.matches("tmp/a"));
+
+	bump::GlobPattern middle("**/build/**/*.o");
+	EXPECT_TRUE(middle.matches("build/main.o"));
+	EXPECT_TRUE(middle.matches("a/b/build/c/d/main.o"));
+	EXPECT_FALSE(middle.matches("a/b/builds/c/main.o"));
+}
+
+}	// End of bumpTest namespace
@@ -0,0 +1,145 @@
+//
+//	IdentityCacheTest.cpp
+//	Bump
+//
+//	Created by Joseph Holub on 10/18/26.
+//	Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+// Boost headers
+#include <boost/thread.hpp>
+
+// Bump headers
+#include <bump/IdentityCache.h>
+
+// bumpTest headers
+#include "../bumpTest/BaseTest.h"
+
+// Unix headers
+#include <grp.h>
+#include <pwd.h>
+#include <unistd.h>
+
+namespace bumpTest {
+
+// An id that no user or group should ever have
+static const unsigned int UNKNOWN_ID = 3999999999u;
+
+/**
+ * This is our main identity cache testing class. The SetUp and TearDown methods are
+ * executed before the test runs and after it completes. This is where we can
+ * add any custom set up for each test without having to add this to "every"
+ * test individually.
+ */
+class IdentityCacheTest : public BaseTest
+{
+protected:
+
+	/** Run immediately before a test starts. Starts the timer. */
+	void SetUp()
+	{
+		// Call the parent setup method
+		BaseTest::SetUp();
+
+		// Start every test with an empty cache
+		bump::IdentityCache::instance()->clear();
+	}
+
+	/** Invoked immediately after a test finishes. Stops the timer. */
+	void TearDown()
+	{
+		// Call the parent tear down method
+		BaseTest::TearDown();
+
+		// Put the singleton back the way the rest of the library expects it
+		bump::IdentityCache* cache = bump::IdentityCache::instance();
+		cache->clear();
+		cache->setMaximumSize(1024);
+		cache->setTimeToLive(0.0);
+	}
+};
+
+TEST_F(IdentityCacheTest, testUserName)
+{
+	// Compare against the system user database
+	bump::IdentityCache* cache = bump::IdentityCache::instance();
+	struct passwd* user = getpwuid(getuid());
+	ASSERT_TRUE(user != NULL);
+	EXPECT_STREQ(user->pw_name, cache->userName(getuid()).c_str());
+	EXPECT_EQ(1, cache->size());
+
+	// The second lookup should come from the cache
+	EXPECT_STREQ(user->pw_name, cache->userName(getuid()).c_str());
+	EXPECT_EQ(1, cache->size());
+
+	// Unknown users are reported by id
+	EXPECT_STREQ("3999999999", cache->userName(UNKNOWN_ID).c_str());
+	EXPECT_EQ(2, cache->size());
+}
+
+TEST_F(IdentityCacheTest, testGroupName)
+{
+	// Compare against the system group database
+	bump::IdentityCache* cache = bump::IdentityCache::instance();
+	struct group* group = getgrgid(getgid());
+	ASSERT_TRUE(group != NULL);
+	EXPECT_STREQ(group->gr_name, cache->groupName(getgid()).c_str());
+	EXPECT_EQ(1, cache->size());
+
+	// Users and groups are cached separately even when the ids match
+	cache->userName(getgid());
+	EXPECT_EQ(2, cache->size());
+
+	// Unknown groups are reported by id
+	EXPECT_STREQ("3999999999", cache->groupName(UNKNOWN_ID).c_str());
+	EXPECT_EQ(3, cache->size());
+}
+
+TEST_F(IdentityCacheTest, testMaximumSize)
+{
+	// Check the default
+	bump::IdentityCache* cache = bump::IdentityCache::instance();
+	EXPECT_EQ(1024, cache->maximumSize());
+
+	// Only the most recently used names should stay cached
+	cache->setMaximumSize(2);
+	EXPECT_EQ(2, cache->maximumSize());
+	cache->userName(UNKNOWN_ID);
+	cache->userName(UNKNOWN_ID - 1);
+	cache->userName(UNKNOWN_ID);
+	cache->userName(UNKNOWN_ID - 2);
+	EXPECT_EQ(2, cache->size());
+
+	// Shrinking the cache evicts immediately
+	cache->setMaximumSize(1);
+	EXPECT_EQ(1, cache->size());
+
+	// A maximum size of 0 disables caching, but lookups still work
+	cache->setMaximumSize(0);
+	EXPECT_EQ(0, cache->size());
+	EXPECT_STREQ("3999999999", cache->userName(UNKNOWN_ID).c_str());
+	EXPECT_EQ(0, cache->size());
+}
+
+TEST_F(IdentityCacheTest, testTimeToLive)
+{
+	// Check the default
+	bump::IdentityCache* cache = bump::IdentityCache::instance();
+	EXPECT_DOUBLE_EQ(0.0, cache->timeToLive());
+
+	// Expired names are looked up again and replace the cached entry
+	cache->setTimeToLive(0.01);
+	EXPECT_DOUBLE_EQ(0.01, cache->timeToLive());
+	bump::String name = cache->userName(getuid());
+	boost::this_thread::sleep(boost::posix_time::milliseconds(20));
+	EXPECT_STREQ(name.c_str(), cache->userName(getuid()).c_str());
+	EXPECT_EQ(1, cache->size());
+
+	// Clear out everything
+	cache->groupName(getgid());
+	EXPECT_EQ(2, cache->size());
+	cache->clear();
+	EXPECT_EQ(0, cache->size());
+}
+
+}	// End of bumpTest namespace
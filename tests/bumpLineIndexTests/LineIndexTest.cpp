@@ -0,0 +1,218 @@
+//
+//	LineIndexTest.cpp
+//	Bump
+//
+//	Created by Joseph Holub on 10/18/26.
+//	Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+// Bump headers
+#include <bump/FileSystem.h>
+#include <bump/LineIndex.h>
+#include <bump/TextFileReader.h>
+
+// C++ headers
+#include <fstream>
+
+// bumpTest headers
+#include "../bumpTest/BaseTest.h"
+
+// Unix headers
+#include <errno.h>
+
+namespace bumpTest {
+
+/**
+ * This is our main line index testing class. The SetUp and TearDown methods are
+ * executed before the test runs and after it completes. This is where we can
+ * add any custom set up for each test without having to add this to "every"
+ * test individually.
+ */
+class LineIndexTest : public BaseTest
+{
+protected:
+
+	/** Run immediately before a test starts. Starts the timer. */
+	void SetUp()
+	{
+		// Call the parent setup method
+		BaseTest::SetUp();
+
+		// Create the following directory structure
+		// - unittest
+		bump::FileSystem::createDirectory("unittest");
+	}
+
+	/** Invoked immediately after a test finishes. Stops the timer. */
+	void TearDown()
+	{
+		// Call the parent tear down method
+		BaseTest::TearDown();
+
+		// Remove the entire directory structure that was built
+		bump::FileSystem::removeDirectoryAndContents("unittest");
+	}
+
+	/** Writes the contents to the file exactly as given. */
+	void writeContents(const bump::String& path, const std::string& contents)
+	{
+		std::ofstream stream(path.c_str(), std::ios::binary);
+		stream << contents;
+	}
+};
+
+TEST_F(LineIndexTest, testBuild)
+{
+	writeContents("unittest/lines.txt", "one\ntwo\nthree\nfour\nfive\nsix\nseven\n");
+
+	bump::LineIndex index;
+	EXPECT_TRUE(index.isEmpty());
+	EXPECT_EQ(0, index.numberOfLines());
+	ASSERT_TRUE(index.build("unittest/lines.txt", 3));
+	EXPECT_FALSE(index.isEmpty());
+	EXPECT_STREQ("unittest/lines.txt", index.path().c_str());
+	EXPECT_EQ(3, index.interval());
+	EXPECT_EQ(34, index.fileSize());
+	EXPECT_TRUE(index.isCurrent("unittest/lines.txt"));
+
+	// The trailing newline ends the last line with an empty one, just like the TextFileReader
+	EXPECT_EQ(8, index.numberOfLines());
+
+	// Every line maps to the closest indexed line at or before it
+	unsigned long long indexed_line = 0;
+	unsigned long long offset = 0;
+	ASSERT_TRUE(index.locate(1, indexed_line, offset));
+	EXPECT_EQ(1, indexed_line);
+	EXPECT_EQ(0, offset);
+	ASSERT_TRUE(index.locate(3, indexed_line, offset));
+	EXPECT_EQ(1, indexed_line);
+	ASSERT_TRUE(index.locate(4, indexed_line, offset));
+	EXPECT_EQ(4, indexed_line);
+	EXPECT_EQ(14, offset);
+	ASSERT_TRUE(index.locate(8, indexed_line, offset));
+	EXPECT_EQ(7, indexed_line);
+	EXPECT_EQ(28, offset);
+	EXPECT_FALSE(index.locate(0, indexed_line, offset));
+	EXPECT_FALSE(index.locate(9, indexed_line, offset));
+
+	// An empty file still has its one empty line
+	writeContents("unittest/empty.txt", "");
+	ASSERT_TRUE(index.build("unittest/empty.txt"));
+	EXPECT_EQ(1, index.numberOfLines());
+	EXPECT_EQ(bump::LineIndex::DEFAULT_INTERVAL, index.interval());
+
+	// Missing files and a zero interval are refused
+	EXPECT_FALSE(index.build("unittest/does not exist.txt"));
+	EXPECT_EQ(ENOENT, errno);
+	EXPECT_FALSE(index.build("unittest/lines.txt", 0));
+	EXPECT_EQ(EINVAL, errno);
+	index.clear();
+	EXPECT_TRUE(index.isEmpty());
+	EXPECT_FALSE(index.isCurrent("unittest/lines.txt"));
+}
+
+TEST_F(LineIndexTest, testLargeFile)
+{
+	// Spread the lines over many blocks so most of them are only counted
+	std::string contents;
+	std::vector<unsigned long long> offsets;
+	for (unsigned int i = 0; i < 50000; ++i)
+	{
+		if (i % 1000 == 0)
+		{
+			offsets.push_back(contents.size());
+		}
+		contents += "line " + bump::String(i).toStdString() + "\n";
+	}
+	contents += "last";
+	writeContents("unittest/large.txt", contents);
+
+	bump::LineIndex index;
+	ASSERT_TRUE(index.build("unittest/large.txt", 1000));
+	EXPECT_EQ(50001, index.numberOfLines());
+	unsigned long long indexed_line = 0;
+	unsigned long long offset = 0;
+	for (unsigned int i = 0; i < offsets.size(); ++i)
+	{
+		ASSERT_TRUE(index.locate(i * 1000 + 1, indexed_line, offset));
+		EXPECT_EQ(i * 1000 + 1, indexed_line);
+		EXPECT_EQ(offsets[i], offset);
+	}
+
+	// Reading a page through the index matches reading it from the start
+	bump::StringList expected = bump::TextFileReader::fileContents("unittest/large.txt", 43210, 5);
+	bump::StringList lines = bump::TextFileReader::fileContents("unittest/large.txt", 43210, 5, index);
+	ASSERT_EQ(5, lines.size());
+	EXPECT_STREQ("line 43209", lines.at(0).c_str());
+	EXPECT_TRUE(expected == lines);
+
+	// Reading past the end behaves the same as well
+	lines = bump::TextFileReader::fileContents("unittest/large.txt", 49999, 10, index);
+	ASSERT_EQ(3, lines.size());
+	EXPECT_STREQ("last", lines.at(2).c_str());
+	EXPECT_TRUE(bump::TextFileReader::fileContents("unittest/large.txt", 50002, 1, index).empty());
+}
+
+TEST_F(LineIndexTest, testSidecar)
+{
+	writeContents("unittest/lines.txt", "one\ntwo\nthree\nfour\nfive");
+	bump::String sidecar_path = bump::LineIndex::sidecarPath("unittest/lines.txt");
+	EXPECT_STREQ("unittest/lines.txt.lineindex", sidecar_path.c_str());
+
+	// The first update indexes the file and writes the sidecar
+	bump::LineIndex index;
+	ASSERT_TRUE(index.update("unittest/lines.txt", sidecar_path, 2));
+	EXPECT_TRUE(bump::FileSystem::isFile(sidecar_path));
+
+	// A new index loads the sidecar instead of indexing the file again
+	bump::LineIndex loaded;
+	ASSERT_TRUE(loaded.load(sidecar_path));
+	EXPECT_STREQ("unittest/lines.txt", loaded.path().c_str());
+	EXPECT_EQ(2, loaded.interval());
+	EXPECT_EQ(5, loaded.numberOfLines());
+	EXPECT_EQ(index.fileSize(), loaded.fileSize());
+	EXPECT_EQ(index.modifiedDate(), loaded.modifiedDate());
+	unsigned long long indexed_line = 0;
+	unsigned long long offset = 0;
+	ASSERT_TRUE(loaded.locate(4, indexed_line, offset));
+	EXPECT_EQ(3, indexed_line);
+	EXPECT_EQ(8, offset);
+	ASSERT_TRUE(loaded.update("unittest/lines.txt", sidecar_path, 2));
+	bump::StringList lines = bump::TextFileReader::fileContents("unittest/lines.txt", 4, 2, loaded);
+	ASSERT_EQ(2, lines.size());
+	EXPECT_STREQ("four", lines.at(0).c_str());
+	EXPECT_STREQ("five", lines.at(1).c_str());
+
+	// Changing the file makes both indexes stale, and updating rebuilds them
+	writeContents("unittest/lines.txt", "zero\none\ntwo\nthree\nfour\nfive");
+	EXPECT_FALSE(loaded.isCurrent("unittest/lines.txt"));
+	lines = bump::TextFileReader::fileContents("unittest/lines.txt", 5, 1, loaded);
+	ASSERT_EQ(1, lines.size());
+	EXPECT_STREQ("four", lines.at(0).c_str());
+	ASSERT_TRUE(loaded.update("unittest/lines.txt", sidecar_path, 2));
+	EXPECT_EQ(6, loaded.numberOfLines());
+	ASSERT_TRUE(index.load(sidecar_path));
+	EXPECT_EQ(6, index.numberOfLines());
+
+	// Rewriting the file to the same size right away still makes the index stale
+	writeContents("unittest/lines.txt", "zero\none\ntwo\nthree\nfour\nFIVE");
+	EXPECT_FALSE(loaded.isCurrent("unittest/lines.txt"));
+	EXPECT_FALSE(index.isCurrent("unittest/lines.txt"));
+	ASSERT_TRUE(loaded.update("unittest/lines.txt", sidecar_path, 2));
+	lines = bump::TextFileReader::fileContents("unittest/lines.txt", 6, 1, loaded);
+	ASSERT_EQ(1, lines.size());
+	EXPECT_STREQ("FIVE", lines.at(0).c_str());
+
+	// A sidecar that is not an index is refused and leaves the index untouched
+	writeContents(sidecar_path, "not an index");
+	EXPECT_FALSE(index.load(sidecar_path));
+	EXPECT_EQ(EINVAL, errno);
+	EXPECT_EQ(6, index.numberOfLines());
+	EXPECT_FALSE(index.load("unittest/missing.lineindex"));
+	EXPECT_EQ(ENOENT, errno);
+
+	// Empty indexes cannot be saved
+	EXPECT_FALSE(bump::LineIndex().save(sidecar_path));
+}
+
+}	// End of bumpTest namespace
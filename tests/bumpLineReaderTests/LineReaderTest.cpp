@@ -0,0 +1,264 @@
+//
+//	LineReaderTest.cpp
+//	Bump
+//
+//	Created by Joseph Holub on 10/18/26.
+//	Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+// Bump headers
+#include <bump/DecompressingReader.h>
+#include <bump/FileSystem.h>
+#include <bump/LineReader.h>
+
+// C++ headers
+#include <fstream>
+
+// bumpTest headers
+#include "../bumpTest/BaseTest.h"
+
+// Unix headers
+#include <errno.h>
+
+namespace bumpTest {
+
+// "first line\r\nsecond line\n\nlast line" compressed with gzip
+static const char COMPRESSED_LINES[] =
+	"\x1f\x8b\x08\x00\x00\x00\x00\x00\x02\x03\x4b\xcb\x2c\x2a\x2e\x51\xc8\xc9\xcc\x4b\xe5\xe5"
+	"\x2a\x4e\x4d\xce\xcf\x4b\x01\x73\xb8\xb8\x72\x12\xa1\xe2\x00\xb7\x9e\x9a\xe7\x22\x00\x00"
+	"\x00";
+
+/**
+ * This is our main line reader testing class. The SetUp and TearDown methods are
+ * executed before the test runs and after it completes. This is where we can
+ * add any custom set up for each test without having to add this to "every"
+ * test individually.
+ */
+class LineReaderTest : public BaseTest
+{
+protected:
+
+	/** Run immediately before a test starts. Starts the timer. */
+	void SetUp()
+	{
+		// Call the parent setup method
+		BaseTest::SetUp();
+
+		// Create the following directory structure
+		// - unittest
+		bump::FileSystem::createDirectory("unittest");
+	}
+
+	/** Invoked immediately after a test finishes. Stops the timer. */
+	void TearDown()
+	{
+		// Call the parent tear down method
+		BaseTest::TearDown();
+
+		// Remove the entire directory structure that was built
+		bump::FileSystem::removeDirectoryAndContents("unittest");
+	}
+
+	/** Writes the contents to the file exactly as given. */
+	void writeContents(const bump::String& path, const std::string& contents)
+	{
+		std::ofstream stream(path.c_str(), std::ios::binary);
+		stream << contents;
+	}
+
+	/** Appends the contents to the end of the file. */
+	void appendContents(const bump::String& path, const std::string& contents)
+	{
+		std::ofstream stream(path.c_str(), std::ios::binary | std::ios::app);
+		stream << contents;
+	}
+};
+
+TEST_F(LineReaderTest, testReadLines)
+{
+	writeContents("unittest/lines.txt", "first line\r\nsecond line\n\nlast line");
+
+	bump::LineReader reader;
+	EXPECT_FALSE(reader.isOpen());
+	ASSERT_TRUE(reader.open("unittest/lines.txt"));
+	EXPECT_TRUE(reader.isOpen());
+	EXPECT_STREQ("unittest/lines.txt", reader.path().c_str());
+	EXPECT_EQ(0, reader.lineNumber());
+
+	// CRLF endings, empty lines and a last line without a newline
+	bump::StringView line;
+	ASSERT_TRUE(reader.readLine(line));
+	EXPECT_TRUE(line == "first line");
+	EXPECT_EQ(1, reader.lineNumber());
+	EXPECT_EQ(0, reader.lineOffset());
+	ASSERT_TRUE(reader.readLine(line));
+	EXPECT_TRUE(line == "second line");
+	EXPECT_EQ(2, reader.lineNumber());
+	EXPECT_EQ(12, reader.lineOffset());
+	ASSERT_TRUE(reader.readLine(line));
+	EXPECT_TRUE(line.isEmpty());
+	EXPECT_EQ(24, reader.lineOffset());
+	EXPECT_FALSE(reader.isAtEnd());
+	ASSERT_TRUE(reader.readLine(line));
+	EXPECT_TRUE(line == "last line");
+	EXPECT_EQ(4, reader.lineNumber());
+	EXPECT_EQ(25, reader.lineOffset());
+	EXPECT_TRUE(reader.isAtEnd());
+	EXPECT_FALSE(reader.readLine(line));
+	EXPECT_EQ(0, reader.errorCode());
+
+	// A trailing newline does not add an empty line, and an empty file has no lines
+	writeContents("unittest/lines.txt", "only line\n");
+	ASSERT_TRUE(reader.open("unittest/lines.txt"));
+	ASSERT_TRUE(reader.readLine(line));
+	EXPECT_TRUE(line == "only line");
+	EXPECT_FALSE(reader.readLine(line));
+	EXPECT_EQ(1, reader.lineNumber());
+	writeContents("unittest/empty.txt", "");
+	ASSERT_TRUE(reader.open("unittest/empty.txt"));
+	EXPECT_FALSE(reader.readLine(line));
+	EXPECT_TRUE(reader.isAtEnd());
+	EXPECT_EQ(0, reader.lineNumber());
+}
+
+TEST_F(LineReaderTest, testSmallBuffer)
+{
+	// Lines straddling chunks and lines longer than the buffer
+	std::string long_line(100, 'x');
+	writeContents("unittest/lines.txt", "abc\r\ndefgh\n" + long_line + "\r\nij\r\n");
+
+	bump::LineReader reader(4);
+	ASSERT_TRUE(reader.open("unittest/lines.txt"));
+	bump::StringView line;
+	ASSERT_TRUE(reader.readLine(line));
+	EXPECT_TRUE(line == "abc");
+	ASSERT_TRUE(reader.readLine(line));
+	EXPECT_TRUE(line == "defgh");
+	EXPECT_EQ(5, reader.lineOffset());
+	ASSERT_TRUE(reader.readLine(line));
+	EXPECT_TRUE(line.toString() == long_line);
+	EXPECT_EQ(11, reader.lineOffset());
+	ASSERT_TRUE(reader.readLine(line));
+	EXPECT_TRUE(line == "ij");
+	EXPECT_EQ(113, reader.lineOffset());
+	EXPECT_EQ(4, reader.lineNumber());
+	EXPECT_FALSE(reader.readLine(line));
+
+	// Count many lines through a tiny buffer
+	std::string contents;
+	for (unsigned int i = 0; i < 1000; ++i)
+	{
+		contents += "line\n";
+	}
+	writeContents("unittest/many.txt", contents);
+	ASSERT_TRUE(reader.open("unittest/many.txt"));
+	unsigned int count = 0;
+	while (reader.readLine(line))
+	{
+		EXPECT_TRUE(line == "line");
+		++count;
+	}
+	EXPECT_EQ(1000, count);
+	EXPECT_EQ(4995, reader.lineOffset());
+}
+
+TEST_F(LineReaderTest, testInvalidFiles)
+{
+	bump::LineReader reader;
+	bump::StringView line;
+	EXPECT_FALSE(reader.readLine(line));
+
+	EXPECT_FALSE(reader.open("unittest/does not exist.txt"));
+	EXPECT_EQ(ENOENT, errno);
+	EXPECT_FALSE(reader.isOpen());
+	EXPECT_FALSE(reader.open("unittest"));
+	EXPECT_EQ(EISDIR, errno);
+	EXPECT_FALSE(reader.readLine(line));
+
+	// Closing the reader resets it
+	writeContents("unittest/lines.txt", "line\n");
+	ASSERT_TRUE(reader.open("unittest/lines.txt"));
+	ASSERT_TRUE(reader.readLine(line));
+	reader.close();
+	EXPECT_FALSE(reader.isOpen());
+	EXPECT_EQ(0, reader.lineNumber());
+	EXPECT_FALSE(reader.readLine(line));
+}
+
+TEST_F(LineReaderTest, testFollowLine)
+{
+	writeContents("unittest/log.txt", "first\n");
+
+	bump::LineReader reader;
+	ASSERT_TRUE(reader.open("unittest/log.txt"));
+	bump::StringView line;
+	ASSERT_TRUE(reader.followLine(line, 0));
+	EXPECT_TRUE(line == "first");
+
+	// Nothing new has been written yet
+	EXPECT_FALSE(reader.followLine(line, 0));
+	EXPECT_FALSE(reader.followLine(line, 50));
+	EXPECT_EQ(0, reader.errorCode());
+
+	// A partial line is held back until its newline is written
+	appendContents("unittest/log.txt", "sec");
+	EXPECT_FALSE(reader.followLine(line, 50));
+	appendContents("unittest/log.txt", "ond\nthird\n");
+	ASSERT_TRUE(reader.followLine(line, 1000));
+	EXPECT_TRUE(line == "second");
+	EXPECT_EQ(6, reader.lineOffset());
+	ASSERT_TRUE(reader.followLine(line, 1000));
+	EXPECT_TRUE(line == "third");
+	EXPECT_EQ(3, reader.lineNumber());
+
+	// Truncating the file starts reading it again from the beginning
+	writeContents("unittest/log.txt", "new\n");
+	ASSERT_TRUE(reader.followLine(line, 1000));
+	EXPECT_TRUE(line == "new");
+	EXPECT_EQ(1, reader.lineNumber());
+	EXPECT_EQ(0, reader.lineOffset());
+
+	// Following a closed reader fails right away
+	reader.close();
+	EXPECT_FALSE(reader.followLine(line, 1000));
+}
+
+TEST_F(LineReaderTest, testCompressedFile)
+{
+	writeContents("unittest/lines.txt.gz", std::string(COMPRESSED_LINES, sizeof(COMPRESSED_LINES) - 1));
+	bump::LineReader reader(4);
+	if (!bump::DecompressingReader::isFormatSupported(bump::DecompressingReader::GZIP_FORMAT))
+	{
+		EXPECT_FALSE(reader.open("unittest/lines.txt.gz"));
+		EXPECT_EQ(ENOTSUP, errno);
+		return;
+	}
+
+	// The lines are split out of the decompressed contents, with offsets into them
+	ASSERT_TRUE(reader.open("unittest/lines.txt.gz"));
+	bump::StringView line;
+	ASSERT_TRUE(reader.readLine(line));
+	EXPECT_TRUE(line == "first line");
+	ASSERT_TRUE(reader.readLine(line));
+	EXPECT_TRUE(line == "second line");
+	EXPECT_EQ(12, reader.lineOffset());
+	ASSERT_TRUE(reader.readLine(line));
+	EXPECT_TRUE(line.isEmpty());
+	ASSERT_TRUE(reader.readLine(line));
+	EXPECT_TRUE(line == "last line");
+	EXPECT_FALSE(reader.readLine(line));
+	EXPECT_TRUE(reader.isAtEnd());
+	EXPECT_EQ(0, reader.errorCode());
+
+	// Following stops at the end of the decompressed contents instead of restarting
+	EXPECT_FALSE(reader.followLine(line, 0));
+	EXPECT_EQ(4, reader.lineNumber());
+
+	// Corrupt data stops the reader with an error
+	writeContents("unittest/corrupt.gz", std::string(COMPRESSED_LINES, 10) + "\xff\xff\xff\xff");
+	ASSERT_TRUE(reader.open("unittest/corrupt.gz"));
+	EXPECT_FALSE(reader.readLine(line));
+	EXPECT_EQ(EILSEQ, reader.errorCode());
+}
+
+}	// End of bumpTest namespace
@@ -0,0 +1,153 @@
+//
+//	MappedFileTest.cpp
+//	Bump
+//
+//	Created by Joseph Holub on 10/18/26.
+//	Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+// Bump headers
+#include <bump/FileSystem.h>
+#include <bump/MappedFile.h>
+
+// C++ headers
+#include <fstream>
+#include <iterator>
+
+// bumpTest headers
+#include "../bumpTest/BaseTest.h"
+
+// Unix headers
+#include <errno.h>
+
+namespace bumpTest {
+
+/**
+ * This is our main mapped file testing class. The SetUp and TearDown methods are
+ * executed before the test runs and after it completes. This is where we can
+ * add any custom set up for each test without having to add this to "every"
+ * test individually.
+ */
+class MappedFileTest : public BaseTest
+{
+protected:
+
+	/** Run immediately before a test starts. Starts the timer. */
+	void SetUp()
+	{
+		// Call the parent setup method
+		BaseTest::SetUp();
+
+		// Create the following directory structure
+		// - unittest
+		//     |- lines.txt
+		//     |- empty.txt
+		bump::FileSystem::createDirectory("unittest");
+		std::ofstream stream("unittest/lines.txt");
+		stream << "first line\nsecond line\nthird line\n";
+		stream.close();
+		bump::FileSystem::createFile("unittest/empty.txt");
+	}
+
+	/** Invoked immediately after a test finishes. Stops the timer. */
+	void TearDown()
+	{
+		// Call the parent tear down method
+		BaseTest::TearDown();
+
+		// Remove the entire directory structure that was built
+		bump::FileSystem::removeDirectoryAndContents("unittest");
+	}
+
+	/** Returns the entire contents of the file. */
+	std::string readContents(const bump::String& path)
+	{
+		std::ifstream stream(path.c_str(), std::ios::binary);
+		return std::string((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+	}
+};
+
+TEST_F(MappedFileTest, testReadOnly)
+{
+	bump::MappedFile file;
+	EXPECT_FALSE(file.isOpen());
+	EXPECT_TRUE(file.view().isEmpty());
+
+	// Map the file and view its contents
+	ASSERT_TRUE(file.open("unittest/lines.txt"));
+	EXPECT_TRUE(file.isOpen());
+	EXPECT_TRUE(file.isMapped());
+	EXPECT_STREQ("unittest/lines.txt", file.path().c_str());
+	EXPECT_EQ(bump::MappedFile::READ_ONLY, file.mode());
+	EXPECT_EQ(34, file.size());
+	EXPECT_TRUE(file.view() == "first line\nsecond line\nthird line\n");
+	EXPECT_EQ('f', file.data()[0]);
+	EXPECT_TRUE(file.writableData() == NULL);
+
+	// Give every hint over the whole file and over part of it
+	EXPECT_TRUE(file.advise(bump::MappedFile::SEQUENTIAL_ACCESS));
+	EXPECT_TRUE(file.advise(bump::MappedFile::RANDOM_ACCESS, 11, 12));
+	EXPECT_TRUE(file.advise(bump::MappedFile::WILL_NEED, 20, 1000));
+	EXPECT_TRUE(file.advise(bump::MappedFile::NORMAL_ACCESS));
+	file.advise(bump::MappedFile::HUGE_PAGES);
+
+	// A read-only mapping cannot be synchronized
+	EXPECT_FALSE(file.synchronize());
+
+	// Closing the file empties the view
+	file.close();
+	EXPECT_FALSE(file.isOpen());
+	EXPECT_FALSE(file.isMapped());
+	EXPECT_EQ(0, file.size());
+	EXPECT_TRUE(file.data() == NULL);
+}
+
+TEST_F(MappedFileTest, testReadWrite)
+{
+	bump::MappedFile file;
+	ASSERT_TRUE(file.open("unittest/lines.txt", bump::MappedFile::READ_WRITE));
+	EXPECT_EQ(bump::MappedFile::READ_WRITE, file.mode());
+	ASSERT_TRUE(file.writableData() != NULL);
+
+	// Change the contents in place and write them back
+	file.writableData()[0] = 'F';
+	file.writableData()[11] = 'S';
+	EXPECT_TRUE(file.synchronize());
+	EXPECT_TRUE(file.synchronize(false));
+	EXPECT_EQ("First line\nSecond line\nthird line\n", readContents("unittest/lines.txt"));
+
+	// Changes are written back when the file is closed as well
+	file.writableData()[23] = 'T';
+	file.close();
+	EXPECT_EQ("First line\nSecond line\nThird line\n", readContents("unittest/lines.txt"));
+}
+
+TEST_F(MappedFileTest, testEmptyAndNonRegularFiles)
+{
+	// Empty files open with an empty view
+	bump::MappedFile file;
+	ASSERT_TRUE(file.open("unittest/empty.txt"));
+	EXPECT_TRUE(file.isOpen());
+	EXPECT_FALSE(file.isMapped());
+	EXPECT_EQ(0, file.size());
+	EXPECT_TRUE(file.view().isEmpty());
+	EXPECT_TRUE(file.advise(bump::MappedFile::SEQUENTIAL_ACCESS));
+	ASSERT_TRUE(file.open("unittest/empty.txt", bump::MappedFile::READ_WRITE));
+	EXPECT_TRUE(file.synchronize());
+
+	// Devices are read rather than mapped
+	ASSERT_TRUE(file.open("/dev/null"));
+	EXPECT_FALSE(file.isMapped());
+	EXPECT_EQ(0, file.size());
+	EXPECT_FALSE(file.open("/dev/null", bump::MappedFile::READ_WRITE));
+	EXPECT_EQ(ENODEV, errno);
+	EXPECT_FALSE(file.isOpen());
+
+	// Directories and missing files are refused
+	EXPECT_FALSE(file.open("unittest"));
+	EXPECT_EQ(EISDIR, errno);
+	EXPECT_FALSE(file.open("unittest/does not exist.txt"));
+	EXPECT_EQ(ENOENT, errno);
+}
+
+}	// End of bumpTest namespace
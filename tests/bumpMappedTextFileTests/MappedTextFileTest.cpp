@@ -0,0 +1,176 @@
+//
+//	MappedTextFileTest.cpp
+//	Bump
+//
+//	Created by Joseph Holub on 10/18/26.
+//	Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+// Bump headers
+#include <bump/FileSystem.h>
+#include <bump/Log.h>
+#include <bump/MappedTextFile.h>
+#include <bump/TextFileReader.h>
+
+// C++ headers
+#include <fstream>
+
+// bumpTest headers
+#include "../bumpTest/BaseTest.h"
+
+// Unix headers
+#include <errno.h>
+
+namespace bumpTest {
+
+/**
+ * This is our main mapped text file testing class. The SetUp and TearDown methods are
+ * executed before the test runs and after it completes. This is where we can
+ * add any custom set up for each test without having to add this to "every"
+ * test individually.
+ */
+class MappedTextFileTest : public BaseTest
+{
+protected:
+
+	/** Run immediately before a test starts. Starts the timer. */
+	void SetUp()
+	{
+		// Call the parent setup method
+		BaseTest::SetUp();
+
+		// Keep the TextFileReader quiet when it is compared against
+		_previousLogLevel = bump::Log::instance()->logLevel();
+		bump::Log::instance()->setLogLevel(bump::Log::ALWAYS_LVL);
+
+		// Create the following directory structure
+		// - unittest
+		//     |- lines.txt
+		bump::FileSystem::createDirectory("unittest");
+		std::ofstream stream("unittest/lines.txt", std::ios::binary);
+		stream << "first\r\nsecond\n\nfourth\nfifth\n";
+		stream.close();
+	}
+
+	/** Invoked immediately after a test finishes. Stops the timer. */
+	void TearDown()
+	{
+		// Call the parent tear down method
+		BaseTest::TearDown();
+
+		// Remove the entire directory structure that was built
+		bump::FileSystem::removeDirectoryAndContents("unittest");
+
+		// Reset the Log level to what it was before
+		bump::Log::instance()->setLogLevel(_previousLogLevel);
+	}
+
+	/** Returns whether the views hold the same lines as the strings. */
+	bool isEqual(const bump::StringViewList& views, const bump::StringList& strings)
+	{
+		if (views.size() != strings.size())
+		{
+			return false;
+		}
+
+		for (unsigned int i = 0; i < views.size(); ++i)
+		{
+			if (views[i] != strings[i])
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	bump::Log::LogLevel _previousLogLevel;
+};
+
+TEST_F(MappedTextFileTest, testQueries)
+{
+	bump::MappedTextFile file;
+	EXPECT_FALSE(file.isOpen());
+	EXPECT_TRUE(file.fileContents().empty());
+	EXPECT_TRUE(file.footer(1).empty());
+	EXPECT_EQ(0, file.numberOfLines());
+
+	ASSERT_TRUE(file.open("unittest/lines.txt"));
+	EXPECT_TRUE(file.isOpen());
+	EXPECT_TRUE(file.isMapped());
+	EXPECT_STREQ("unittest/lines.txt", file.path().c_str());
+	EXPECT_EQ(6, file.numberOfLines());
+	EXPECT_TRUE(file.firstLine() == "first\r");
+
+	// Every query returns the same lines as the TextFileReader
+	const bump::String path = "unittest/lines.txt";
+	EXPECT_TRUE(isEqual(file.fileContents(), bump::TextFileReader::fileContents(path)));
+	EXPECT_TRUE(isEqual(file.fileContents(2, 3), bump::TextFileReader::fileContents(path, 2, 3)));
+	EXPECT_TRUE(isEqual(file.fileContents(4), bump::TextFileReader::fileContents(path, 4)));
+	EXPECT_TRUE(isEqual(file.fileContents(5, 10), bump::TextFileReader::fileContents(path, 5, 10)));
+	EXPECT_TRUE(isEqual(file.fileContents(3, -1), bump::TextFileReader::fileContents(path, 3, -1)));
+	EXPECT_TRUE(isEqual(file.header(2), bump::TextFileReader::header(path, 2)));
+	EXPECT_TRUE(isEqual(file.footer(3), bump::TextFileReader::footer(path, 3)));
+	EXPECT_TRUE(isEqual(file.footer(100), bump::TextFileReader::footer(path, 100)));
+
+	// Lines outside the file and non-positive sizes return nothing
+	EXPECT_TRUE(file.fileContents(0, 1).empty());
+	EXPECT_TRUE(file.fileContents(7).empty());
+	EXPECT_TRUE(file.fileContents(1, 0).empty());
+	EXPECT_TRUE(file.header(-1).empty());
+	EXPECT_TRUE(file.footer(0).empty());
+
+	// The views point straight into the mapping
+	bump::StringViewList lines = file.fileContents(4, 1);
+	ASSERT_EQ(1, lines.size());
+	EXPECT_TRUE(lines[0] == "fourth");
+	EXPECT_EQ(file.contents().data() + 15, lines[0].data());
+}
+
+TEST_F(MappedTextFileTest, testIndex)
+{
+	std::ofstream stream("unittest/many.txt", std::ios::binary);
+	for (unsigned int i = 1; i <= 5000; ++i)
+	{
+		stream << "line " << i << "\n";
+	}
+	stream.close();
+
+	bump::MappedTextFile file;
+	ASSERT_TRUE(file.open("unittest/many.txt"));
+	bump::StringViewList unindexed = file.fileContents(4321, 3);
+	EXPECT_TRUE(file.index().isEmpty());
+	ASSERT_TRUE(file.buildIndex(100));
+	EXPECT_FALSE(file.index().isEmpty());
+	EXPECT_EQ(5001, file.numberOfLines());
+
+	bump::StringViewList indexed = file.fileContents(4321, 3);
+	ASSERT_EQ(3, indexed.size());
+	EXPECT_TRUE(indexed == unindexed);
+	EXPECT_TRUE(indexed[0] == "line 4321");
+	EXPECT_TRUE(file.fileContents(5002).empty());
+
+	// Opening another file drops the index
+	ASSERT_TRUE(file.open("unittest/lines.txt"));
+	EXPECT_TRUE(file.index().isEmpty());
+	EXPECT_TRUE(file.fileContents(4, 1)[0] == "fourth");
+}
+
+TEST_F(MappedTextFileTest, testSpecialFiles)
+{
+	// Devices are read into memory instead of mapped
+	bump::MappedTextFile file;
+	ASSERT_TRUE(file.open("/dev/null"));
+	EXPECT_FALSE(file.isMapped());
+	EXPECT_EQ(1, file.numberOfLines());
+	EXPECT_TRUE(file.firstLine().isEmpty());
+
+	// Missing files and directories are refused
+	EXPECT_FALSE(file.open("unittest/does not exist.txt"));
+	EXPECT_EQ(ENOENT, errno);
+	EXPECT_FALSE(file.isOpen());
+	EXPECT_FALSE(file.open("unittest"));
+	EXPECT_EQ(EISDIR, errno);
+}
+
+}	// End of bumpTest namespace
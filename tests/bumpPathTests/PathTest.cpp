@@ -0,0 +1,135 @@
+//
+//	PathTest.cpp
+//	Bump
+//
+//	Created by Joseph Holub on 10/18/26.
+//	Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+// Bump headers
+#include <bump/Path.h>
+
+// bumpTest headers
+#include "../bumpTest/BaseTest.h"
+
+namespace bumpTest {
+
+/**
+ * This is our main path testing class. The SetUp and TearDown methods are
+ * executed before the test runs and after it completes. This is where we can
+ * add any custom set up for each test without having to add this to "every"
+ * test individually.
+ */
+class PathTest : public BaseTest
+{
+protected:
+
+	/** Run immediately before a test starts. Starts the timer. */
+	void SetUp()
+	{
+		// Call the parent setup method
+		BaseTest::SetUp();
+
+		// Any custom setup we may need
+	}
+
+	/** Invoked immediately after a test finishes. Stops the timer. */
+	void TearDown()
+	{
+		// Call the parent tear down method
+		BaseTest::TearDown();
+
+		// Any custom teardown you may need
+	}
+};
+
+TEST_F(PathTest, testNormalization)
+{
+	EXPECT_STREQ("", bump::Path().c_str());
+	EXPECT_STREQ("/home/username/Desktop", bump::Path("/home/username/Desktop").c_str());
+	EXPECT_STREQ("C:/Program Files/Visual Studio", bump::Path("C:\\Program Files\\Visual Studio").c_str());
+	EXPECT_STREQ("/home/username/Desktop/Test", bump::Path("//home\\\\username///Desktop\\\\\\Test").c_str());
+	EXPECT_STREQ("/home/username/", bump::Path(bump::String("/home/username//")).c_str());
+	EXPECT_STREQ("/", bump::Path("\\/").c_str());
+	EXPECT_TRUE(bump::Path("/opt//local") == bump::Path("\\opt\\local"));
+	EXPECT_TRUE(bump::Path("/opt/local") != bump::Path("/opt/local/"));
+	EXPECT_TRUE(bump::Path("/opt/a") < bump::Path("/opt/b"));
+}
+
+TEST_F(PathTest, testIsAbsolute)
+{
+	EXPECT_TRUE(bump::Path("/usr").isAbsolute());
+	EXPECT_TRUE(bump::Path("C:\\Program Files").isAbsolute());
+	EXPECT_FALSE(bump::Path("usr/local").isAbsolute());
+	EXPECT_TRUE(bump::Path("usr/local").isRelative());
+	EXPECT_TRUE(bump::Path().isRelative());
+	EXPECT_TRUE(bump::Path().isEmpty());
+}
+
+TEST_F(PathTest, testDecomposition)
+{
+	bump::Path path("/home/username/output.tar.gz");
+	EXPECT_STREQ("output.tar.gz", path.filename().toString().c_str());
+	EXPECT_STREQ("output", path.basename().toString().c_str());
+	EXPECT_STREQ("gz", path.extension().toString().c_str());
+	EXPECT_STREQ("/home/username", path.parent().toString().c_str());
+
+	// The views point back into the path
+	EXPECT_EQ(path.c_str() + 15, path.filename().data());
+	EXPECT_EQ(path.c_str(), path.parent().data());
+
+	// Hidden files and trailing slashes
+	EXPECT_STREQ(".hidden_file", bump::Path(".hidden_file.txt").basename().toString().c_str());
+	EXPECT_STREQ("txt", bump::Path(".hidden_file.txt").extension().toString().c_str());
+	EXPECT_STREQ("", bump::Path("/home/.bashrc").extension().toString().c_str());
+	EXPECT_STREQ(".bashrc", bump::Path("/home/.bashrc").basename().toString().c_str());
+	EXPECT_STREQ("username", bump::Path("/home/username/").filename().toString().c_str());
+	EXPECT_STREQ("/home", bump::Path("/home/username/").parent().toString().c_str());
+
+	// Roots and single components
+	EXPECT_STREQ("/", bump::Path("/home").parent().toString().c_str());
+	EXPECT_STREQ("", bump::Path("/").filename().toString().c_str());
+	EXPECT_STREQ("", bump::Path("/").parent().toString().c_str());
+	EXPECT_STREQ("home", bump::Path("home").filename().toString().c_str());
+	EXPECT_STREQ("", bump::Path("home").parent().toString().c_str());
+	EXPECT_STREQ("C:/", bump::Path("C:/Windows").parent().toString().c_str());
+	EXPECT_STREQ("", bump::Path("C:/").filename().toString().c_str());
+	EXPECT_STREQ("", bump::Path().filename().toString().c_str());
+}
+
+TEST_F(PathTest, testComponents)
+{
+	bump::Path path("/usr/local//bin/");
+	ASSERT_EQ(4, path.numberOfComponents());
+	bump::Path::ComponentIterator iter = path.begin();
+	EXPECT_STREQ("/", (*iter).toString().c_str());
+	EXPECT_STREQ("usr", (*(++iter)).toString().c_str());
+	EXPECT_STREQ("local", (*(++iter)).toString().c_str());
+	EXPECT_STREQ("bin", (*(++iter)).toString().c_str());
+	EXPECT_TRUE(++iter == path.end());
+
+	EXPECT_EQ(2, bump::Path("usr/local").numberOfComponents());
+	EXPECT_EQ(1, bump::Path("/").numberOfComponents());
+	EXPECT_EQ(0, bump::Path().numberOfComponents());
+	bump::Path empty;
+	EXPECT_TRUE(empty.begin() == empty.end());
+}
+
+TEST_F(PathTest, testJoin)
+{
+	bump::StringView components[] = {"/opt", "local/", "", "\\sbin"};
+	EXPECT_STREQ("/opt/local/sbin", bump::Path::join(components, 4).c_str());
+	EXPECT_STREQ("", bump::Path::join(components, 0).c_str());
+	EXPECT_STREQ("/opt", bump::Path::join(components, 1).c_str());
+
+	bump::Path path("/home");
+	EXPECT_STREQ("/home/username/Desktop", (path / "username" / "/Desktop").c_str());
+	EXPECT_STREQ("/home", path.c_str());
+	path /= "username\\";
+	EXPECT_STREQ("/home/username/", path.c_str());
+	path /= "";
+	EXPECT_STREQ("/home/username/", path.c_str());
+	EXPECT_STREQ("usr", (bump::Path() / "usr").c_str());
+}
+
+}	// End of bumpTest namespace
@@ -0,0 +1,159 @@
+//
+//	ReadAheadStreamTest.cpp
+//	Bump
+//
+//	Created by Joseph Holub on 10/18/26.
+//	Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+// Bump headers
+#include <bump/FileSystem.h>
+#include <bump/ReadAheadStream.h>
+
+// C++ headers
+#include <fstream>
+
+// bumpTest headers
+#include "../bumpTest/BaseTest.h"
+
+// Unix headers
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace bumpTest {
+
+/**
+ * This is our main read ahead stream testing class. The SetUp and TearDown methods are
+ * executed before the test runs and after it completes. This is where we can
+ * add any custom set up for each test without having to add this to "every"
+ * test individually.
+ */
+class ReadAheadStreamTest : public BaseTest
+{
+protected:
+
+	/** Run immediately before a test starts. Starts the timer. */
+	void SetUp()
+	{
+		// Call the parent setup method
+		BaseTest::SetUp();
+
+		// Create the following directory structure
+		// - unittest
+		//     |- data.bin
+		bump::FileSystem::createDirectory("unittest");
+		for (unsigned int i = 0; i < 1000; ++i)
+		{
+			_data.push_back((char)(i % 251));
+		}
+		std::ofstream stream("unittest/data.bin", std::ios::binary);
+		stream.write(_data.data(), _data.size());
+	}
+
+	/** Invoked immediately after a test finishes. Stops the timer. */
+	void TearDown()
+	{
+		// Call the parent tear down method
+		BaseTest::TearDown();
+
+		// Remove the entire directory structure that was built
+		bump::FileSystem::removeDirectoryAndContents("unittest");
+	}
+
+	/** Reads the rest of the stream a buffer at a time, returning the result of the last call. */
+	long readAll(bump::ReadAheadStream& stream, std::string& contents)
+	{
+		bump::StringView buffer;
+		long bytes_read = 0;
+		while ((bytes_read = stream.nextBuffer(buffer)) > 0)
+		{
+			contents.append(buffer.data(), buffer.length());
+		}
+
+		return bytes_read;
+	}
+
+	// Instance member variables
+	std::string _data;
+};
+
+TEST_F(ReadAheadStreamTest, testReadFile)
+{
+	// Small buffers make the reading thread wait for the caller over and over
+	bump::ReadAheadStream stream(64, 2);
+	EXPECT_FALSE(stream.isOpen());
+	ASSERT_TRUE(stream.open("unittest/data.bin"));
+	EXPECT_TRUE(stream.isOpen());
+	EXPECT_EQ(0, stream.offset());
+
+	// Copied reads and limited buffers both take what is left of the current buffer first
+	char start[10];
+	EXPECT_EQ(10, stream.read(start, sizeof(start)));
+	EXPECT_EQ(0, _data.compare(0, 10, start, 10));
+	bump::StringView buffer;
+	EXPECT_EQ(5, stream.nextBuffer(buffer, 5));
+	EXPECT_TRUE(buffer == bump::StringView(_data).section(10, 5));
+	EXPECT_EQ(49, stream.nextBuffer(buffer));
+	EXPECT_EQ(64, stream.offset());
+
+	std::string contents(_data, 0, 64);
+	EXPECT_EQ(0, readAll(stream, contents));
+	EXPECT_TRUE(contents == _data);
+	EXPECT_EQ(_data.size(), stream.offset());
+	EXPECT_EQ(0, stream.read(start, sizeof(start)));
+
+	// Reading can start anywhere in the file
+	ASSERT_TRUE(stream.open("unittest/data.bin", 900));
+	EXPECT_EQ(900, stream.offset());
+	contents.clear();
+	EXPECT_EQ(0, readAll(stream, contents));
+	EXPECT_TRUE(contents == _data.substr(900));
+
+	// Closing while the reading thread waits for room in the queue stops it
+	ASSERT_TRUE(stream.open("unittest/data.bin"));
+	EXPECT_EQ(1, stream.read(start, 1));
+	stream.close();
+	EXPECT_FALSE(stream.isOpen());
+	EXPECT_EQ(-1, stream.nextBuffer(buffer));
+	EXPECT_EQ(EBADF, errno);
+
+	// Empty files end right away, and missing files and directories are refused
+	std::ofstream("unittest/empty.bin");
+	ASSERT_TRUE(stream.open("unittest/empty.bin"));
+	EXPECT_EQ(0, stream.nextBuffer(buffer));
+	EXPECT_FALSE(stream.open("unittest/does not exist.bin"));
+	EXPECT_EQ(ENOENT, errno);
+	EXPECT_FALSE(stream.open("unittest"));
+	EXPECT_EQ(EISDIR, errno);
+	EXPECT_FALSE(stream.isOpen());
+}
+
+TEST_F(ReadAheadStreamTest, testReadDescriptor)
+{
+	int descriptor = open("unittest/data.bin", O_RDONLY);
+	ASSERT_GE(descriptor, 0);
+
+	// The descriptor is read at an offset, so its own position never moves
+	bump::ReadAheadStream stream(100);
+	ASSERT_TRUE(stream.open(descriptor, 250));
+	std::string contents;
+	EXPECT_EQ(0, readAll(stream, contents));
+	EXPECT_TRUE(contents == _data.substr(250));
+	EXPECT_EQ(0, lseek(descriptor, 0, SEEK_CUR));
+
+	// The descriptor still belongs to the caller after the stream closes
+	stream.close();
+	char byte = 0;
+	EXPECT_EQ(1, read(descriptor, &byte, 1));
+	EXPECT_EQ(_data[0], byte);
+	close(descriptor);
+
+	// Closed descriptors are refused
+	EXPECT_FALSE(stream.open(descriptor));
+	EXPECT_EQ(EBADF, errno);
+	EXPECT_FALSE(stream.open(-1));
+	EXPECT_EQ(EBADF, errno);
+}
+
+}	// End of bumpTest namespace
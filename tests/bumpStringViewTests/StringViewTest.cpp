@@ -0,0 +1,235 @@
+//
+//	StringViewTest.cpp
+//	Bump
+//
+//	Created by Joseph Holub on 10/18/26.
+//	Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+// Bump headers
+#include <bump/OutOfRangeError.h>
+#include <bump/StringView.h>
+
+// C++ headers
+#include <limits>
+#include <sstream>
+#include <vector>
+
+// bumpTest headers
+#include "../bumpTest/BaseTest.h"
+
+namespace bumpTest {
+
+/**
+ * This is our main string view testing class. The SetUp and TearDown methods are
+ * executed before the test runs and after it completes. This is where we can
+ * add any custom set up for each test without having to add this to "every"
+ * test individually.
+ */
+class StringViewTest : public BaseTest
+{
+protected:
+
+	/** Run immediately before a test starts. Starts the timer. */
+	void SetUp()
+	{
+		// Call the parent setup method
+		BaseTest::SetUp();
+
+		// Any custom setup we may need
+	}
+
+	/** Invoked immediately after a test finishes. Stops the timer. */
+	void TearDown()
+	{
+		// Call the parent tear down method
+		BaseTest::TearDown();
+
+		// Any custom teardown you may need
+	}
+};
+
+TEST_F(StringViewTest, testConstructors)
+{
+	bump::StringView empty;
+	EXPECT_TRUE(empty.isEmpty());
+	EXPECT_EQ(0, empty.length());
+	EXPECT_TRUE(bump::StringView(NULL).isEmpty());
+
+	bump::String string = "Hello World";
+	bump::StringView view(string);
+	EXPECT_EQ(string.data(), view.data());
+	EXPECT_EQ(11, view.length());
+	EXPECT_EQ(11, bump::StringView("Hello World").length());
+	EXPECT_EQ(5, bump::StringView(string.data(), 5).length());
+	EXPECT_STREQ("Hello", bump::StringView(string.data(), 5).toString().c_str());
+}
+
+TEST_F(StringViewTest, testSubstrings)
+{
+	bump::String string = "/home/username/output.txt";
+	bump::StringView view(string);
+
+	// The substrings point back into the original string
+	EXPECT_EQ(string.data(), view.left(5).data());
+	EXPECT_STREQ("/home", view.left(5).toString().c_str());
+	EXPECT_STREQ("output.txt", view.right(10).toString().c_str());
+	EXPECT_EQ(string.data() + 15, view.right(10).data());
+	EXPECT_STREQ("username", view.section(6, 8).toString().c_str());
+	EXPECT_STREQ("output.txt", view.section(15).toString().c_str());
+
+	// Out of range lengths are clamped
+	EXPECT_EQ(view, view.left(100));
+	EXPECT_EQ(view, view.right(100));
+	EXPECT_TRUE(view.section(100).isEmpty());
+	EXPECT_STREQ("txt", view.section(22, 100).toString().c_str());
+}
+
+TEST_F(StringViewTest, testSearching)
+{
+	bump::StringView view("/home/username/output.txt");
+	EXPECT_EQ(0, view.indexOf('/'));
+	EXPECT_EQ(5, view.indexOf('/', 1));
+	EXPECT_EQ(14, view.lastIndexOf('/'));
+	EXPECT_EQ(bump::StringView::npos, view.indexOf('z'));
+	EXPECT_EQ(bump::StringView::npos, view.indexOf('/', 100));
+	EXPECT_EQ(bump::StringView::npos, view.lastIndexOf('z'));
+	EXPECT_EQ(bump::StringView::npos, bump::StringView().lastIndexOf('/'));
+
+	EXPECT_EQ(6, view.indexOf("username"));
+	EXPECT_EQ(21, view.indexOf(".txt"));
+	EXPECT_EQ(14, view.indexOf("/", 6));
+	EXPECT_EQ(0, view.indexOf(""));
+	EXPECT_EQ(3, view.indexOf("", 3));
+	EXPECT_EQ(bump::StringView::npos, view.indexOf("txtx"));
+	EXPECT_EQ(bump::StringView::npos, view.indexOf("user", 7));
+	EXPECT_EQ(bump::StringView::npos, view.indexOf("", 100));
+	EXPECT_EQ(3, bump::StringView("aaaab").indexOf("ab"));
+
+	EXPECT_TRUE(view.startsWith("/home"));
+	EXPECT_TRUE(view.startsWith(""));
+	EXPECT_FALSE(view.startsWith("home"));
+	EXPECT_TRUE(view.endsWith(".txt"));
+	EXPECT_FALSE(view.endsWith(".doc"));
+	EXPECT_FALSE(bump::StringView("txt").endsWith(".txt"));
+}
+
+TEST_F(StringViewTest, testCount)
+{
+	bump::StringView view("/home/username/output.txt");
+	EXPECT_EQ(3, view.count('/'));
+	EXPECT_EQ(0, view.count('z'));
+	EXPECT_EQ(0, bump::StringView().count('/'));
+
+	// Counts straddling the vector blocks and the lane limits
+	std::string lines;
+	for (unsigned int i = 0; i < 10000; ++i)
+	{
+		lines += (i % 3 == 0) ? "\n" : "line\n";
+	}
+	bump::StringView lines_view(lines.data(), lines.size());
+	EXPECT_EQ(10000, lines_view.count('\n'));
+	EXPECT_EQ(6666, lines_view.count('l'));
+	EXPECT_EQ(9999, lines_view.section(1).count('\n'));
+	EXPECT_EQ(9998, lines_view.section(1, lines.size() - 2).count('\n'));
+	std::string same(100000, '\xff');
+	EXPECT_EQ(100000, bump::StringView(same.data(), same.size()).count('\xff'));
+}
+
+TEST_F(StringViewTest, testSplit)
+{
+	std::vector<bump::StringView> parts;
+	bump::StringView("a,bc,,d").split(',', parts);
+	ASSERT_EQ(4, parts.size());
+	EXPECT_TRUE(parts[0] == "a");
+	EXPECT_TRUE(parts[1] == "bc");
+	EXPECT_TRUE(parts[2].isEmpty());
+	EXPECT_TRUE(parts[3] == "d");
+
+	// There is always one more part than separators
+	bump::StringView().split(',', parts);
+	ASSERT_EQ(1, parts.size());
+	EXPECT_TRUE(parts[0].isEmpty());
+	bump::StringView(",").split(',', parts);
+	EXPECT_EQ(2, parts.size());
+
+	// Separators straddling the vector blocks
+	std::string fields;
+	for (unsigned int i = 0; i < 1000; ++i)
+	{
+		fields += (i % 7 == 0) ? "\t" : "field\t";
+	}
+	bump::StringView(fields).split('\t', parts);
+	ASSERT_EQ(1001, parts.size());
+	EXPECT_TRUE(parts[0].isEmpty());
+	EXPECT_TRUE(parts[1] == "field");
+	EXPECT_TRUE(parts[999] == "field");
+	EXPECT_TRUE(parts[1000].isEmpty());
+}
+
+TEST_F(StringViewTest, testNumbers)
+{
+	long long integer = 0;
+	EXPECT_TRUE(bump::StringView("12345").toLongLong(integer));
+	EXPECT_EQ(12345, integer);
+	EXPECT_TRUE(bump::StringView("-42").toLongLong(integer));
+	EXPECT_EQ(-42, integer);
+	EXPECT_TRUE(bump::StringView("+7").toLongLong(integer));
+	EXPECT_EQ(7, integer);
+	EXPECT_TRUE(bump::StringView("9223372036854775807").toLongLong(integer));
+	EXPECT_EQ(std::numeric_limits<long long>::max(), integer);
+	EXPECT_TRUE(bump::StringView("-9223372036854775808").toLongLong(integer));
+	EXPECT_EQ(std::numeric_limits<long long>::min(), integer);
+	EXPECT_FALSE(bump::StringView("9223372036854775808").toLongLong(integer));
+	EXPECT_FALSE(bump::StringView("").toLongLong(integer));
+	EXPECT_FALSE(bump::StringView("-").toLongLong(integer));
+	EXPECT_FALSE(bump::StringView("12a").toLongLong(integer));
+	EXPECT_FALSE(bump::StringView(" 12").toLongLong(integer));
+
+	double number = 0.0;
+	EXPECT_TRUE(bump::StringView("3.25").toDouble(number));
+	EXPECT_DOUBLE_EQ(3.25, number);
+	EXPECT_TRUE(bump::StringView("-0.1").toDouble(number));
+	EXPECT_DOUBLE_EQ(-0.1, number);
+	EXPECT_TRUE(bump::StringView("1e3").toDouble(number));
+	EXPECT_DOUBLE_EQ(1000.0, number);
+	EXPECT_TRUE(bump::StringView(".5").toDouble(number));
+	EXPECT_DOUBLE_EQ(0.5, number);
+	EXPECT_TRUE(bump::StringView("42").toDouble(number));
+	EXPECT_DOUBLE_EQ(42.0, number);
+
+	// Numbers the fast path cannot represent exactly go through strtod
+	EXPECT_TRUE(bump::StringView("1.7976931348623157e308").toDouble(number));
+	EXPECT_DOUBLE_EQ(std::numeric_limits<double>::max(), number);
+	EXPECT_TRUE(bump::StringView("0.12345678901234567890123").toDouble(number));
+	EXPECT_DOUBLE_EQ(0.12345678901234567890123, number);
+	EXPECT_FALSE(bump::StringView("1e400").toDouble(number));
+	EXPECT_FALSE(bump::StringView("").toDouble(number));
+	EXPECT_FALSE(bump::StringView("1.2.3").toDouble(number));
+	EXPECT_FALSE(bump::StringView(" 1.5").toDouble(number));
+}
+
+TEST_F(StringViewTest, testAccessAndComparison)
+{
+	bump::StringView view("abc");
+	EXPECT_EQ('a', view[0]);
+	EXPECT_EQ('c', view.at(2));
+	EXPECT_THROW(view.at(3), bump::OutOfRangeError);
+
+	std::string iterated(view.begin(), view.end());
+	EXPECT_STREQ("abc", iterated.c_str());
+
+	EXPECT_TRUE(view == bump::String("abc"));
+	EXPECT_TRUE(view != "abd");
+	EXPECT_TRUE(view < "abd");
+	EXPECT_TRUE(view < "abcd");
+	EXPECT_FALSE(view < "ab");
+	EXPECT_FALSE(view < view);
+	EXPECT_TRUE(bump::StringView("\x01") < "\xff");
+
+	std::ostringstream stream;
+	stream << view.left(2);
+	EXPECT_STREQ("ab", stream.str().c_str());
+}
+
+}	// End of bumpTest namespace
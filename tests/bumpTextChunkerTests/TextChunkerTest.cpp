@@ -0,0 +1,155 @@
+//
+//	TextChunkerTest.cpp
+//	Bump
+//
+//	Created by Joseph Holub on 10/18/26.
+//	Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+// Bump headers
+#include <bump/OutOfRangeError.h>
+#include <bump/TaskError.h>
+#include <bump/TextChunker.h>
+
+// bumpTest headers
+#include "../bumpTest/BaseTest.h"
+
+namespace bumpTest {
+
+/** Counts the lines and their characters in a chunk. */
+struct LineTotals
+{
+	LineTotals() : lines(0), characters(0) {}
+
+	unsigned long	lines;
+	unsigned long	characters;
+};
+
+/** Adds the line to the totals of its chunk. */
+static void addLine(const bump::StringView& line, LineTotals& totals)
+{
+	++totals.lines;
+	totals.characters += line.length();
+}
+
+/** Adds the totals of a chunk to the merged totals. */
+static void addTotals(LineTotals& merged, const LineTotals& totals)
+{
+	merged.lines += totals.lines;
+	merged.characters += totals.characters;
+}
+
+/** Appends the line to the lines of its chunk. */
+static void appendLine(const bump::StringView& line, bump::StringList& lines)
+{
+	lines.push_back(line.toString());
+}
+
+/** Appends the line to the lines of its chunk, refusing the last line. */
+static void appendLineBeforeLast(const bump::StringView& line, bump::StringList& lines)
+{
+	if (line == "last")
+	{
+		throw bump::OutOfRangeError("The last line is refused", BUMP_LOCATION);
+	}
+	lines.push_back(line.toString());
+}
+
+/** Records the offset of the chunk. */
+static void recordOffset(const bump::TextChunk& chunk, std::size_t& offset)
+{
+	offset = chunk.offset;
+}
+
+/**
+ * This is our main text chunker testing class. The SetUp and TearDown methods are
+ * executed before the test runs and after it completes. This is where we can
+ * add any custom set up for each test without having to add this to "every"
+ * test individually.
+ */
+class TextChunkerTest : public BaseTest
+{
+	// No custom setup needed
+};
+
+TEST_F(TextChunkerTest, testSplit)
+{
+	// Every cut moves forward to just past the next newline
+	std::string text("one\ntwo\nthree\nfour\nfive");
+	bump::TextChunker chunker(text, 5);
+	EXPECT_TRUE(chunker.contents() == text);
+	ASSERT_EQ(4, chunker.numberOfChunks());
+	EXPECT_TRUE(chunker.chunks()[0].contents == "one\ntwo\n");
+	EXPECT_EQ(0, chunker.chunks()[0].offset);
+	EXPECT_TRUE(chunker.chunks()[1].contents == "three\n");
+	EXPECT_EQ(8, chunker.chunks()[1].offset);
+	EXPECT_TRUE(chunker.chunks()[2].contents == "four\n");
+	EXPECT_TRUE(chunker.chunks()[3].contents == "five");
+	EXPECT_EQ(3, chunker.chunks()[3].index);
+
+	// A cut landing right after a newline stays there
+	bump::TextChunker exact("abcd\nefgh\n", 5);
+	ASSERT_EQ(2, exact.numberOfChunks());
+	EXPECT_TRUE(exact.chunks()[0].contents == "abcd\n");
+	EXPECT_TRUE(exact.chunks()[1].contents == "efgh\n");
+
+	// Lines longer than the chunk size and text without newlines are never split
+	EXPECT_EQ(1, bump::TextChunker("a very long line without any newline", 4).numberOfChunks());
+	EXPECT_EQ(1, bump::TextChunker(text).numberOfChunks());
+	EXPECT_EQ(1, bump::TextChunker(text, 0).numberOfChunks());
+	EXPECT_EQ(0, bump::TextChunker("").numberOfChunks());
+}
+
+TEST_F(TextChunkerTest, testProcessLines)
+{
+	std::string text;
+	for (unsigned int i = 0; i < 10000; ++i)
+	{
+		text += (i % 2 == 0) ? "even line\r\n" : "odd\n";
+	}
+	text += "last";
+
+	bump::ThreadPool pool(4);
+	bump::TextChunker chunker(text, 1000);
+	EXPECT_LT(50, chunker.numberOfChunks());
+
+	// The results come back in chunk order
+	std::vector<std::size_t> offsets;
+	chunker.processChunks(pool, &recordOffset, offsets);
+	ASSERT_EQ(chunker.numberOfChunks(), offsets.size());
+	for (std::size_t i = 0; i < offsets.size(); ++i)
+	{
+		EXPECT_EQ(chunker.chunks()[i].offset, offsets[i]);
+	}
+
+	// Carriage returns are removed and every line is seen once
+	LineTotals totals;
+	chunker.processLines(pool, &addLine, &addTotals, totals);
+	EXPECT_EQ(10001, totals.lines);
+	EXPECT_EQ(5000 * 9 + 5000 * 3 + 4, totals.characters);
+
+	// Merging the lines in chunk order gives back the lines in text order
+	std::vector<bump::StringList> lines;
+	chunker.processLines(pool, &appendLine, lines);
+	bump::StringList all_lines;
+	for (std::size_t i = 0; i < lines.size(); ++i)
+	{
+		all_lines.insert(all_lines.end(), lines[i].begin(), lines[i].end());
+	}
+	ASSERT_EQ(10001, all_lines.size());
+	EXPECT_STREQ("even line", all_lines.at(0).c_str());
+	EXPECT_STREQ("odd", all_lines.at(9999).c_str());
+	EXPECT_STREQ("last", all_lines.at(10000).c_str());
+
+	// A callback that throws fails the whole run on the calling thread, and the pool stays usable
+	EXPECT_THROW(chunker.processLines(pool, &appendLineBeforeLast, lines), bump::TaskError);
+	chunker.processLines(pool, &addLine, &addTotals, totals);
+	EXPECT_EQ(20002, totals.lines);
+
+	// Empty text has nothing to process
+	bump::TextChunker empty("");
+	empty.processLines(pool, &appendLine, lines);
+	EXPECT_TRUE(lines.empty());
+}
+
+}	// End of bumpTest namespace
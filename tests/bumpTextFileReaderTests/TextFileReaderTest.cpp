@@ -7,19 +7,33 @@
 //
 
 // C++ Headers
+#include <algorithm>
 #include <fstream>
+#include <iterator>
 
 // Bump headers
+#include <bump/DecompressingReader.h>
 #include <bump/FileSystem.h>
 #include <bump/Log.h>
+#include <bump/MappedFile.h>
 #include <bump/String.h>
 #include <bump/TextFileReader.h>
+#include <bump/ThreadPool.h>
 
 // bumpTest headers
 #include "../bumpTest/BaseTest.h"
 
 namespace bumpTest {
 
+// The ten lines of unittest/unit_test.txt compressed with gzip
+static const char COMPRESSED_UNIT_TEST[] =
+	"\x1f\x8b\x08\x00\x00\x00\x00\x00\x02\x03\x5d\xce\xdd\x09\x80\x30\x0c\x04\xe0\x77\xa7\xe8"
+	"\x08\xd6\x7f\x9d\xc3\x0d\x34\x35\x01\x69\xa1\xad\xe2\xf8\x0a\x35\x85\x06\xf2\xf6\x91\xbb"
+	"\xd3\x8b\x5a\x91\x82\xfa\x2e\x22\x28\x43\x3e\x44\x75\x92\x85\xaa\x29\x25\xc0\xe6\xec\x9e"
+	"\xa8\x2d\x29\x22\xf9\x5f\x3a\x11\xe7\x2e\x1f\x31\x51\x2f\x9b\x0c\xcb\x20\x9a\xe8\x61\x19"
+	"\xe5\x86\x1b\x2c\xdb\x54\x1a\xd0\x81\x4c\x73\x49\x96\xf2\x93\xae\xc5\xf4\x9c\xf7\x02\x9d"
+	"\xf4\x9f\x9a\x09\x01\x00\x00";
+
 /**
  * This is our main TextFileReader testing class. The SetUp and TearDown methods are
  * executed before the test runs and after it completes. This is where we can
@@ -59,7 +73,7 @@ protected:
 		// Add content to the file to be read in.
 		std::ofstream unit_file;
 		unit_file.open("unittest/unit_test.txt");
-		if (unit_file != NULL)
+		if (unit_file.is_open())
 		{
 			unit_file << "1: This is the first line\n";
 			unit_file << "2: This is the second line\n";
@@ -183,6 +197,53 @@ TEST_F(TextFileReaderTest, testReadEntireFile)
 	EXPECT_STREQ("10: This is the tenth line", entire_file.at(9).toStdString().c_str());
 }
 
+TEST_F(TextFileReaderTest, testReadMappedFile)
+{
+	// Test that the lines split out of a mapped file match the lines read from its name
+	bump::MappedFile file;
+	ASSERT_TRUE(file.open(_validFileName));
+	bump::StringList mapped_file = bump::TextFileReader::fileContents(file);
+	bump::StringList entire_file = bump::TextFileReader::fileContents(_validFileName);
+	EXPECT_EQ(10, mapped_file.size());
+	EXPECT_TRUE(entire_file == mapped_file);
+
+	// Test an empty file and a file that is not open
+	bump::FileSystem::createFile("unittest/empty.txt");
+	ASSERT_TRUE(file.open("unittest/empty.txt"));
+	mapped_file = bump::TextFileReader::fileContents(file);
+	EXPECT_TRUE(bump::TextFileReader::fileContents("unittest/empty.txt") == mapped_file);
+	file.close();
+	EXPECT_TRUE(bump::TextFileReader::fileContents(file).empty());
+}
+
+TEST_F(TextFileReaderTest, testReadLargeFile)
+{
+	// Write enough lines that they are read ahead in several blocks, with lines straddling the blocks
+	std::ofstream large_file("unittest/large.txt");
+	for (unsigned int i = 1; i <= 100000; ++i)
+	{
+		large_file << "line " << i << "\n";
+	}
+	large_file.close();
+
+	bump::MappedFile file;
+	ASSERT_TRUE(file.open("unittest/large.txt"));
+	bump::StringList entire_file = bump::TextFileReader::fileContents("unittest/large.txt");
+	EXPECT_EQ(100001, entire_file.size());
+	EXPECT_TRUE(entire_file == bump::TextFileReader::fileContents(file));
+
+	bump::StringList subset = bump::TextFileReader::fileContents("unittest/large.txt", 54321, 3);
+	ASSERT_EQ(3, subset.size());
+	EXPECT_STREQ("line 54321", subset.at(0).c_str());
+	EXPECT_STREQ("line 54323", subset.at(2).c_str());
+
+	// A few thousand lines are read straight through the file in small blocks rather than read ahead
+	bump::StringList header = bump::TextFileReader::header("unittest/large.txt", 2000);
+	ASSERT_EQ(2000, header.size());
+	EXPECT_TRUE(std::equal(header.begin(), header.end(), entire_file.begin()));
+	EXPECT_STREQ("line 1", bump::TextFileReader::firstLine("unittest/large.txt").c_str());
+}
+
 TEST_F(TextFileReaderTest, testReadSubsetOfFile)
 {
 	// Grab the 2 lines of the file starting at the second line
@@ -327,4 +388,123 @@ TEST_F(TextFileReaderTest, testNumberOfLines)
 	EXPECT_EQ(10, numLines);
 }
 
+TEST_F(TextFileReaderTest, testParallelSearch)
+{
+	bump::ThreadPool pool(4);
+	EXPECT_EQ(10, bump::TextFileReader::numberOfLines(_validFileName, pool));
+	EXPECT_EQ(-1, bump::TextFileReader::numberOfLines(_invalidFileName, pool));
+
+	// Search the small file, reporting each matching line once
+	bump::TextMatchList matches = bump::TextFileReader::grep(_validFileName, "th line", pool);
+	ASSERT_EQ(7, matches.size());
+	EXPECT_EQ(4, matches.at(0).lineNumber);
+	EXPECT_EQ(79, matches.at(0).offset);
+	EXPECT_STREQ("4: This is the fourth line", matches.at(0).line.c_str());
+	EXPECT_EQ(10, matches.at(6).lineNumber);
+	EXPECT_STREQ("10: This is the tenth line", matches.at(6).line.c_str());
+	EXPECT_EQ(10, bump::TextFileReader::grep(_validFileName, "i", pool).size());
+	EXPECT_TRUE(bump::TextFileReader::grep(_validFileName, "eleventh", pool).empty());
+	EXPECT_TRUE(bump::TextFileReader::grep(_validFileName, "line\n", pool).empty());
+	EXPECT_TRUE(bump::TextFileReader::grep(_invalidFileName, "line", pool).empty());
+
+	// Search a file spanning several chunks so line numbers carry across them
+	std::ofstream large_file("unittest/large.txt", std::ios::binary);
+	for (unsigned int i = 1; i <= 500000; ++i)
+	{
+		large_file << (i % 100000 == 0 ? "match " : "line ") << i << "\r\n";
+	}
+	large_file.close();
+	EXPECT_EQ(500001, bump::TextFileReader::numberOfLines("unittest/large.txt", pool));
+	matches = bump::TextFileReader::grep("unittest/large.txt", "match", pool);
+	ASSERT_EQ(5, matches.size());
+	for (unsigned int i = 0; i < matches.size(); ++i)
+	{
+		bump::String expected = bump::String("match ") + bump::String((i + 1) * 100000);
+		EXPECT_EQ((i + 1) * 100000, matches.at(i).lineNumber);
+		EXPECT_STREQ(expected.c_str(), matches.at(i).line.c_str());
+	}
+}
+
+TEST_F(TextFileReaderTest, testCompressedFile)
+{
+	if (!bump::DecompressingReader::isFormatSupported(bump::DecompressingReader::GZIP_FORMAT))
+	{
+		return;
+	}
+
+	std::ofstream compressed_file("unittest/unit_test.txt.gz", std::ios::binary);
+	compressed_file.write(COMPRESSED_UNIT_TEST, sizeof(COMPRESSED_UNIT_TEST) - 1);
+	compressed_file.close();
+
+	// Every query reads the compressed file exactly like the plain one
+	const bump::String compressed = "unittest/unit_test.txt.gz";
+	bump::ThreadPool pool(2);
+	EXPECT_TRUE(bump::TextFileReader::fileContents(compressed) == bump::TextFileReader::fileContents(_validFileName));
+	EXPECT_TRUE(bump::TextFileReader::fileContents(compressed, 3, 4) == bump::TextFileReader::fileContents(_validFileName, 3, 4));
+	EXPECT_TRUE(bump::TextFileReader::fileContents(compressed, 8) == bump::TextFileReader::fileContents(_validFileName, 8));
+	EXPECT_TRUE(bump::TextFileReader::header(compressed, 2) == bump::TextFileReader::header(_validFileName, 2));
+	EXPECT_TRUE(bump::TextFileReader::footer(compressed, 3) == bump::TextFileReader::footer(_validFileName, 3));
+	EXPECT_TRUE(bump::TextFileReader::footer(compressed, 20) == bump::TextFileReader::footer(_validFileName, 20));
+	EXPECT_STREQ("1: This is the first line", bump::TextFileReader::firstLine(compressed).c_str());
+	EXPECT_EQ(10, bump::TextFileReader::fileContents(compressed).size());
+	EXPECT_TRUE(bump::TextFileReader::fileContents(compressed, 11).empty());
+	EXPECT_EQ(10, bump::TextFileReader::numberOfLines(compressed));
+	EXPECT_EQ(10, bump::TextFileReader::numberOfLines(compressed, pool));
+
+	bump::TextMatchList matches = bump::TextFileReader::grep(compressed, "th line", pool);
+	ASSERT_EQ(7, matches.size());
+	EXPECT_EQ(4, matches.at(0).lineNumber);
+	EXPECT_EQ(79, matches.at(0).offset);
+	EXPECT_STREQ("4: This is the fourth line", matches.at(0).line.c_str());
+
+	// Corrupt files return nothing
+	std::ofstream corrupt_file("unittest/corrupt.gz", std::ios::binary);
+	corrupt_file.write(COMPRESSED_UNIT_TEST, 10);
+	corrupt_file << "\xff\xff\xff\xff";
+	corrupt_file.close();
+	EXPECT_TRUE(bump::TextFileReader::fileContents("unittest/corrupt.gz").empty());
+	EXPECT_EQ(-1, bump::TextFileReader::numberOfLines("unittest/corrupt.gz"));
+}
+
+TEST_F(TextFileReaderTest, testLargeCompressedFile)
+{
+	if (!bump::DecompressingReader::isFormatSupported(bump::DecompressingReader::GZIP_FORMAT))
+	{
+		return;
+	}
+
+	// Appended copies of the compressed file decompress to many blocks, with lines straddling the blocks
+	std::ifstream unit_file("unittest/unit_test.txt", std::ios::binary);
+	std::string unit_contents((std::istreambuf_iterator<char>(unit_file)), std::istreambuf_iterator<char>());
+	std::ofstream compressed_file("unittest/large.txt.gz", std::ios::binary);
+	std::ofstream plain_file("unittest/large.txt", std::ios::binary);
+	for (unsigned int i = 0; i < 3000; ++i)
+	{
+		compressed_file.write(COMPRESSED_UNIT_TEST, sizeof(COMPRESSED_UNIT_TEST) - 1);
+		plain_file << unit_contents;
+	}
+	compressed_file.close();
+	plain_file.close();
+
+	// Every match is numbered and placed exactly as in the plain file
+	bump::ThreadPool pool(2);
+	bump::TextMatchList compressed_matches = bump::TextFileReader::grep("unittest/large.txt.gz", "tenth line1", pool);
+	bump::TextMatchList plain_matches = bump::TextFileReader::grep("unittest/large.txt", "tenth line1", pool);
+	ASSERT_EQ(2999, compressed_matches.size());
+	ASSERT_EQ(plain_matches.size(), compressed_matches.size());
+	for (std::size_t i = 0; i < plain_matches.size(); ++i)
+	{
+		EXPECT_EQ(plain_matches[i].lineNumber, compressed_matches[i].lineNumber);
+		EXPECT_EQ(plain_matches[i].offset, compressed_matches[i].offset);
+		EXPECT_TRUE(plain_matches[i].line == compressed_matches[i].line);
+	}
+	compressed_matches = bump::TextFileReader::grep("unittest/large.txt.gz", "10: This", pool);
+	ASSERT_EQ(3000, compressed_matches.size());
+	EXPECT_EQ(27001, compressed_matches.back().lineNumber);
+
+	// Only the last lines are kept while the footer is decompressed
+	EXPECT_TRUE(bump::TextFileReader::footer("unittest/large.txt.gz", 25) == bump::TextFileReader::footer("unittest/large.txt", 25));
+	EXPECT_TRUE(bump::TextFileReader::footer("unittest/large.txt.gz", 1) == bump::TextFileReader::footer("unittest/large.txt", 1));
+}
+
 }	// End of bumpTest namespace
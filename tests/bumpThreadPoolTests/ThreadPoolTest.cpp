@@ -0,0 +1,167 @@
+//
+//	ThreadPoolTest.cpp
+//	Bump
+//
+//	Created by Joseph Holub on 10/18/26.
+//	Copyright (c) 2026 Joseph Holub. All rights reserved.
+//
+
+// Boost headers
+#include <boost/bind.hpp>
+#include <boost/thread/mutex.hpp>
+
+// Bump headers
+#include <bump/ThreadPool.h>
+
+// C++ headers
+#include <set>
+#include <stdexcept>
+
+// bumpTest headers
+#include "../bumpTest/BaseTest.h"
+
+namespace bumpTest {
+
+/**
+ * Counts the number of tasks run and the threads they ran on.
+ */
+class TaskCounter
+{
+public:
+
+	TaskCounter() : _count(0) {}
+
+	void increment()
+	{
+		boost::mutex::scoped_lock lock(_mutex);
+		++_count;
+		_threadIds.insert(boost::this_thread::get_id());
+	}
+
+	void fanOut(bump::ThreadPool* pool, unsigned int depth)
+	{
+		increment();
+		if (depth == 0)
+		{
+			return;
+		}
+
+		// Every task submits two more tasks from inside the pool
+		pool->submit(boost::bind(&TaskCounter::fanOut, this, pool, depth - 1));
+		pool->submit(boost::bind(&TaskCounter::fanOut, this, pool, depth - 1));
+	}
+
+	void throwError()
+	{
+		increment();
+		throw std::runtime_error("task failure");
+	}
+
+	unsigned int count()
+	{
+		boost::mutex::scoped_lock lock(_mutex);
+		return _count;
+	}
+
+	unsigned int numberOfThreads()
+	{
+		boost::mutex::scoped_lock lock(_mutex);
+		return _threadIds.size();
+	}
+
+protected:
+
+	boost::mutex _mutex;
+	unsigned int _count;
+	std::set<boost::thread::id> _threadIds;
+};
+
+/**
+ * This is our main thread pool testing class. The SetUp and TearDown methods are
+ * executed before the test runs and after it completes. This is where we can
+ * add any custom set up for each test without having to add this to "every"
+ * test individually.
+ */
+class ThreadPoolTest : public BaseTest
+{
+protected:
+
+	/** Run immediately before a test starts. Starts the timer. */
+	void SetUp()
+	{
+		// Call the parent setup method
+		BaseTest::SetUp();
+	}
+
+	/** Invoked immediately after a test finishes. Stops the timer. */
+	void TearDown()
+	{
+		// Call the parent tear down method
+		BaseTest::TearDown();
+	}
+};
+
+TEST_F(ThreadPoolTest, testNumberOfThreads)
+{
+	// Test the explicit thread count
+	bump::ThreadPool pool(3);
+	EXPECT_EQ(3, pool.numberOfThreads());
+
+	// Test the default thread count
+	bump::ThreadPool default_pool;
+	EXPECT_EQ(bump::ThreadPool::idealThreadCount(), default_pool.numberOfThreads());
+	EXPECT_LE(1, bump::ThreadPool::idealThreadCount());
+}
+
+TEST_F(ThreadPoolTest, testSubmit)
+{
+	// Test submitting tasks from outside the pool
+	TaskCounter counter;
+	bump::ThreadPool pool(4);
+	for (unsigned int i = 0; i < 1000; ++i)
+	{
+		pool.submit(boost::bind(&TaskCounter::increment, &counter));
+	}
+	pool.waitForDone();
+	EXPECT_EQ(1000, counter.count());
+
+	// Test waiting on a pool without any tasks
+	pool.waitForDone();
+	EXPECT_EQ(1000, counter.count());
+}
+
+TEST_F(ThreadPoolTest, testNestedSubmit)
+{
+	// Test tasks submitting more tasks (2^11 - 1 tasks in total)
+	TaskCounter counter;
+	bump::ThreadPool pool(4);
+	pool.submit(boost::bind(&TaskCounter::fanOut, &counter, &pool, 10));
+	pool.waitForDone();
+	EXPECT_EQ(2047, counter.count());
+	EXPECT_LE(1, counter.numberOfThreads());
+	EXPECT_GE(4, counter.numberOfThreads());
+}
+
+TEST_F(ThreadPoolTest, testTaskExceptions)
+{
+	// Test that a throwing task doesn't take down the pool
+	TaskCounter counter;
+	bump::ThreadPool pool(2);
+	pool.submit(boost::bind(&TaskCounter::throwError, &counter));
+	pool.submit(boost::bind(&TaskCounter::increment, &counter));
+	pool.waitForDone();
+	EXPECT_EQ(2, counter.count());
+}
+
+TEST_F(ThreadPoolTest, testDestructorWaits)
+{
+	// Test that the destructor finishes all the queued tasks
+	TaskCounter counter;
+	{
+		bump::ThreadPool pool(2);
+		pool.submit(boost::bind(&TaskCounter::fanOut, &counter, &pool, 5));
+	}
+	EXPECT_EQ(63, counter.count());
+}
+
+}	// End of bumpTest namespace